@@ -561,4 +561,210 @@ __STATIC_FORCEINLINE void __set_DCCISW(uint32_t value)
   __set_CP(15, 0, value, 7, 14, 2);
 }
 
+/** \brief  Get PMCR
+    \return               Performance Monitors Control Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMCR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 12, 0);
+  return result;
+}
+
+/** \brief  Set PMCR
+    \param [in]    pmcr   Performance Monitors Control Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMCR(uint32_t pmcr)
+{
+  __set_CP(15, 0, pmcr, 9, 12, 0);
+}
+
+/** \brief  Get PMCNTENSET
+    \return               Performance Monitors Count Enable Set register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMCNTENSET(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 12, 1);
+  return result;
+}
+
+/** \brief  Set PMCNTENSET
+    \param [in]    pmcntenset  Performance Monitors Count Enable Set register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMCNTENSET(uint32_t pmcntenset)
+{
+  __set_CP(15, 0, pmcntenset, 9, 12, 1);
+}
+
+/** \brief  Get PMCNTENCLR
+    \return               Performance Monitors Count Enable Clear register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMCNTENCLR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 12, 2);
+  return result;
+}
+
+/** \brief  Set PMCNTENCLR
+    \param [in]    pmcntenclr  Performance Monitors Count Enable Clear register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMCNTENCLR(uint32_t pmcntenclr)
+{
+  __set_CP(15, 0, pmcntenclr, 9, 12, 2);
+}
+
+/** \brief  Get PMOVSR
+    \return               Performance Monitors Overflow Flag Status Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMOVSR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 12, 3);
+  return result;
+}
+
+/** \brief  Set PMOVSR
+    \param [in]    pmovsr  Performance Monitors Overflow Flag Status Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMOVSR(uint32_t pmovsr)
+{
+  __set_CP(15, 0, pmovsr, 9, 12, 3);
+}
+
+/** \brief  Set PMSWINC
+    \param [in]    pmswinc  Performance Monitors Software Increment register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMSWINC(uint32_t pmswinc)
+{
+  __set_CP(15, 0, pmswinc, 9, 12, 4);
+}
+
+/** \brief  Get PMSELR
+    \return               Performance Monitors Event Counter Selection Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMSELR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 12, 5);
+  return result;
+}
+
+/** \brief  Set PMSELR
+    \param [in]    pmselr  Performance Monitors Event Counter Selection Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMSELR(uint32_t pmselr)
+{
+  __set_CP(15, 0, pmselr, 9, 12, 5);
+}
+
+/** \brief  Get PMCCNTR
+    \return               Performance Monitors Cycle Count Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMCCNTR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 13, 0);
+  return result;
+}
+
+/** \brief  Set PMCCNTR
+    \param [in]    pmccntr  Performance Monitors Cycle Count Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMCCNTR(uint32_t pmccntr)
+{
+  __set_CP(15, 0, pmccntr, 9, 13, 0);
+}
+
+/** \brief  Get PMXEVTYPER
+    \return               Performance Monitors Selected Event Type Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMXEVTYPER(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 13, 1);
+  return result;
+}
+
+/** \brief  Set PMXEVTYPER
+    \param [in]    pmxevtyper  Performance Monitors Selected Event Type Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMXEVTYPER(uint32_t pmxevtyper)
+{
+  __set_CP(15, 0, pmxevtyper, 9, 13, 1);
+}
+
+/** \brief  Get PMXEVCNTR
+    \return               Performance Monitors Selected Event Count Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMXEVCNTR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 13, 2);
+  return result;
+}
+
+/** \brief  Set PMXEVCNTR
+    \param [in]    pmxevcntr  Performance Monitors Selected Event Count Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMXEVCNTR(uint32_t pmxevcntr)
+{
+  __set_CP(15, 0, pmxevcntr, 9, 13, 2);
+}
+
+/** \brief  Get PMUSERENR
+    \return               Performance Monitors User Enable Register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMUSERENR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 14, 0);
+  return result;
+}
+
+/** \brief  Set PMUSERENR
+    \param [in]    pmuserenr  Performance Monitors User Enable Register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMUSERENR(uint32_t pmuserenr)
+{
+  __set_CP(15, 0, pmuserenr, 9, 14, 0);
+}
+
+/** \brief  Get PMINTENSET
+    \return               Performance Monitors Interrupt Enable Set register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMINTENSET(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 14, 1);
+  return result;
+}
+
+/** \brief  Set PMINTENSET
+    \param [in]    pmintenset  Performance Monitors Interrupt Enable Set register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMINTENSET(uint32_t pmintenset)
+{
+  __set_CP(15, 0, pmintenset, 9, 14, 1);
+}
+
+/** \brief  Get PMINTENCLR
+    \return               Performance Monitors Interrupt Enable Clear register value
+ */
+__STATIC_FORCEINLINE uint32_t __get_PMINTENCLR(void)
+{
+  uint32_t result;
+  __get_CP(15, 0, result, 9, 14, 2);
+  return result;
+}
+
+/** \brief  Set PMINTENCLR
+    \param [in]    pmintenclr  Performance Monitors Interrupt Enable Clear register value to set
+ */
+__STATIC_FORCEINLINE void __set_PMINTENCLR(uint32_t pmintenclr)
+{
+  __set_CP(15, 0, pmintenclr, 9, 14, 2);
+}
+
 #endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * CMSIS-Core Cycle and Performance Counter API
+ *
+ * Include after the device header. The counter backend is selected at compile
+ * time from the features of the core header:
+ *  - Cortex-A:                       CP15 Performance Monitors (PMCCNTR, PMXEVCNTR)
+ *  - Cortex-M with PMU (Armv8.1-M):  PMU cycle counter and event counters
+ *  - Cortex-M Mainline:              DWT cycle counter (no event counters)
+ *
+ * perf_cycles64() uses the extension state perf_cycles_ext that is defined in
+ * cmsis_perf.c. CMSIS_PERF_BACKEND must be the same in all modules.
+ */
+
+#if   defined ( __ICCARM__ )
+  #pragma system_include         /* treat file as system include file for MISRA check */
+#elif defined (__clang__)
+  #pragma clang system_header    /* treat file as system include file */
+#endif
+
+#ifndef CMSIS_PERF_H
+#define CMSIS_PERF_H
+
+#include <stdint.h>
+
+/* Counter backends */
+#define CMSIS_PERF_BACKEND_NONE     0U          /*!< No cycle counter available */
+#define CMSIS_PERF_BACKEND_DWT      1U          /*!< Cortex-M DWT cycle counter */
+#define CMSIS_PERF_BACKEND_PMU      2U          /*!< Armv8.1-M Performance Monitoring Unit */
+#define CMSIS_PERF_BACKEND_CP15     3U          /*!< Cortex-A CP15 Performance Monitors */
+
+#ifndef CMSIS_PERF_BACKEND
+  #if   defined (__CORTEX_A)
+    #define CMSIS_PERF_BACKEND      CMSIS_PERF_BACKEND_CP15
+  #elif defined (__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+    #define CMSIS_PERF_BACKEND      CMSIS_PERF_BACKEND_PMU
+  #elif defined (__CORTEX_M) && (__ARM_ARCH_ISA_THUMB >= 2)
+    #define CMSIS_PERF_BACKEND      CMSIS_PERF_BACKEND_DWT
+  #else
+    #define CMSIS_PERF_BACKEND      CMSIS_PERF_BACKEND_NONE
+  #endif
+#endif
+
+/* Architectural events (same event numbers for Armv7-A and Armv8.1-M) */
+#define PERF_EVENT_SW_INCR          0x0000U     /*!< Software increment */
+#define PERF_EVENT_L1I_CACHE_REFILL 0x0001U     /*!< L1 I-Cache refill */
+#define PERF_EVENT_L1D_CACHE_REFILL 0x0003U     /*!< L1 D-Cache refill */
+#define PERF_EVENT_L1D_CACHE        0x0004U     /*!< L1 D-Cache access */
+#define PERF_EVENT_LD_RETIRED       0x0006U     /*!< Load instruction architecturally executed */
+#define PERF_EVENT_ST_RETIRED       0x0007U     /*!< Store instruction architecturally executed */
+#define PERF_EVENT_INST_RETIRED     0x0008U     /*!< Instruction architecturally executed */
+#define PERF_EVENT_EXC_TAKEN        0x0009U     /*!< Exception taken */
+#define PERF_EVENT_BR_MIS_PRED      0x0010U     /*!< Mispredicted or not predicted branch */
+#define PERF_EVENT_CPU_CYCLES       0x0011U     /*!< Cycle */
+#define PERF_EVENT_BR_PRED          0x0012U     /*!< Predictable branch */
+#define PERF_EVENT_MEM_ACCESS       0x0013U     /*!< Data memory access */
+
+#if (CMSIS_PERF_BACKEND != CMSIS_PERF_BACKEND_NONE)
+
+/* 64-bit extension of the 32-bit cycle counter (shared by all modules) */
+typedef struct {
+  uint32_t last;                                /*!< Last cycle counter value */
+  uint32_t high;                                /*!< Number of cycle counter wraps */
+} perf_cycles_ext_t;
+
+extern perf_cycles_ext_t perf_cycles_ext;       /*!< Defined in cmsis_perf.c */
+
+/**
+  \brief   Enable the cycle counter and the event counters
+  \return  0 on success, -1 when the cycle counter is not implemented
+*/
+__STATIC_INLINE int32_t perf_init(void)
+{
+#if   (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  __set_PMCR((__get_PMCR() | 1U) & ~8U);        /* PMCR.E: enable counters, PMCR.D: count every cycle */
+  __set_PMCNTENSET(0x80000000U);                /* Cycle counter */
+  __ISB();
+#elif (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_PMU)
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  ARM_PMU_Enable();
+  ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+#else
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  if ((DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) != 0U) {
+    return -1;
+  }
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+  return 0;
+}
+
+/**
+  \brief   Read the 32-bit cycle counter
+  \return  Cycle count
+*/
+__STATIC_FORCEINLINE uint32_t perf_cycles(void)
+{
+#if   (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  return __get_PMCCNTR();
+#elif (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_PMU)
+  return ARM_PMU_Get_CCNTR();
+#else
+  return DWT->CYCCNT;
+#endif
+}
+
+/**
+  \brief   Read the 64-bit cycle counter
+  \return  Cycle count
+  \note    The 32-bit counter is extended in software. Call at least once per
+           counter wrap (2^32 cycles) to detect every wrap.
+*/
+__STATIC_FORCEINLINE uint64_t perf_cycles64(void)
+{
+  uint32_t now, high;
+#if (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  uint32_t state = __get_CPSR();
+#else
+  uint32_t state = __get_PRIMASK();
+#endif
+
+  __disable_irq();
+  now  = perf_cycles();
+  high = perf_cycles_ext.high;
+  if (now < perf_cycles_ext.last) {
+    high++;
+    perf_cycles_ext.high = high;
+  }
+  perf_cycles_ext.last = now;
+#if (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  __set_CPSR(state);
+#else
+  __set_PRIMASK(state);
+#endif
+
+  return (((uint64_t)high << 32) | now);
+}
+
+/**
+  \brief   Get the number of event counters
+  \return  Number of event counters (0 when only the cycle counter is available)
+*/
+__STATIC_INLINE uint32_t perf_event_num(void)
+{
+#if   (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  return ((__get_PMCR() >> 11U) & 0x1FU);       /* PMCR.N */
+#elif (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_PMU)
+  return __PMU_NUM_EVENTCNT;
+#else
+  return 0U;
+#endif
+}
+
+/**
+  \brief   Configure and enable an event counter
+  \param [in]    num    Event counter (0 .. perf_event_num()-1)
+  \param [in]    event  Event to count (PERF_EVENT_... or a core specific event number)
+  \return  0 on success, -1 when the event counter is not available
+*/
+__STATIC_INLINE int32_t perf_event_config(uint32_t num, uint32_t event)
+{
+#if   (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  if (num >= perf_event_num()) {
+    return -1;
+  }
+  __set_PMSELR(num);
+  __ISB();
+  __set_PMXEVTYPER(event);
+  __set_PMCNTENSET(1UL << num);
+  return 0;
+#elif (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_PMU)
+  if (num >= __PMU_NUM_EVENTCNT) {
+    return -1;
+  }
+  ARM_PMU_Set_EVTYPER(num, event);
+  ARM_PMU_CNTR_Enable(1UL << num);
+  return 0;
+#else
+  (void)num;
+  (void)event;
+  return -1;
+#endif
+}
+
+/**
+  \brief   Read an event counter
+  \param [in]    num    Event counter
+  \return  Event count (the PMU of Armv8.1-M implements 16-bit event counters)
+*/
+__STATIC_FORCEINLINE uint32_t perf_event_read(uint32_t num)
+{
+#if   (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  __set_PMSELR(num);
+  __ISB();
+  return __get_PMXEVCNTR();
+#elif (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_PMU)
+  return ARM_PMU_Get_EVCNTR(num);
+#else
+  (void)num;
+  return 0U;
+#endif
+}
+
+/**
+  \brief   Reset all event counters
+*/
+__STATIC_INLINE void perf_event_reset(void)
+{
+#if   (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_CP15)
+  __set_PMCR(__get_PMCR() | 2U);                /* PMCR.P: reset event counters */
+  __ISB();
+#elif (CMSIS_PERF_BACKEND == CMSIS_PERF_BACKEND_PMU)
+  ARM_PMU_EVCNTR_ALL_Reset();
+#endif
+}
+
+#endif /* CMSIS_PERF_BACKEND != CMSIS_PERF_BACKEND_NONE */
+
+#endif /* CMSIS_PERF_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -48,6 +48,15 @@
 #define __SCB_ICACHE_LINE_SIZE  32U /*!< Cortex-M7 cache line size is fixed to 32 bytes (8 words). See also register SCB_CCSIDR */
 #endif
 
+#ifndef __SCB_DCACHE_SETWAY_RATIO
+#define __SCB_DCACHE_SETWAY_RATIO  1U  /*!< D-Cache clean (and invalidate) by address uses set/way operations for ranges
+                                            with more lines than the D-Cache times this ratio (0: always by address) */
+#endif
+
+#ifndef __SCB_DCACHE_SETWAY_MIN
+#define __SCB_DCACHE_SETWAY_MIN    4096U  /*!< Smallest D-Cache size in bytes: smaller ranges are always maintained by address */
+#endif
+
 /**
   \brief   Enable I-Cache
   \details Turns on I-Cache
@@ -345,11 +354,57 @@ __STATIC_FORCEINLINE void SCB_CleanInvalidateDCache (void)
 }
 
 
+/**
+  \brief   Get D-Cache line count
+  \details Returns the number of lines (sets * ways) of the Level 1 D-Cache.
+  \return           number of D-Cache lines
+  */
+__STATIC_FORCEINLINE uint32_t SCB_GetDCacheLineCount (void)
+{
+  #if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    uint32_t ccsidr;
+
+    SCB->CSSELR = 0U;                       /* select Level 1 data cache */
+    __DSB();
+
+    ccsidr = SCB->CCSIDR;
+
+    return ((CCSIDR_SETS(ccsidr) + 1U) * (CCSIDR_WAYS(ccsidr) + 1U));
+  #else
+    return 0U;
+  #endif
+}
+
+
+/**
+  \brief   D-Cache range selects set/way maintenance
+  \details Checks if cleaning a range by set/way operations is faster than by address:
+           the range has more lines than the D-Cache times __SCB_DCACHE_SETWAY_RATIO.
+  \param[in]   op_size   size of the range (in number of bytes, from a line aligned address)
+  \return           1 when set/way operations are used, 0 otherwise
+  */
+__STATIC_FORCEINLINE uint32_t __SCB_DCacheUseSetWay (int32_t op_size)
+{
+  #if (__SCB_DCACHE_SETWAY_RATIO > 0U)
+    if ((uint32_t)op_size > (__SCB_DCACHE_SETWAY_RATIO * __SCB_DCACHE_SETWAY_MIN)) {
+      if (((uint32_t)op_size / __SCB_DCACHE_LINE_SIZE) > (__SCB_DCACHE_SETWAY_RATIO * SCB_GetDCacheLineCount())) {
+        return 1U;
+      }
+    }
+  #else
+    (void)op_size;
+  #endif
+  return 0U;
+}
+
+
 /**
   \brief   D-Cache Invalidate by address
   \details Invalidates D-Cache for the given address.
            D-Cache is invalidated starting from a 32 byte aligned address in 32 byte granularity.
            D-Cache memory blocks which are part of given address + given size are invalidated.
+           Large ranges are invalidated by address as well: a set/way invalidate would discard
+           dirty lines outside of the range.
   \param[in]   addr    address
   \param[in]   dsize   size of memory block (in number of bytes)
 */
@@ -362,11 +417,20 @@ __STATIC_FORCEINLINE void SCB_InvalidateDCache_by_Addr (volatile void *addr, int
 
       __DSB();
 
-      do {
+      while ( op_size > (int32_t)(3U * __SCB_DCACHE_LINE_SIZE) ) {
         SCB->DCIMVAC = op_addr;             /* register accepts only 32byte aligned values, only bits 31..5 are valid */
+        SCB->DCIMVAC = op_addr +      __SCB_DCACHE_LINE_SIZE;
+        SCB->DCIMVAC = op_addr + (2U * __SCB_DCACHE_LINE_SIZE);
+        SCB->DCIMVAC = op_addr + (3U * __SCB_DCACHE_LINE_SIZE);
+        op_addr += 4U * __SCB_DCACHE_LINE_SIZE;
+        op_size -= (int32_t)(4U * __SCB_DCACHE_LINE_SIZE);
+      }
+
+      while ( op_size > 0 ) {
+        SCB->DCIMVAC = op_addr;
         op_addr += __SCB_DCACHE_LINE_SIZE;
-        op_size -= __SCB_DCACHE_LINE_SIZE;
-      } while ( op_size > 0 );
+        op_size -= (int32_t)__SCB_DCACHE_LINE_SIZE;
+      }
 
       __DSB();
       __ISB();
@@ -380,6 +444,7 @@ __STATIC_FORCEINLINE void SCB_InvalidateDCache_by_Addr (volatile void *addr, int
   \details Cleans D-Cache for the given address
            D-Cache is cleaned starting from a 32 byte aligned address in 32 byte granularity.
            D-Cache memory blocks which are part of given address + given size are cleaned.
+           Ranges larger than the D-Cache (see __SCB_DCACHE_SETWAY_RATIO) clean the whole D-Cache by set/way.
   \param[in]   addr    address
   \param[in]   dsize   size of memory block (in number of bytes)
 */
@@ -390,13 +455,27 @@ __STATIC_FORCEINLINE void SCB_CleanDCache_by_Addr (volatile void *addr, int32_t
        int32_t op_size = dsize + (((uint32_t)addr) & (__SCB_DCACHE_LINE_SIZE - 1U));
       uint32_t op_addr = (uint32_t)addr /* & ~(__SCB_DCACHE_LINE_SIZE - 1U) */;
 
+      if (__SCB_DCacheUseSetWay(op_size) != 0U) {
+        SCB_CleanDCache();                  /* whole D-Cache by set/way is faster for large ranges */
+        return;
+      }
+
       __DSB();
 
-      do {
+      while ( op_size > (int32_t)(3U * __SCB_DCACHE_LINE_SIZE) ) {
         SCB->DCCMVAC = op_addr;             /* register accepts only 32byte aligned values, only bits 31..5 are valid */
+        SCB->DCCMVAC = op_addr +      __SCB_DCACHE_LINE_SIZE;
+        SCB->DCCMVAC = op_addr + (2U * __SCB_DCACHE_LINE_SIZE);
+        SCB->DCCMVAC = op_addr + (3U * __SCB_DCACHE_LINE_SIZE);
+        op_addr += 4U * __SCB_DCACHE_LINE_SIZE;
+        op_size -= (int32_t)(4U * __SCB_DCACHE_LINE_SIZE);
+      }
+
+      while ( op_size > 0 ) {
+        SCB->DCCMVAC = op_addr;
         op_addr += __SCB_DCACHE_LINE_SIZE;
-        op_size -= __SCB_DCACHE_LINE_SIZE;
-      } while ( op_size > 0 );
+        op_size -= (int32_t)__SCB_DCACHE_LINE_SIZE;
+      }
 
       __DSB();
       __ISB();
@@ -410,6 +489,7 @@ __STATIC_FORCEINLINE void SCB_CleanDCache_by_Addr (volatile void *addr, int32_t
   \details Cleans and invalidates D_Cache for the given address
            D-Cache is cleaned and invalidated starting from a 32 byte aligned address in 32 byte granularity.
            D-Cache memory blocks which are part of given address + given size are cleaned and invalidated.
+           Ranges larger than the D-Cache (see __SCB_DCACHE_SETWAY_RATIO) clean and invalidate the whole D-Cache by set/way.
   \param[in]   addr    address (aligned to 32-byte boundary)
   \param[in]   dsize   size of memory block (in number of bytes)
 */
@@ -420,13 +500,27 @@ __STATIC_FORCEINLINE void SCB_CleanInvalidateDCache_by_Addr (volatile void *addr
        int32_t op_size = dsize + (((uint32_t)addr) & (__SCB_DCACHE_LINE_SIZE - 1U));
       uint32_t op_addr = (uint32_t)addr /* & ~(__SCB_DCACHE_LINE_SIZE - 1U) */;
 
+      if (__SCB_DCacheUseSetWay(op_size) != 0U) {
+        SCB_CleanInvalidateDCache();        /* whole D-Cache by set/way is faster for large ranges */
+        return;
+      }
+
       __DSB();
 
-      do {
+      while ( op_size > (int32_t)(3U * __SCB_DCACHE_LINE_SIZE) ) {
         SCB->DCCIMVAC = op_addr;            /* register accepts only 32byte aligned values, only bits 31..5 are valid */
-        op_addr +=          __SCB_DCACHE_LINE_SIZE;
-        op_size -=          __SCB_DCACHE_LINE_SIZE;
-      } while ( op_size > 0 );
+        SCB->DCCIMVAC = op_addr +      __SCB_DCACHE_LINE_SIZE;
+        SCB->DCCIMVAC = op_addr + (2U * __SCB_DCACHE_LINE_SIZE);
+        SCB->DCCIMVAC = op_addr + (3U * __SCB_DCACHE_LINE_SIZE);
+        op_addr += 4U * __SCB_DCACHE_LINE_SIZE;
+        op_size -= (int32_t)(4U * __SCB_DCACHE_LINE_SIZE);
+      }
+
+      while ( op_size > 0 ) {
+        SCB->DCCIMVAC = op_addr;
+        op_addr += __SCB_DCACHE_LINE_SIZE;
+        op_size -= (int32_t)__SCB_DCACHE_LINE_SIZE;
+      }
 
       __DSB();
       __ISB();
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * CMSIS Core(M) Statistical PC sampling profiler
+ */
+
+#if   defined ( __ICCARM__ )
+  #pragma system_include         /* treat file as system include file for MISRA check */
+#elif defined (__clang__)
+  #pragma clang system_header   /* treat file as system include file */
+#endif
+
+#ifndef PC_SAMPLE_H
+#define PC_SAMPLE_H
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// \details Histogram buffer identification ("PCSM") and format version.
+#define ARM_PC_SAMPLE_MAGIC         0x4D534350U
+#define ARM_PC_SAMPLE_VERSION       1U
+
+/// \details Maximum number of probed histogram entries per sample (a sample is dropped when all probed entries are used).
+#ifndef ARM_PC_SAMPLE_PROBE
+#define ARM_PC_SAMPLE_PROBE         8U
+#endif
+
+/// \details Histogram entry (12 bytes): number of samples of a PC and caller (LR) pair.
+typedef struct {
+  uint32_t                        pc;   ///< sampled PC (0: unused entry)
+  uint32_t                        lr;   ///< caller (LR of the sampled context, bit 0 cleared)
+  uint32_t                     count;   ///< number of samples
+} ARM_PC_Sample_Entry_t;
+
+/// \details Histogram buffer header (32 bytes), followed by the histogram entries.
+typedef struct {
+  uint32_t                     magic;   ///< ARM_PC_SAMPLE_MAGIC
+  uint16_t                   version;   ///< ARM_PC_SAMPLE_VERSION
+  uint16_t                entry_size;   ///< size of a histogram entry in bytes
+  uint32_t                     count;   ///< number of histogram entries (power of 2)
+  uint32_t                    period;   ///< sampling period in cycles (0: external sampling source)
+  volatile uint32_t          samples;   ///< number of samples recorded in the histogram
+  volatile uint32_t          dropped;   ///< number of samples dropped (histogram full)
+  volatile uint32_t           enable;   ///< sampling enabled (1) or stopped (0)
+  uint32_t                  reserved;   ///< reserved (0)
+} ARM_PC_Sample_Header_t;
+
+/// Initialize the histogram buffer.
+/// \param[in]     mem           histogram buffer memory (4-byte aligned).
+/// \param[in]     size          size of the histogram buffer memory in bytes.
+/// \return number of histogram entries or 0 in case of error.
+uint32_t ARM_PC_Sample_Init (void *mem, uint32_t size);
+
+/// Start sampling.
+/// \param[in]     period        sampling period in cycles (PMU cycle counter overflow on Armv8.1-M) or
+///                              0 when the samples are taken by an external source (for example a timer interrupt).
+/// \return execution status (1: success, 0: error)
+uint32_t ARM_PC_Sample_Start (uint32_t period);
+
+/// Stop sampling.
+void ARM_PC_Sample_Stop (void);
+
+/// Clear the histogram.
+void ARM_PC_Sample_Reset (void);
+
+/// Record a sample.
+/// \param[in]     pc            sampled PC.
+/// \param[in]     lr            LR of the sampled context.
+void ARM_PC_Sample_Record (uint32_t pc, uint32_t lr);
+
+/// Record the context interrupted by the current exception.
+/// \param[in]     frame         exception stack frame (MSP or PSP at exception entry, selected by EXC_RETURN bit 2).
+void ARM_PC_Sample_Frame (const uint32_t *frame);
+
+/// Handle the PMU cycle counter overflow (call from DebugMon_Handler with the exception stack frame).
+/// \param[in]     frame         exception stack frame (MSP or PSP at exception entry, selected by EXC_RETURN bit 2).
+/// \return 1 when a sample was taken, 0 when the DebugMonitor exception has a different cause.
+uint32_t ARM_PC_Sample_Overflow (const uint32_t *frame);
+
+/// Get the histogram buffer.
+/// \param[out]    size          pointer to buffer for the size of the histogram buffer in bytes (may be NULL).
+/// \return histogram buffer header followed by the histogram entries or NULL when not initialized.
+const ARM_PC_Sample_Header_t *ARM_PC_Sample_GetBuffer (uint32_t *size);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // PC_SAMPLE_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * CMSIS Core(M) Region based profiling for Armv8.1-M PMU
+ */
+
+#if   defined ( __ICCARM__ )
+  #pragma system_include         /* treat file as system include file for MISRA check */
+#elif defined (__clang__)
+  #pragma clang system_header   /* treat file as system include file */
+#endif
+
+#ifndef PMU_PROFILE_H
+#define PMU_PROFILE_H
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// \details Maximum number of events in the event set (events are time-multiplexed when
+///          the event set is larger than the number of counter pairs of the PMU).
+#ifndef ARM_PMU_PROFILE_EVENTS
+#define ARM_PMU_PROFILE_EVENTS      8U
+#endif
+
+/// \details Maximum number of named regions.
+#ifndef ARM_PMU_PROFILE_REGIONS
+#define ARM_PMU_PROFILE_REGIONS     16U
+#endif
+
+/// \details Maximum nesting depth of active regions.
+#ifndef ARM_PMU_PROFILE_DEPTH
+#define ARM_PMU_PROFILE_DEPTH       8U
+#endif
+
+/// \details Invalid region identifier (returned by \ref ARM_PMU_Profile_Region when no region is available).
+#define ARM_PMU_PROFILE_INVALID     0xFFFFFFFFU
+
+/// \details Derived metric is not available (required events are not in the event set or were not counted).
+#define ARM_PMU_PROFILE_NA          0xFFFFFFFFU
+
+/// \details Statistics of a region.
+typedef struct {
+  const char *name;                             ///< Region name
+  uint32_t    calls;                            ///< Number of completed Begin/End pairs
+  uint32_t    reserved;
+  uint64_t    cycles;                           ///< Cycles spent in the region (including nested regions)
+  uint64_t    count[ARM_PMU_PROFILE_EVENTS];    ///< Event counts (scaled when events are time-multiplexed)
+} ARM_PMU_Profile_Info_t;
+
+/// \details Derived metrics of a region (ratios in 1/1000 units or \ref ARM_PMU_PROFILE_NA).
+typedef struct {
+  uint64_t cycles;                              ///< Cycles spent in the region
+  uint64_t instructions;                        ///< Instructions retired (scaled)
+  uint32_t ipc;                                 ///< Instructions per cycle * 1000
+  uint32_t l1d_miss_rate;                       ///< L1 D-Cache refills per 1000 L1 D-Cache accesses
+  uint32_t stall_frontend;                      ///< Frontend stall cycles per 1000 cycles
+  uint32_t stall_backend;                       ///< Backend stall cycles per 1000 cycles
+} ARM_PMU_Profile_Metrics_t;
+
+/// Initialize the profiler, configure the event set and start the PMU counters.
+/// \param[in]  events          array of PMU event numbers (ARM_PMU_...) or NULL for the default event set
+///                             (instructions, L1 D-Cache accesses and refills, frontend and backend stalls).
+/// \param[in]  num             number of events (up to \ref ARM_PMU_PROFILE_EVENTS).
+/// \return execution status (1: success, 0: error)
+uint32_t ARM_PMU_Profile_Init (const uint16_t *events, uint32_t num);
+
+/// Clear the statistics of all regions.
+void ARM_PMU_Profile_Reset (void);
+
+/// Get the identifier of a named region (the region is created on first use).
+/// \param[in]  name            region name (string must remain valid).
+/// \return region identifier or \ref ARM_PMU_PROFILE_INVALID
+uint32_t ARM_PMU_Profile_Region (const char *name);
+
+/// Begin a region (regions can be nested).
+/// \param[in]  id              region identifier.
+/// \return execution status (1: success, 0: error)
+uint32_t ARM_PMU_Profile_Begin (uint32_t id);
+
+/// End the innermost active region.
+/// \param[in]  id              region identifier (must match the last \ref ARM_PMU_Profile_Begin).
+/// \return execution status (1: success, 0: error)
+uint32_t ARM_PMU_Profile_End (uint32_t id);
+
+/// Switch to the next group of time-multiplexed events (call periodically, for example from a timer interrupt).
+void ARM_PMU_Profile_Rotate (void);
+
+/// Extend the hardware counters to 64 bits (call from DebugMon_Handler or at least every 2^32 cycles).
+void ARM_PMU_Profile_Update (void);
+
+/// Read the 64-bit cycle counter.
+/// \return cycle count
+uint64_t ARM_PMU_Profile_GetCycles (void);
+
+/// Get the statistics of a region.
+/// \param[in]  id              region identifier.
+/// \param[out] info            region statistics (event counts in the order of the event set).
+/// \return execution status (1: success, 0: error)
+uint32_t ARM_PMU_Profile_GetInfo (uint32_t id, ARM_PMU_Profile_Info_t *info);
+
+/// Get the derived metrics of a region.
+/// \param[in]  id              region identifier.
+/// \param[out] metrics         derived metrics.
+/// \return execution status (1: success, 0: error)
+uint32_t ARM_PMU_Profile_GetMetrics (uint32_t id, ARM_PMU_Profile_Metrics_t *metrics);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // PMU_PROFILE_H
@@ -0,0 +1,35 @@
+/**************************************************************************//**
+ * @file     cmsis_perf.c
+ * @brief    CMSIS-Core cycle counter extension state (cmsis_perf.h)
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_perf.h"
+
+#if (CMSIS_PERF_BACKEND != CMSIS_PERF_BACKEND_NONE)
+
+// 64-bit extension of the 32-bit cycle counter, shared by all users of perf_cycles64
+perf_cycles_ext_t perf_cycles_ext;
+
+#endif
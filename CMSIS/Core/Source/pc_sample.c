@@ -0,0 +1,230 @@
+/**************************************************************************//**
+ * @file     pc_sample.c
+ * @brief    Statistical PC sampling profiler implementation
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "pc_sample.h"
+
+// The histogram is a hash table of PC and caller pairs with linear probing.
+// Entries are never removed, a sample is dropped when all probed entries are
+// used by other pairs.
+
+// Offsets in the exception stack frame (words)
+#define FRAME_LR            5U
+#define FRAME_PC            6U
+
+static ARM_PC_Sample_Header_t *Header;
+static ARM_PC_Sample_Entry_t  *Entry;
+static uint32_t                EntryShift;      // 32 - log2(number of entries)
+
+
+// Critical section (PRIMASK also masks the DebugMonitor exception)
+static uint32_t Lock (void) {
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  return primask;
+}
+
+static void Unlock (uint32_t primask) {
+  __set_PRIMASK(primask);
+}
+
+// Hash of a PC and caller pair (index of the first probed entry).
+static uint32_t Hash (uint32_t pc, uint32_t lr) {
+  return (((pc ^ (lr << 7) ^ (lr >> 9)) * 0x9E3779B1U) >> EntryShift);
+}
+
+// Initialize the histogram buffer.
+uint32_t ARM_PC_Sample_Init (void *mem, uint32_t size) {
+  uint32_t count;
+
+  if ((mem == NULL) || (((uint32_t)mem & 3U) != 0U) ||
+      (size < (sizeof(ARM_PC_Sample_Header_t) + (2U * sizeof(ARM_PC_Sample_Entry_t))))) {
+    return 0U;
+  }
+
+  // Largest power of 2 number of entries that fits into the memory
+  count = (size - sizeof(ARM_PC_Sample_Header_t)) / sizeof(ARM_PC_Sample_Entry_t);
+  for (EntryShift = 32U; (count >> (33U - EntryShift)) != 0U; EntryShift--) {}
+  count = 1UL << (32U - EntryShift);
+
+  Header = NULL;
+  memset(mem, 0, sizeof(ARM_PC_Sample_Header_t) + (count * sizeof(ARM_PC_Sample_Entry_t)));
+  Entry = (ARM_PC_Sample_Entry_t *)((uint8_t *)mem + sizeof(ARM_PC_Sample_Header_t));
+
+  Header = (ARM_PC_Sample_Header_t *)mem;
+  Header->version    = ARM_PC_SAMPLE_VERSION;
+  Header->entry_size = (uint16_t)sizeof(ARM_PC_Sample_Entry_t);
+  Header->count      = count;
+  Header->magic      = ARM_PC_SAMPLE_MAGIC;
+
+  return count;
+}
+
+// Start sampling.
+uint32_t ARM_PC_Sample_Start (uint32_t period) {
+
+  if (Header == NULL) {
+    return 0U;
+  }
+
+  if (period != 0U) {
+#if defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+    // Sample on cycle counter overflow (DebugMonitor exception)
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk | DCB_DEMCR_MON_EN_Msk;
+    ARM_PMU_Enable();
+    ARM_PMU_CNTR_Disable(PMU_CNTENCLR_CCNTR_ENABLE_Msk);
+    PMU->CCNTR = 0U - period;
+    ARM_PMU_Set_CNTR_OVS(PMU_OVSCLR_CYCCNT_STATUS_Msk);
+    ARM_PMU_Set_CNTR_IRQ_Enable(PMU_INTENSET_CCYCNT_ENABLE_Msk);
+#else
+    return 0U;
+#endif
+  }
+
+  Header->period = period;
+  Header->enable = 1U;
+
+#if defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+  if (period != 0U) {
+    ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+  }
+#endif
+
+  return 1U;
+}
+
+// Stop sampling.
+void ARM_PC_Sample_Stop (void) {
+
+  if (Header == NULL) {
+    return;
+  }
+
+  Header->enable = 0U;
+
+#if defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+  if (Header->period != 0U) {
+    ARM_PMU_Set_CNTR_IRQ_Disable(PMU_INTENCLR_CYCCNT_ENABLE_Msk);
+    ARM_PMU_Set_CNTR_OVS(PMU_OVSCLR_CYCCNT_STATUS_Msk);
+  }
+#endif
+}
+
+// Clear the histogram.
+void ARM_PC_Sample_Reset (void) {
+  uint32_t primask;
+
+  if (Header == NULL) {
+    return;
+  }
+
+  primask = Lock();
+  memset(Entry, 0, Header->count * sizeof(ARM_PC_Sample_Entry_t));
+  Header->samples = 0U;
+  Header->dropped = 0U;
+  Unlock(primask);
+}
+
+// Record a sample.
+void ARM_PC_Sample_Record (uint32_t pc, uint32_t lr) {
+  ARM_PC_Sample_Entry_t *e;
+  uint32_t primask;
+  uint32_t index;
+  uint32_t n;
+
+  if ((Header == NULL) || (Header->enable == 0U)) {
+    return;
+  }
+
+  pc &= ~1U;
+  lr &= ~1U;
+  if (pc == 0U) {
+    return;
+  }
+
+  primask = Lock();
+  index = Hash(pc, lr);
+  for (n = 0U; n < ARM_PC_SAMPLE_PROBE; n++) {
+    e = &Entry[(index + n) & (Header->count - 1U)];
+    if (e->pc == 0U) {
+      e->pc = pc;
+      e->lr = lr;
+    }
+    if ((e->pc == pc) && (e->lr == lr)) {
+      e->count++;
+      Header->samples++;
+      break;
+    }
+  }
+  if (n == ARM_PC_SAMPLE_PROBE) {
+    Header->dropped++;
+  }
+  Unlock(primask);
+}
+
+// Record the context interrupted by the current exception.
+void ARM_PC_Sample_Frame (const uint32_t *frame) {
+
+  if (frame == NULL) {
+    return;
+  }
+  ARM_PC_Sample_Record(frame[FRAME_PC], frame[FRAME_LR]);
+}
+
+// Handle the PMU cycle counter overflow.
+uint32_t ARM_PC_Sample_Overflow (const uint32_t *frame) {
+#if defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+
+  if ((Header == NULL) || (Header->period == 0U) ||
+      ((ARM_PMU_Get_CNTR_OVS() & PMU_OVSSET_CYCCNT_STATUS_Msk) == 0U)) {
+    return 0U;
+  }
+
+  // Reload the cycle counter for the next sampling period
+  PMU->CCNTR = 0U - Header->period;
+  ARM_PMU_Set_CNTR_OVS(PMU_OVSCLR_CYCCNT_STATUS_Msk);
+
+  ARM_PC_Sample_Frame(frame);
+
+  return 1U;
+#else
+  (void)frame;
+  return 0U;
+#endif
+}
+
+// Get the histogram buffer.
+const ARM_PC_Sample_Header_t *ARM_PC_Sample_GetBuffer (uint32_t *size) {
+
+  if ((size != NULL) && (Header != NULL)) {
+    *size = sizeof(ARM_PC_Sample_Header_t) + (Header->count * sizeof(ARM_PC_Sample_Entry_t));
+  }
+  return Header;
+}
@@ -0,0 +1,509 @@
+/**************************************************************************//**
+ * @file     pmu_profile.c
+ * @brief    Region based profiling implementation for Armv8.1-M PMU
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_perf.h"
+#include "pmu_profile.h"
+
+#if defined(__PMU_PRESENT) && (__PMU_PRESENT == 1U)
+
+// The 16-bit event counters are used in pairs: the even counter counts the
+// event and the odd counter counts the overflows of the even counter (CHAIN).
+// The overflow of the odd counter extends the 32-bit pair to 64 bits.
+// The cycle counter is extended by perf_cycles64 (cmsis_perf.h).
+
+#define COUNTER_NUM         (__PMU_NUM_EVENTCNT / 2U)           // Number of counter pairs
+#define COUNTER_MSK         ((1UL << (COUNTER_NUM * 2U)) - 1U)  // Event counters used
+#define COUNTER_OVF_MSK     (COUNTER_MSK & 0xAAAAAAAAU)         // Odd counters (overflow of a pair)
+
+#if (COUNTER_NUM == 0U)
+#error "PMU profiling requires at least two event counters!"
+#endif
+
+// Region statistics
+typedef struct {
+  const char *name;                             // Region name
+  uint32_t    calls;                            // Completed Begin/End pairs
+  uint64_t    cycles;                           // Cycles
+  uint64_t    count[ARM_PMU_PROFILE_EVENTS];    // Event counts (while counted)
+  uint64_t    run[ARM_PMU_PROFILE_EVENTS];      // Cycles while the event was counted
+} region_t;
+
+// Counter snapshot at region begin
+typedef struct {
+  uint32_t    id;                               // Region identifier
+  uint64_t    cycles;
+  uint64_t    count[ARM_PMU_PROFILE_EVENTS];
+  uint64_t    run[ARM_PMU_PROFILE_EVENTS];
+} frame_t;
+
+// Default event set
+static const uint16_t EventDefault[] = {
+  ARM_PMU_INST_RETIRED,
+  ARM_PMU_L1D_CACHE,
+  ARM_PMU_L1D_CACHE_REFILL,
+  ARM_PMU_STALL_FRONTEND,
+  ARM_PMU_STALL_BACKEND
+};
+
+// Event set and multiplexing
+static uint16_t EventType[ARM_PMU_PROFILE_EVENTS];
+static uint32_t EventNum;
+static uint32_t GroupNum;                       // Number of event groups
+static uint32_t GroupActive;                    // Group assigned to the counters
+static uint64_t GroupStart;                     // Cycle count when the active group was assigned
+
+// Accumulated counts and running cycles of the previously active periods
+static uint64_t EventBase[ARM_PMU_PROFILE_EVENTS];
+static uint64_t EventRun [ARM_PMU_PROFILE_EVENTS];
+
+// 64-bit extension of the counter pairs
+static uint32_t CounterHigh[COUNTER_NUM];
+
+// Regions and nesting stack
+static region_t Region[ARM_PMU_PROFILE_REGIONS];
+static uint32_t RegionNum;
+static frame_t  Stack[ARM_PMU_PROFILE_DEPTH];
+static uint32_t StackDepth;
+
+
+// Critical section (PRIMASK also masks the DebugMonitor exception)
+static uint32_t Lock (void) {
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  return primask;
+}
+
+static void Unlock (uint32_t primask) {
+  __set_PRIMASK(primask);
+}
+
+// Account pending counter overflows (called with interrupts disabled).
+static void OverflowUpdate (void) {
+  uint32_t ovs;
+  uint32_t n;
+
+  ovs = ARM_PMU_Get_CNTR_OVS() & (PMU_OVSSET_CYCCNT_STATUS_Msk | COUNTER_MSK);
+  if ((ovs & PMU_OVSSET_CYCCNT_STATUS_Msk) != 0U) {
+    // Record the wrap in the shared extension of the cycle counter
+    (void)perf_cycles64();
+  }
+  for (n = 0U; n < COUNTER_NUM; n++) {
+    if ((ovs & (1UL << ((n * 2U) + 1U))) != 0U) {
+      CounterHigh[n]++;
+    }
+  }
+  ARM_PMU_Set_CNTR_OVS(ovs);
+}
+
+// Read the 64-bit cycle counter (called with interrupts disabled).
+static uint64_t CyclesRead (void) {
+  return perf_cycles64();
+}
+
+// Read a 32-bit counter pair.
+static uint32_t PairRead (uint32_t n) {
+  uint32_t high, low;
+
+  do {
+    high = ARM_PMU_Get_EVCNTR((n * 2U) + 1U);
+    low  = ARM_PMU_Get_EVCNTR( n * 2U);
+  } while (high != ARM_PMU_Get_EVCNTR((n * 2U) + 1U));
+
+  return ((high << 16) | low);
+}
+
+// Read the 64-bit value of a counter pair (called with interrupts disabled).
+static uint64_t CounterRead (uint32_t n) {
+  uint32_t low = PairRead(n);
+
+  if ((ARM_PMU_Get_CNTR_OVS() & (1UL << ((n * 2U) + 1U))) != 0U) {
+    OverflowUpdate();
+    low = PairRead(n);
+  }
+  return (((uint64_t)CounterHigh[n] << 32) | low);
+}
+
+// Event count since initialization (called with interrupts disabled).
+static uint64_t EventRead (uint32_t e) {
+  uint64_t count = EventBase[e];
+
+  if ((e / COUNTER_NUM) == GroupActive) {
+    count += CounterRead(e % COUNTER_NUM);
+  }
+  return count;
+}
+
+// Cycles while the event was counted (called with interrupts disabled).
+static uint64_t EventRunRead (uint32_t e, uint64_t cycles) {
+  uint64_t run = EventRun[e];
+
+  if ((e / COUNTER_NUM) == GroupActive) {
+    run += cycles - GroupStart;
+  }
+  return run;
+}
+
+// Assign an event group to the counters (called with interrupts disabled).
+static void GroupSetup (uint32_t group) {
+  uint32_t mask = 0U;
+  uint32_t e;
+  uint32_t n;
+
+  ARM_PMU_CNTR_Disable(COUNTER_MSK);
+  for (n = 0U; n < COUNTER_NUM; n++) {
+    e = (group * COUNTER_NUM) + n;
+    if (e < EventNum) {
+      ARM_PMU_Set_EVTYPER( n * 2U,        EventType[e]);
+      ARM_PMU_Set_EVTYPER((n * 2U) + 1U,  ARM_PMU_CHAIN);
+      mask |= 3UL << (n * 2U);
+    }
+    CounterHigh[n] = 0U;
+  }
+  ARM_PMU_EVCNTR_ALL_Reset();
+  ARM_PMU_Set_CNTR_OVS(COUNTER_MSK);
+
+  GroupActive = group;
+  GroupStart  = CyclesRead();
+  ARM_PMU_CNTR_Enable(mask);
+}
+
+// Scale a count measured during run cycles to the total cycles.
+static uint64_t Scale (uint64_t count, uint64_t run, uint64_t cycles) {
+
+  if (run == cycles) {
+    return count;
+  }
+  while ((cycles > 0xFFFFFFFFU) || (run > 0xFFFFFFFFU)) {
+    cycles >>= 1;
+    run    >>= 1;
+  }
+  if (run == 0U) {
+    return 0U;
+  }
+  return (((count / run) * cycles) + (((count % run) * cycles) / run));
+}
+
+// Ratio a/b in 1/1000 units.
+static uint32_t Ratio (uint64_t a, uint64_t b) {
+  uint64_t r;
+
+  while (a > 0x003FFFFFFFFFFFFFU) {
+    a >>= 1;
+    b >>= 1;
+  }
+  if (b == 0U) {
+    return ARM_PMU_PROFILE_NA;
+  }
+  r = (a * 1000U) / b;
+  return ((r < ARM_PMU_PROFILE_NA) ? (uint32_t)r : (ARM_PMU_PROFILE_NA - 1U));
+}
+
+// Index of an event in the event set or ARM_PMU_PROFILE_EVENTS.
+static uint32_t EventFind (uint16_t type) {
+  uint32_t e;
+
+  for (e = 0U; e < EventNum; e++) {
+    if (EventType[e] == type) {
+      break;
+    }
+  }
+  return ((e < EventNum) ? e : ARM_PMU_PROFILE_EVENTS);
+}
+
+// Scaled count of an event in a region (ARM_PMU_PROFILE_NA when not counted).
+static uint64_t RegionCount (const region_t *r, uint32_t e, uint32_t *valid) {
+
+  if ((e >= EventNum) || (r->run[e] == 0U)) {
+    *valid = 0U;
+    return 0U;
+  }
+  return Scale(r->count[e], r->run[e], r->cycles);
+}
+
+
+/// Initialize the profiler, configure the event set and start the PMU counters.
+uint32_t ARM_PMU_Profile_Init (const uint16_t *events, uint32_t num) {
+  uint32_t primask;
+  uint32_t e;
+
+  if (events == NULL) {
+    events = EventDefault;
+    num    = sizeof(EventDefault) / sizeof(EventDefault[0]);
+  }
+  if ((num == 0U) || (num > ARM_PMU_PROFILE_EVENTS)) {
+    return 0U;    // Invalid event set
+  }
+
+  primask = Lock();
+
+  for (e = 0U; e < num; e++) {
+    EventType[e] = events[e];
+    EventBase[e] = 0U;
+    EventRun[e]  = 0U;
+  }
+  EventNum   = num;
+  GroupNum   = (num + (COUNTER_NUM - 1U)) / COUNTER_NUM;
+  StackDepth = 0U;
+
+  // Cycle counter is free running (shared with other users), its overflow
+  // interrupt keeps the extension of perf_cycles64 up to date
+  (void)perf_init();
+  ARM_PMU_Set_CNTR_IRQ_Enable(PMU_INTENSET_CCYCNT_ENABLE_Msk | COUNTER_OVF_MSK);
+
+  GroupSetup(0U);
+
+  Unlock(primask);
+
+  ARM_PMU_Profile_Reset();
+
+  return 1U;
+}
+
+/// Clear the statistics of all regions.
+void ARM_PMU_Profile_Reset (void) {
+  uint32_t primask;
+  uint32_t id;
+
+  primask = Lock();
+  for (id = 0U; id < RegionNum; id++) {
+    Region[id].calls  = 0U;
+    Region[id].cycles = 0U;
+    memset(Region[id].count, 0, sizeof(Region[id].count));
+    memset(Region[id].run,   0, sizeof(Region[id].run));
+  }
+  Unlock(primask);
+}
+
+/// Get the identifier of a named region (the region is created on first use).
+uint32_t ARM_PMU_Profile_Region (const char *name) {
+  uint32_t primask;
+  uint32_t id;
+
+  if (name == NULL) {
+    return ARM_PMU_PROFILE_INVALID;
+  }
+
+  primask = Lock();
+  for (id = 0U; id < RegionNum; id++) {
+    if ((Region[id].name == name) || (strcmp(Region[id].name, name) == 0)) {
+      break;
+    }
+  }
+  if (id == RegionNum) {
+    if (RegionNum < ARM_PMU_PROFILE_REGIONS) {
+      memset(&Region[id], 0, sizeof(Region[id]));
+      Region[id].name = name;
+      RegionNum++;
+    } else {
+      id = ARM_PMU_PROFILE_INVALID;
+    }
+  }
+  Unlock(primask);
+
+  return id;
+}
+
+/// Begin a region (regions can be nested).
+uint32_t ARM_PMU_Profile_Begin (uint32_t id) {
+  frame_t *frame;
+  uint32_t primask;
+  uint32_t e;
+
+  primask = Lock();
+
+  if ((id >= RegionNum) || (StackDepth >= ARM_PMU_PROFILE_DEPTH)) {
+    Unlock(primask);
+    return 0U;
+  }
+
+  frame = &Stack[StackDepth];
+  frame->id     = id;
+  frame->cycles = CyclesRead();
+  for (e = 0U; e < EventNum; e++) {
+    frame->count[e] = EventRead(e);
+    frame->run[e]   = EventRunRead(e, frame->cycles);
+  }
+  StackDepth++;
+
+  Unlock(primask);
+
+  return 1U;
+}
+
+/// End the innermost active region.
+uint32_t ARM_PMU_Profile_End (uint32_t id) {
+  const frame_t *frame;
+  region_t      *region;
+  uint64_t       cycles;
+  uint32_t       primask;
+  uint32_t       e;
+
+  primask = Lock();
+
+  cycles = CyclesRead();
+
+  if ((StackDepth == 0U) || (Stack[StackDepth - 1U].id != id)) {
+    Unlock(primask);
+    return 0U;    // Region is not the innermost active region
+  }
+
+  frame  = &Stack[StackDepth - 1U];
+  region = &Region[id];
+  region->calls++;
+  region->cycles += cycles - frame->cycles;
+  for (e = 0U; e < EventNum; e++) {
+    region->count[e] += EventRead(e) - frame->count[e];
+    region->run[e]   += EventRunRead(e, cycles) - frame->run[e];
+  }
+  StackDepth--;
+
+  Unlock(primask);
+
+  return 1U;
+}
+
+/// Switch to the next group of time-multiplexed events.
+void ARM_PMU_Profile_Rotate (void) {
+  uint64_t cycles;
+  uint32_t primask;
+  uint32_t e;
+
+  if (GroupNum <= 1U) {
+    return;       // All events are counted
+  }
+
+  primask = Lock();
+
+  cycles = CyclesRead();
+  for (e = GroupActive * COUNTER_NUM; (e < EventNum) && ((e / COUNTER_NUM) == GroupActive); e++) {
+    EventBase[e] += CounterRead(e % COUNTER_NUM);
+    EventRun[e]  += cycles - GroupStart;
+  }
+  GroupSetup((GroupActive + 1U) % GroupNum);
+
+  Unlock(primask);
+}
+
+/// Extend the hardware counters to 64 bits.
+void ARM_PMU_Profile_Update (void) {
+  uint32_t primask;
+
+  primask = Lock();
+  OverflowUpdate();
+  Unlock(primask);
+}
+
+/// Read the 64-bit cycle counter.
+uint64_t ARM_PMU_Profile_GetCycles (void) {
+  uint64_t cycles;
+  uint32_t primask;
+
+  primask = Lock();
+  cycles  = CyclesRead();
+  Unlock(primask);
+
+  return cycles;
+}
+
+/// Get the statistics of a region.
+uint32_t ARM_PMU_Profile_GetInfo (uint32_t id, ARM_PMU_Profile_Info_t *info) {
+  region_t region;
+  uint32_t primask;
+  uint32_t valid;
+  uint32_t e;
+
+  if ((id >= RegionNum) || (info == NULL)) {
+    return 0U;
+  }
+
+  primask = Lock();
+  memcpy(&region, &Region[id], sizeof(region));
+  Unlock(primask);
+
+  info->name     = region.name;
+  info->calls    = region.calls;
+  info->reserved = 0U;
+  info->cycles   = region.cycles;
+  for (e = 0U; e < ARM_PMU_PROFILE_EVENTS; e++) {
+    info->count[e] = RegionCount(&region, e, &valid);
+  }
+
+  return 1U;
+}
+
+/// Get the derived metrics of a region.
+uint32_t ARM_PMU_Profile_GetMetrics (uint32_t id, ARM_PMU_Profile_Metrics_t *metrics) {
+  region_t region;
+  uint64_t access, refill;
+  uint64_t count;
+  uint32_t primask;
+  uint32_t valid;
+
+  if ((id >= RegionNum) || (metrics == NULL)) {
+    return 0U;
+  }
+
+  primask = Lock();
+  memcpy(&region, &Region[id], sizeof(region));
+  Unlock(primask);
+
+  metrics->cycles = region.cycles;
+
+  // Instructions per cycle
+  valid = 1U;
+  count = RegionCount(&region, EventFind(ARM_PMU_INST_RETIRED), &valid);
+  metrics->instructions = count;
+  metrics->ipc = (valid != 0U) ? Ratio(count, region.cycles) : ARM_PMU_PROFILE_NA;
+
+  // L1 D-Cache miss rate (all accesses or reads only)
+  valid  = 1U;
+  access = RegionCount(&region, EventFind(ARM_PMU_L1D_CACHE),        &valid);
+  refill = RegionCount(&region, EventFind(ARM_PMU_L1D_CACHE_REFILL), &valid);
+  if (valid == 0U) {
+    valid  = 1U;
+    access = RegionCount(&region, EventFind(ARM_PMU_L1D_CACHE_RD),      &valid);
+    refill = RegionCount(&region, EventFind(ARM_PMU_L1D_CACHE_MISS_RD), &valid);
+  }
+  metrics->l1d_miss_rate = (valid != 0U) ? Ratio(refill, access) : ARM_PMU_PROFILE_NA;
+
+  // Frontend and backend stall cycles per cycle
+  valid = 1U;
+  count = RegionCount(&region, EventFind(ARM_PMU_STALL_FRONTEND), &valid);
+  metrics->stall_frontend = (valid != 0U) ? Ratio(count, region.cycles) : ARM_PMU_PROFILE_NA;
+
+  valid = 1U;
+  count = RegionCount(&region, EventFind(ARM_PMU_STALL_BACKEND), &valid);
+  metrics->stall_backend = (valid != 0U) ? Ratio(count, region.cycles) : ARM_PMU_PROFILE_NA;
+
+  return 1U;
+}
+
+#endif  /* __PMU_PRESENT */
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * @file     tz_batch.c
+ * @brief    Batched secure gateway for Armv8-M TrustZone - Sample implementation
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Use CMSE intrinsics */
+#include <arm_cmse.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "tz_batch.h"
+
+/// Maximum number of descriptors of a ring
+#ifndef TZ_BATCH_COUNT_MAX
+#define TZ_BATCH_COUNT_MAX         256U
+#endif
+
+/// Request handlers indexed by the function code (defined by the secure application)
+extern const TZ_Batch_Handler_t TZ_Batch_HandlerTable[];
+extern const uint32_t           TZ_Batch_HandlerCount;
+
+
+/// Process the submitted requests of a descriptor ring (secure gateway)
+/// \param[in]  ring  descriptor ring in non-secure memory.
+/// \return number of processed requests
+__attribute__((cmse_nonsecure_entry))
+uint32_t TZ_Batch_Process_S (TZ_Batch_Ring_t *ring) {
+  TZ_Batch_Ring_t    *r;
+  TZ_Batch_Request_t *req;
+  uint32_t            arg[TZ_BATCH_ARGS];
+  uint32_t            flags;
+  uint32_t            count, mask;
+  uint32_t            head, tail;
+  uint32_t            func;
+  uint32_t            n, k;
+
+  // Ring must be accessible by the non-secure caller
+  flags = CMSE_NONSECURE | CMSE_MPU_READWRITE;
+  if ((__TZ_get_CONTROL_NS() & 1U) != 0U) {
+    flags |= CMSE_MPU_UNPRIV;
+  }
+  r = (TZ_Batch_Ring_t *)cmse_check_address_range(ring, sizeof(TZ_Batch_Ring_t), (int)flags);
+  if (r == NULL) {
+    return 0U;  // Invalid ring
+  }
+
+  count = r->count;
+  if ((count == 0U) || (count > TZ_BATCH_COUNT_MAX) || ((count & (count - 1U)) != 0U)) {
+    return 0U;  // Invalid number of descriptors
+  }
+  req = (TZ_Batch_Request_t *)cmse_check_address_range(r + 1, count * sizeof(TZ_Batch_Request_t), (int)flags);
+  if (req == NULL) {
+    return 0U;  // Invalid descriptors
+  }
+
+  head = r->head;
+  tail = r->tail;
+  if ((head - tail) > count) {
+    return 0U;  // Invalid ring state
+  }
+  mask = count - 1U;
+
+  for (n = 0U; tail != head; tail++, n++) {
+    // Non-secure side may modify the descriptor: handlers use a copy
+    func = req[tail & mask].func;
+    for (k = 0U; k < TZ_BATCH_ARGS; k++) {
+      arg[k] = req[tail & mask].arg[k];
+    }
+    if (func < TZ_Batch_HandlerCount) {
+      req[tail & mask].result = TZ_Batch_HandlerTable[func](arg);
+    } else {
+      req[tail & mask].result = TZ_BATCH_INVALID;
+    }
+  }
+  r->tail = tail;
+
+  return n;
+}
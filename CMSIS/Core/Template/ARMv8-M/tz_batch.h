@@ -0,0 +1,126 @@
+/******************************************************************************
+ * @file     tz_batch.h
+ * @brief    Batched secure gateway for Armv8-M TrustZone - Sample implementation
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TZ_BATCH_H
+#define TZ_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// Number of arguments of a request
+#define TZ_BATCH_ARGS               6U
+
+/// Result of a request with an invalid function code
+#define TZ_BATCH_INVALID            (-1)
+
+/// Request descriptor (32 bytes).
+typedef struct {
+  uint32_t func;                        ///< function code (index of the secure handler)
+  int32_t  result;                      ///< result (written by the secure handler)
+  uint32_t arg[TZ_BATCH_ARGS];          ///< arguments
+} TZ_Batch_Request_t;
+
+/// Descriptor ring header (16 bytes), followed by the request descriptors in non-secure memory.
+typedef struct {
+  uint32_t          count;              ///< number of descriptors (power of 2)
+  volatile uint32_t head;               ///< number of requests submitted (written by non-secure side)
+  volatile uint32_t tail;               ///< number of requests processed (written by secure side)
+  uint32_t          reserved;           ///< reserved (0)
+} TZ_Batch_Ring_t;
+
+/// Size of the descriptor ring memory in bytes for \em count descriptors
+#define TZ_BATCH_RING_SIZE(count)   (sizeof(TZ_Batch_Ring_t) + ((count) * sizeof(TZ_Batch_Request_t)))
+
+/// Secure request handler
+/// \param[in]  arg  request arguments (copied to secure memory).
+/// \return request result
+typedef int32_t (*TZ_Batch_Handler_t) (const uint32_t *arg);
+
+
+/// Process the submitted requests of a descriptor ring (secure gateway)
+/// \param[in]  ring  descriptor ring in non-secure memory.
+/// \return number of processed requests
+uint32_t TZ_Batch_Process_S (TZ_Batch_Ring_t *ring);
+
+
+// ==== Non-secure side ====
+
+/// Initialize a descriptor ring
+/// \param[in]  ring   descriptor ring memory of \ref TZ_BATCH_RING_SIZE(count) bytes.
+/// \param[in]  count  number of descriptors (power of 2).
+static inline void TZ_Batch_Init (TZ_Batch_Ring_t *ring, uint32_t count) {
+  ring->count    = count;
+  ring->head     = 0U;
+  ring->tail     = 0U;
+  ring->reserved = 0U;
+}
+
+/// Get the next free request descriptor
+/// \param[in]  ring  descriptor ring.
+/// \return request descriptor or NULL when the ring is full
+static inline TZ_Batch_Request_t *TZ_Batch_Alloc (TZ_Batch_Ring_t *ring) {
+  uint32_t head = ring->head;
+
+  if ((head - ring->tail) >= ring->count) {
+    return NULL;
+  }
+  return &((TZ_Batch_Request_t *)(ring + 1))[head & (ring->count - 1U)];
+}
+
+/// Add a request (the descriptor returned by \ref TZ_Batch_Alloc is filled)
+/// \param[in]  ring  descriptor ring.
+static inline void TZ_Batch_Commit (TZ_Batch_Ring_t *ring) {
+  ring->head = ring->head + 1U;
+}
+
+/// Add a request with a function code and up to three arguments
+/// \param[in]  ring  descriptor ring.
+/// \param[in]  func  function code.
+/// \param[in]  arg0  argument 0.
+/// \param[in]  arg1  argument 1.
+/// \param[in]  arg2  argument 2.
+/// \return request descriptor (result after \ref TZ_Batch_Submit) or NULL when the ring is full
+static inline TZ_Batch_Request_t *TZ_Batch_Put (TZ_Batch_Ring_t *ring, uint32_t func,
+                                                uint32_t arg0, uint32_t arg1, uint32_t arg2) {
+  TZ_Batch_Request_t *req = TZ_Batch_Alloc(ring);
+
+  if (req != NULL) {
+    req->func   = func;
+    req->result = TZ_BATCH_INVALID;
+    req->arg[0] = arg0;
+    req->arg[1] = arg1;
+    req->arg[2] = arg2;
+    TZ_Batch_Commit(ring);
+  }
+  return req;
+}
+
+/// Process all added requests with one secure call
+/// \param[in]  ring  descriptor ring.
+/// \return number of processed requests
+static inline uint32_t TZ_Batch_Submit (TZ_Batch_Ring_t *ring) {
+  return TZ_Batch_Process_S(ring);
+}
+
+#endif  // TZ_BATCH_H
@@ -1,11 +1,11 @@
 /******************************************************************************
  * @file     tz_context.c
  * @brief    Context Management for Armv8-M TrustZone - Sample implementation
- * @version  V1.1.1
- * @date     10. January 2018
+ * @version  V1.2.0
+ * @date     17. October 2024
  ******************************************************************************/
 /*
- * Copyright (c) 2016-2018 Arm Limited. All rights reserved.
+ * Copyright (c) 2016-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include <stddef.h>
 #include "RTE_Components.h"
 #include CMSIS_device_header
 #include "tz_context.h"
@@ -31,20 +32,110 @@
 #define TZ_PROCESS_STACK_SLOTS     8U
 #endif
 
-/// Stack size of the secure library code
+/// Stack size of the secure library code (modules not listed in TZ_MODULE_STACK_TABLE)
 #ifndef TZ_PROCESS_STACK_SIZE
 #define TZ_PROCESS_STACK_SIZE      256U
 #endif
 
+/// Size of the secure stack memory shared by all process slots
+#ifndef TZ_PROCESS_STACK_MEMORY
+#define TZ_PROCESS_STACK_MEMORY    (TZ_PROCESS_STACK_SLOTS * TZ_PROCESS_STACK_SIZE)
+#endif
+
+/// Secure stack size of software modules: { module, stack size }, ...
+#ifndef TZ_MODULE_STACK_TABLE
+#define TZ_MODULE_STACK_TABLE      { 1U, TZ_PROCESS_STACK_SIZE }
+#endif
+
 typedef struct {
-  uint32_t sp_top;      // stack space top
+  TZ_ModuleId_t module; // module identifier
+  uint32_t stack_size;  // secure stack size in bytes
+} module_info_t;
+
+typedef struct {
+  uint32_t sp_top;      // stack space top (0: not allocated yet)
   uint32_t sp_limit;    // stack space limit
   uint32_t sp;          // current stack pointer
+  uint32_t size;        // stack size (0: inactive slot)
 } stack_info_t;
 
+typedef struct free_block_s {
+  struct free_block_s *next;  // next free block (ascending addresses)
+  uint32_t size;              // block size in bytes
+} free_block_t;
+
+static const module_info_t ModuleInfo[] = { TZ_MODULE_STACK_TABLE };
+
 static stack_info_t ProcessStackInfo  [TZ_PROCESS_STACK_SLOTS];
-static uint64_t     ProcessStackMemory[TZ_PROCESS_STACK_SLOTS][TZ_PROCESS_STACK_SIZE/8U];
-static uint32_t     ProcessStackFreeSlot = 0xFFFFFFFFU;
+static uint64_t     ProcessStackMemory[TZ_PROCESS_STACK_MEMORY/8U];
+static free_block_t *ProcessStackFree = NULL;
+
+
+/// Get secure stack size of a software module
+static uint32_t ModuleStackSize (TZ_ModuleId_t module) {
+  uint32_t size = TZ_PROCESS_STACK_SIZE;
+  uint32_t n;
+
+  for (n = 0U; n < (sizeof(ModuleInfo) / sizeof(ModuleInfo[0])); n++) {
+    if (ModuleInfo[n].module == module) {
+      size = ModuleInfo[n].stack_size;
+      break;
+    }
+  }
+  if (size < sizeof(free_block_t)) {
+    size = sizeof(free_block_t);
+  }
+  return ((size + 7U) & ~7U);
+}
+
+/// Allocate stack memory (first fit, size is updated with the allocated size)
+static uint32_t StackAlloc (uint32_t *size) {
+  free_block_t **link;
+  free_block_t  *block;
+  free_block_t  *rest;
+
+  for (link = &ProcessStackFree; *link != NULL; link = &(*link)->next) {
+    block = *link;
+    if (block->size >= *size) {
+      if ((block->size - *size) >= sizeof(free_block_t)) {
+        // Split: the rest of the block remains free
+        rest = (free_block_t *)((uint32_t)block + *size);
+        rest->next = block->next;
+        rest->size = block->size - *size;
+        *link = rest;
+      } else {
+        *size = block->size;
+        *link = block->next;
+      }
+      return ((uint32_t)block);
+    }
+  }
+  return 0U;    // No memory available
+}
+
+/// Free stack memory (merged with adjacent free blocks)
+static void StackFree (uint32_t addr, uint32_t size) {
+  free_block_t **link;
+  free_block_t  *block = (free_block_t *)addr;
+  free_block_t  *prev  = NULL;
+
+  // Insert block in address order
+  for (link = &ProcessStackFree; (*link != NULL) && ((uint32_t)*link < addr); link = &(*link)->next) {
+    prev = *link;
+  }
+  block->next = *link;
+  block->size = size;
+  *link = block;
+
+  if ((block->next != NULL) && ((addr + size) == (uint32_t)block->next)) {
+    block->size += block->next->size;
+    block->next  = block->next->next;
+  }
+  if ((prev != NULL) && (((uint32_t)prev + prev->size) == addr)) {
+    prev->size += block->size;
+    prev->next  = block->next;
+  }
+}
 
 
 /// Initialize secure context memory system
@@ -58,14 +149,16 @@ uint32_t TZ_InitContextSystem_S (void) {
   }
 
   for (n = 0U; n < TZ_PROCESS_STACK_SLOTS; n++) {
-    ProcessStackInfo[n].sp = 0U;
-    ProcessStackInfo[n].sp_limit = (uint32_t)&ProcessStackMemory[n];
-    ProcessStackInfo[n].sp_top   = (uint32_t)&ProcessStackMemory[n] + TZ_PROCESS_STACK_SIZE;
-    *((uint32_t *)ProcessStackMemory[n]) = n + 1U;
+    ProcessStackInfo[n].sp       = 0U;
+    ProcessStackInfo[n].sp_limit = 0U;
+    ProcessStackInfo[n].sp_top   = 0U;
+    ProcessStackInfo[n].size     = 0U;
   }
-  *((uint32_t *)ProcessStackMemory[--n]) = 0xFFFFFFFFU;
 
-  ProcessStackFreeSlot = 0U;
+  // Whole stack memory is free
+  ProcessStackFree = (free_block_t *)ProcessStackMemory;
+  ProcessStackFree->next = NULL;
+  ProcessStackFree->size = sizeof(ProcessStackMemory);
 
   // Default process stack pointer and stack limit
   __set_PSPLIM((uint32_t)ProcessStackMemory);
@@ -86,20 +179,23 @@ __attribute__((cmse_nonsecure_entry))
 TZ_MemoryId_t TZ_AllocModuleContext_S (TZ_ModuleId_t module) {
   uint32_t slot;
 
-  (void)module; // Ignore (fixed Stack size)
-
   if (__get_IPSR() == 0U) {
     return 0U;  // Thread Mode
   }
 
-  if (ProcessStackFreeSlot == 0xFFFFFFFFU) {
+  for (slot = 0U; slot < TZ_PROCESS_STACK_SLOTS; slot++) {
+    if (ProcessStackInfo[slot].size == 0U) {
+      break;
+    }
+  }
+  if (slot == TZ_PROCESS_STACK_SLOTS) {
     return 0U;  // No slot available
   }
 
-  slot = ProcessStackFreeSlot;
-  ProcessStackFreeSlot = *((uint32_t *)ProcessStackMemory[slot]);
-
-  ProcessStackInfo[slot].sp = ProcessStackInfo[slot].sp_top;
+  // Stack memory is allocated when the context is loaded the first time
+  ProcessStackInfo[slot].size   = ModuleStackSize(module);
+  ProcessStackInfo[slot].sp_top = 0U;
+  ProcessStackInfo[slot].sp     = 0U;
 
   return (slot + 1U);
 }
@@ -122,13 +218,16 @@ uint32_t TZ_FreeModuleContext_S (TZ_MemoryId_t id) {
 
   slot = id - 1U;
 
-  if (ProcessStackInfo[slot].sp == 0U) {
+  if (ProcessStackInfo[slot].size == 0U) {
     return 0U;  // Inactive slot
   }
-  ProcessStackInfo[slot].sp = 0U;
 
-  *((uint32_t *)ProcessStackMemory[slot]) = ProcessStackFreeSlot;
-  ProcessStackFreeSlot = slot;
+  if (ProcessStackInfo[slot].sp_top != 0U) {
+    StackFree(ProcessStackInfo[slot].sp_limit, ProcessStackInfo[slot].size);
+  }
+  ProcessStackInfo[slot].sp     = 0U;
+  ProcessStackInfo[slot].sp_top = 0U;
+  ProcessStackInfo[slot].size   = 0U;
 
   return 1U;    // Success
 }
@@ -140,6 +239,7 @@ uint32_t TZ_FreeModuleContext_S (TZ_MemoryId_t id) {
 __attribute__((cmse_nonsecure_entry))
 uint32_t TZ_LoadContext_S (TZ_MemoryId_t id) {
   uint32_t slot;
+  uint32_t addr;
 
   if ((__get_IPSR() == 0U) || ((__get_CONTROL() & 2U) == 0U)) {
     return 0U;  // Thread Mode or using Main Stack for threads
@@ -151,10 +251,24 @@ uint32_t TZ_LoadContext_S (TZ_MemoryId_t id) {
 
   slot = id - 1U;
 
-  if (ProcessStackInfo[slot].sp == 0U) {
+  if (ProcessStackInfo[slot].size == 0U) {
     return 0U;  // Inactive slot
   }
 
+  if (ProcessStackInfo[slot].sp_top == 0U) {
+    // First activation: allocate stack memory
+    addr = StackAlloc(&ProcessStackInfo[slot].size);
+    if (addr == 0U) {
+      // Secure calls fail on the default stack (stack limit)
+      __set_PSPLIM((uint32_t)ProcessStackMemory);
+      __set_PSP   ((uint32_t)ProcessStackMemory);
+      return 0U;  // No memory available
+    }
+    ProcessStackInfo[slot].sp_limit = addr;
+    ProcessStackInfo[slot].sp_top   = addr + ProcessStackInfo[slot].size;
+    ProcessStackInfo[slot].sp       = ProcessStackInfo[slot].sp_top;
+  }
+
   // Setup process stack pointer and stack limit
   __set_PSPLIM(ProcessStackInfo[slot].sp_limit);
   __set_PSP   (ProcessStackInfo[slot].sp);
@@ -181,8 +295,8 @@ uint32_t TZ_StoreContext_S (TZ_MemoryId_t id) {
 
   slot = id - 1U;
 
-  if (ProcessStackInfo[slot].sp == 0U) {
-    return 0U;  // Inactive slot
+  if (ProcessStackInfo[slot].sp_top == 0U) {
+    return 0U;  // Inactive slot or stack not allocated
   }
 
   sp = __get_PSP();
@@ -781,6 +781,10 @@ elif device.endswith('S'):
     prefixes += ['CHECK-S']
 if DEVICES[device]['arch'].startswith('thumb'):
     prefixes += ['CHECK-THUMB']       
+    if DEVICES[device]['defines'].get('__PMU_PRESENT') == '1U':
+        prefixes += ['CHECK-PMU']
+    else:
+        prefixes += ['CHECK-DWT']
 elif DEVICES[device]['arch'].startswith('arm'):
     prefixes += ['CHECK-ARM']
 
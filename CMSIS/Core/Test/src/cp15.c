@@ -291,3 +291,164 @@ void set_dccisw() {
     __set_DCCISW(u32);
     // CHECK: {{(bx lr)|(pop {.*pc})}}
 }
+
+void get_pmcr() {
+    // CHECK-LABEL: <get_pmcr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c12, #0x0
+    volatile uint32_t result = __get_PMCR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmcr() {
+    // CHECK-LABEL: <set_pmcr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x0
+    __set_PMCR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmcntenset() {
+    // CHECK-LABEL: <get_pmcntenset>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c12, #0x1
+    volatile uint32_t result = __get_PMCNTENSET();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmcntenset() {
+    // CHECK-LABEL: <set_pmcntenset>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x1
+    __set_PMCNTENSET(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmcntenclr() {
+    // CHECK-LABEL: <get_pmcntenclr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c12, #0x2
+    volatile uint32_t result = __get_PMCNTENCLR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmcntenclr() {
+    // CHECK-LABEL: <set_pmcntenclr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x2
+    __set_PMCNTENCLR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmovsr() {
+    // CHECK-LABEL: <get_pmovsr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c12, #0x3
+    volatile uint32_t result = __get_PMOVSR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmovsr() {
+    // CHECK-LABEL: <set_pmovsr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x3
+    __set_PMOVSR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmswinc() {
+    // CHECK-LABEL: <set_pmswinc>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x4
+    __set_PMSWINC(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmselr() {
+    // CHECK-LABEL: <get_pmselr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c12, #0x5
+    volatile uint32_t result = __get_PMSELR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmselr() {
+    // CHECK-LABEL: <set_pmselr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x5
+    __set_PMSELR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmccntr() {
+    // CHECK-LABEL: <get_pmccntr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c13, #0x0
+    volatile uint32_t result = __get_PMCCNTR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmccntr() {
+    // CHECK-LABEL: <set_pmccntr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c13, #0x0
+    __set_PMCCNTR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmxevtyper() {
+    // CHECK-LABEL: <get_pmxevtyper>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c13, #0x1
+    volatile uint32_t result = __get_PMXEVTYPER();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmxevtyper() {
+    // CHECK-LABEL: <set_pmxevtyper>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c13, #0x1
+    __set_PMXEVTYPER(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmxevcntr() {
+    // CHECK-LABEL: <get_pmxevcntr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c13, #0x2
+    volatile uint32_t result = __get_PMXEVCNTR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmxevcntr() {
+    // CHECK-LABEL: <set_pmxevcntr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c13, #0x2
+    __set_PMXEVCNTR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmuserenr() {
+    // CHECK-LABEL: <get_pmuserenr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c14, #0x0
+    volatile uint32_t result = __get_PMUSERENR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmuserenr() {
+    // CHECK-LABEL: <set_pmuserenr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c14, #0x0
+    __set_PMUSERENR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmintenset() {
+    // CHECK-LABEL: <get_pmintenset>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c14, #0x1
+    volatile uint32_t result = __get_PMINTENSET();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmintenset() {
+    // CHECK-LABEL: <set_pmintenset>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c14, #0x1
+    __set_PMINTENSET(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void get_pmintenclr() {
+    // CHECK-LABEL: <get_pmintenclr>:
+    // CHECK: mrc p15, #0x0, {{r[0-9]+}}, c9, c14, #0x2
+    volatile uint32_t result = __get_PMINTENCLR();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void set_pmintenclr() {
+    // CHECK-LABEL: <set_pmintenclr>:
+    // CHECK: mcr p15, #0x0, {{r[0-9]+}}, c9, c14, #0x2
+    __set_PMINTENCLR(u32);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
@@ -0,0 +1,66 @@
+// REQUIRES: thumb-2
+// RUN: %cc% %ccflags% %ccout% %T/%basename_t.o %s; llvm-objdump --mcpu=%mcpu% -d %T/%basename_t.o | FileCheck --allow-unused-prefixes --check-prefixes %prefixes% %s
+
+#if !defined(__ARM_ARCH_PROFILE) || (__ARM_ARCH_PROFILE != 'A')
+typedef enum IRQn {
+  NonMaskableInt_IRQn   = -14,
+  HardFault_IRQn        = -13,
+  SVCall_IRQn           =  -5,
+  PendSV_IRQn           =  -2,
+  SysTick_IRQn          =  -1
+} IRQn_Type;
+#endif
+
+#include CORE_HEADER
+#include "cmsis_perf.h"
+
+void cycles() {
+    // CHECK-LABEL: <cycles>:
+    // CHECK-DWT: ldr {{r[0-9]+}}, [{{r[0-9]+}}{{(, #0x4)?}}]
+    // CHECK-PMU: ldr {{r[0-9]+}}, [{{r[0-9]+}}{{(, #0x7c)?}}]
+    // CHECK-ARM: mrc p15, #0x0, {{r[0-9]+}}, c9, c13, #0x0
+    // CHECK-NOT: bl {{.*}}<
+    volatile uint32_t result = perf_cycles();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void cycles64() {
+    // CHECK-LABEL: <cycles64>:
+    // CHECK-THUMB: mrs [[REG:r[0-9]+]], primask
+    // CHECK-ARM: mrs [[REG:r[0-9]+]], apsr
+    // CHECK: cpsid i
+    // CHECK-DWT: ldr {{r[0-9]+}}, [{{r[0-9]+}}{{(, #0x4)?}}]
+    // CHECK-PMU: ldr {{r[0-9]+}}, [{{r[0-9]+}}{{(, #0x7c)?}}]
+    // CHECK-ARM: mrc p15, #0x0, {{r[0-9]+}}, c9, c13, #0x0
+    // CHECK-NOT: bl {{.*}}<
+    // CHECK-THUMB: msr primask, [[REG]]
+    // CHECK-ARM: msr CPSR_{{f?}}c, [[REG]]
+    volatile uint64_t result = perf_cycles64();
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void event_read() {
+    // CHECK-LABEL: <event_read>:
+    // CHECK-DWT: mov{{s?}}{{(.w)?}} {{r[0-9]+}}, #0x0
+    // CHECK-PMU: ldr {{r[0-9]+}}, [{{r[0-9]+}}{{(, #0x4)?}}]
+    // CHECK-PMU: uxth {{r[0-9]+}}, {{r[0-9]+}}
+    // CHECK-ARM: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x5
+    // CHECK-ARM: isb sy
+    // CHECK-ARM: mrc p15, #0x0, {{r[0-9]+}}, c9, c13, #0x2
+    // CHECK-NOT: bl {{.*}}<
+    volatile uint32_t result = perf_event_read(1U);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
+
+void event_config() {
+    // CHECK-LABEL: <event_config>:
+    // CHECK-PMU: str {{r[0-9]+}}, [{{r[0-9]+}}, #0x{{[0-9a-f]+}}]
+    // CHECK-ARM: mrc p15, #0x0, {{r[0-9]+}}, c9, c12, #0x0
+    // CHECK-ARM: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x5
+    // CHECK-ARM: isb sy
+    // CHECK-ARM: mcr p15, #0x0, {{r[0-9]+}}, c9, c13, #0x1
+    // CHECK-ARM: mcr p15, #0x0, {{r[0-9]+}}, c9, c12, #0x1
+    // CHECK-NOT: bl {{.*}}<
+    volatile int32_t result = perf_event_config(1U, PERF_EVENT_INST_RETIRED);
+    // CHECK: {{(bx lr)|(pop {.*pc})}}
+}
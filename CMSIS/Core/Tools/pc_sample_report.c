@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * $Revision:   V1.0.0
+ *
+ * Project:     CMSIS-Core
+ * Title:       PC Sample report (host tool)
+ *
+ * Symbolizes a PC sample histogram against the function symbols of an ELF
+ * file and writes a flat report (samples per function) and a callee report
+ * (samples per caller and directly called function). The dump may be a larger
+ * memory image that contains the histogram buffer; the buffer is located by
+ * its header. PC samples taken by a debug probe from the DWT PCSR register
+ * can be added as a text file with one hexadecimal PC per line (no caller).
+ *
+ * Build:  cc -O2 -o pc_sample_report pc_sample_report.c
+ * Usage:  pc_sample_report [-c] [-p pcsr.txt] [-o output] app.elf [dump.bin]
+ *           -c         add the callee report
+ *           -p file    add PC samples from a text file
+ *           -o output  write to file (default: standard output)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Include/pc_sample.h"
+
+// ELF32 definitions
+#define EI_CLASS        4U
+#define EI_DATA         5U
+#define ELFCLASS32      1U
+#define ELFDATA2LSB     1U
+#define SHT_SYMTAB      2U
+#define STT_FUNC        2U
+
+#define NAME_UNKNOWN    "<unknown>"     // PC or caller outside of a function symbol
+#define NAME_EXCEPTION  "<exception>"   // Caller is an exception return (EXC_RETURN)
+
+// Function symbol
+typedef struct {
+  uint32_t    addr;
+  uint32_t    size;
+  const char *name;
+  uint64_t    samples;                  // Samples in the function
+} func_t;
+
+// PC sample (PC and caller pair)
+typedef struct {
+  uint32_t pc;
+  uint32_t lr;
+  uint32_t count;
+} sample_t;
+
+// Callee report entry
+typedef struct {
+  const char *caller;
+  const char *callee;
+  uint64_t    samples;
+  uint64_t    total;                    // Samples of all callees of the caller
+} edge_t;
+
+static func_t   *Func;
+static uint32_t  FuncCount;
+static sample_t *Sample;
+static uint32_t  SampleCount;
+static FILE     *Out;
+
+// Read little-endian values.
+static uint32_t Get16 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8));
+}
+static uint32_t Get32 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+// Read a file into memory.
+static uint8_t *ReadFile (const char *name, long *size) {
+  FILE    *f;
+  uint8_t *data;
+
+  f = fopen(name, "rb");
+  if (f == NULL) {
+    perror(name);
+    exit(1);
+  }
+  (void)fseek(f, 0, SEEK_END);
+  *size = ftell(f);
+  (void)fseek(f, 0, SEEK_SET);
+  data = malloc((*size > 0) ? ((size_t)*size + 1U) : 1U);
+  if ((data == NULL) || (*size <= 0) || (fread(data, 1U, (size_t)*size, f) != (size_t)*size)) {
+    fprintf(stderr, "%s: read error\n", name);
+    exit(1);
+  }
+  data[*size] = 0U;
+  fclose(f);
+  return data;
+}
+
+// Add a PC sample.
+static void SampleAdd (uint32_t pc, uint32_t lr, uint32_t count) {
+  Sample = realloc(Sample, (SampleCount + 1U) * sizeof(sample_t));
+  if (Sample == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  Sample[SampleCount].pc    = pc & ~1U;
+  Sample[SampleCount].lr    = lr & ~1U;
+  Sample[SampleCount].count = count;
+  SampleCount++;
+}
+
+// Sort function symbols by address.
+static int FuncCompare (const void *a, const void *b) {
+  const func_t *fa = a;
+  const func_t *fb = b;
+
+  if (fa->addr != fb->addr) {
+    return (fa->addr < fb->addr) ? -1 : 1;
+  }
+  return (fb->size > fa->size) ? 1 : ((fb->size < fa->size) ? -1 : 0);
+}
+
+// Sort function symbols by samples (descending).
+static int SamplesCompare (const void *a, const void *b) {
+  const func_t *fa = a;
+  const func_t *fb = b;
+
+  if (fa->samples != fb->samples) {
+    return (fa->samples < fb->samples) ? 1 : -1;
+  }
+  return strcmp(fa->name, fb->name);
+}
+
+// Sort callee report entries by caller total and samples (descending).
+static int EdgeCompare (const void *a, const void *b) {
+  const edge_t *ea = a;
+  const edge_t *eb = b;
+  int           cmp;
+
+  if (ea->total != eb->total) {
+    return (ea->total < eb->total) ? 1 : -1;
+  }
+  cmp = strcmp(ea->caller, eb->caller);
+  if (cmp != 0) {
+    return cmp;
+  }
+  if (ea->samples != eb->samples) {
+    return (ea->samples < eb->samples) ? 1 : -1;
+  }
+  return strcmp(ea->callee, eb->callee);
+}
+
+// Load the function symbols of an ELF file.
+static void LoadSymbols (const char *name, const uint8_t *elf, long size) {
+  uint32_t       shoff, shentsize, shnum;
+  uint32_t       symoff, symsize, entsize, stroff, strsize, link;
+  uint32_t       n, i, st_name;
+  const uint8_t *sh;
+  const uint8_t *sym;
+
+  if ((size < 52) || (Get32(elf) != 0x464C457FU) ||
+      (elf[EI_CLASS] != ELFCLASS32) || (elf[EI_DATA] != ELFDATA2LSB)) {
+    fprintf(stderr, "%s: not a 32-bit little-endian ELF file\n", name);
+    exit(1);
+  }
+  shoff     = Get32(&elf[32]);
+  shentsize = Get16(&elf[46]);
+  shnum     = Get16(&elf[48]);
+  if ((shentsize < 40U) || (((uint64_t)shoff + ((uint64_t)shnum * shentsize)) > (uint64_t)size)) {
+    fprintf(stderr, "%s: invalid section headers\n", name);
+    exit(1);
+  }
+
+  for (n = 0U; n < shnum; n++) {
+    sh = &elf[shoff + (n * shentsize)];
+    if (Get32(&sh[4]) != SHT_SYMTAB) {
+      continue;
+    }
+    symoff  = Get32(&sh[16]);
+    symsize = Get32(&sh[20]);
+    link    = Get32(&sh[24]);
+    entsize = Get32(&sh[36]);
+    if ((entsize < 16U) || (link >= shnum) || (((uint64_t)symoff + symsize) > (uint64_t)size)) {
+      continue;
+    }
+    sh      = &elf[shoff + (link * shentsize)];
+    stroff  = Get32(&sh[16]);
+    strsize = Get32(&sh[20]);
+    if (((uint64_t)stroff + strsize) > (uint64_t)size) {
+      continue;
+    }
+    for (i = 0U; (i + entsize) <= symsize; i += entsize) {
+      sym     = &elf[symoff + i];
+      st_name = Get32(&sym[0]);
+      if (((sym[12] & 0x0FU) != STT_FUNC) || (Get16(&sym[14]) == 0U) || (st_name >= strsize)) {
+        continue;                       // Not a defined function
+      }
+      Func = realloc(Func, (FuncCount + 1U) * sizeof(func_t));
+      if (Func == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+      }
+      Func[FuncCount].addr    = Get32(&sym[4]) & ~1U;       // Clear Thumb bit
+      Func[FuncCount].size    = Get32(&sym[8]);
+      Func[FuncCount].name    = (const char *)&elf[stroff + st_name];
+      Func[FuncCount].samples = 0U;
+      FuncCount++;
+    }
+  }
+  if (FuncCount == 0U) {
+    fprintf(stderr, "%s: no function symbols found\n", name);
+    exit(1);
+  }
+
+  // Sort by address and remove aliases (keep the symbol with the largest size)
+  qsort(Func, FuncCount, sizeof(func_t), FuncCompare);
+  for (i = 0U, n = 1U; n < FuncCount; n++) {
+    if (Func[n].addr != Func[i].addr) {
+      Func[++i] = Func[n];
+    }
+  }
+  FuncCount = i + 1U;
+}
+
+// Find the function that contains an address.
+static func_t *FuncFind (uint32_t addr) {
+  uint32_t lo = 0U;
+  uint32_t hi = FuncCount;
+  uint32_t mid;
+
+  while (lo < hi) {
+    mid = (lo + hi) / 2U;
+    if (Func[mid].addr <= addr) {
+      lo = mid + 1U;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == 0U) {
+    return NULL;
+  }
+  lo--;
+  if ((Func[lo].size != 0U) && ((addr - Func[lo].addr) >= Func[lo].size)) {
+    return NULL;
+  }
+  return &Func[lo];
+}
+
+// Locate the histogram buffer header in the dump.
+static long FindHeader (const uint8_t *data, size_t size) {
+  size_t   offset;
+  uint32_t count;
+
+  for (offset = 0U; (offset + sizeof(ARM_PC_Sample_Header_t)) <= size; offset += 4U) {
+    if ((Get32(&data[offset]) != ARM_PC_SAMPLE_MAGIC) ||
+        (Get16(&data[offset + 4U]) != ARM_PC_SAMPLE_VERSION) ||
+        (Get16(&data[offset + 6U]) != sizeof(ARM_PC_Sample_Entry_t))) {
+      continue;
+    }
+    count = Get32(&data[offset + 8U]);
+    if ((count < 2U) || ((count & (count - 1U)) != 0U) ||
+        ((size - offset - sizeof(ARM_PC_Sample_Header_t)) / sizeof(ARM_PC_Sample_Entry_t)) < count) {
+      continue;
+    }
+    return (long)offset;
+  }
+  return -1;
+}
+
+// Load the PC samples of a histogram buffer.
+static void LoadDump (const char *name) {
+  uint8_t       *data;
+  long           size;
+  long           offset;
+  uint32_t       count, n;
+  const uint8_t *p;
+
+  data = ReadFile(name, &size);
+  offset = FindHeader(data, (size_t)size);
+  if (offset < 0) {
+    fprintf(stderr, "%s: no PC sample buffer found\n", name);
+    exit(1);
+  }
+  count = Get32(&data[offset + 8]);
+  for (n = 0U; n < count; n++) {
+    p = &data[offset + (long)sizeof(ARM_PC_Sample_Header_t) + ((long)n * (long)sizeof(ARM_PC_Sample_Entry_t))];
+    if ((Get32(&p[0]) != 0U) && (Get32(&p[8]) != 0U)) {
+      SampleAdd(Get32(&p[0]), Get32(&p[4]), Get32(&p[8]));
+    }
+  }
+  fprintf(stderr, "%s: %" PRIu32 " samples, %" PRIu32 " dropped, period %" PRIu32 " cycles\n",
+          name, Get32(&data[offset + 16]), Get32(&data[offset + 20]), Get32(&data[offset + 12]));
+  free(data);
+}
+
+// Load PC samples from a text file (one hexadecimal PC per line).
+static void LoadText (const char *name) {
+  uint8_t       *data;
+  long           size;
+  char          *line;
+  char          *end;
+  unsigned long  pc;
+  uint32_t       n = 0U;
+
+  data = ReadFile(name, &size);
+  for (line = strtok((char *)data, "\r\n"); line != NULL; line = strtok(NULL, "\r\n")) {
+    pc = strtoul(line, &end, 16);
+    if ((end == line) || (pc == 0UL) || (pc >= 0xFFFFFFFFUL)) {
+      continue;                         // Empty line, comment or PCSR read while halted
+    }
+    SampleAdd((uint32_t)pc, 0U, 1U);
+    n++;
+  }
+  fprintf(stderr, "%s: %" PRIu32 " samples\n", name, n);
+  free(data);
+}
+
+// Name of a caller.
+static const char *CallerName (uint32_t lr) {
+  func_t *f;
+
+  if (lr == 0U) {
+    return NAME_UNKNOWN;
+  }
+  if (lr >= 0xF0000000U) {
+    return NAME_EXCEPTION;
+  }
+  f = FuncFind(lr - 2U);                // Return address follows the call instruction
+  return (f != NULL) ? f->name : NAME_UNKNOWN;
+}
+
+// Write the flat report.
+static void WriteFlat (const func_t *func, uint64_t total, uint64_t unknown) {
+  uint64_t sum = 0U;
+  uint32_t n;
+
+  fprintf(Out, "Flat report (%" PRIu64 " samples)\n\n", total);
+  fprintf(Out, "   samples       %%   cumul.  function\n");
+  for (n = 0U; (n < FuncCount) && (func[n].samples != 0U); n++) {
+    sum += func[n].samples;
+    fprintf(Out, "%10" PRIu64 "  %5.1f%%  %6.1f%%  %s\n", func[n].samples,
+            (100.0 * (double)func[n].samples) / (double)total, (100.0 * (double)sum) / (double)total, func[n].name);
+  }
+  if (unknown != 0U) {
+    fprintf(Out, "%10" PRIu64 "  %5.1f%%           %s\n", unknown,
+            (100.0 * (double)unknown) / (double)total, NAME_UNKNOWN);
+  }
+}
+
+// Write the callee report.
+static void WriteCallee (uint64_t total) {
+  edge_t     *edge = NULL;
+  uint32_t    count = 0U;
+  uint64_t    self = 0U;
+  uint32_t    n, i;
+  const char *caller;
+  const char *callee;
+  func_t     *f;
+
+  for (n = 0U; n < SampleCount; n++) {
+    f      = FuncFind(Sample[n].pc);
+    callee = (f != NULL) ? f->name : NAME_UNKNOWN;
+    caller = CallerName(Sample[n].lr);
+    if (Sample[n].lr == 0U) {
+      continue;                         // No caller recorded (PCSR sample)
+    }
+    if ((f != NULL) && (caller == f->name)) {
+      self += Sample[n].count;          // LR was overwritten by a call of the function itself
+      continue;
+    }
+    for (i = 0U; i < count; i++) {
+      if ((edge[i].caller == caller) && (edge[i].callee == callee)) {
+        break;
+      }
+    }
+    if (i == count) {
+      edge = realloc(edge, (count + 1U) * sizeof(edge_t));
+      if (edge == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+      }
+      edge[count].caller  = caller;
+      edge[count].callee  = callee;
+      edge[count].samples = 0U;
+      count++;
+    }
+    edge[i].samples += Sample[n].count;
+  }
+  for (n = 0U; n < count; n++) {
+    edge[n].total = 0U;
+    for (i = 0U; i < count; i++) {
+      if (edge[i].caller == edge[n].caller) {
+        edge[n].total += edge[i].samples;
+      }
+    }
+  }
+  qsort(edge, count, sizeof(edge_t), EdgeCompare);
+
+  fprintf(Out, "\nCallee report (caller from the sampled LR)\n\n");
+  fprintf(Out, "   samples       %%  caller\n");
+  fprintf(Out, "                      callee\n");
+  for (n = 0U; n < count; n++) {
+    if ((n == 0U) || (edge[n].caller != edge[n - 1U].caller)) {
+      fprintf(Out, "%10" PRIu64 "  %5.1f%%  %s\n", edge[n].total,
+              (100.0 * (double)edge[n].total) / (double)total, edge[n].caller);
+    }
+    fprintf(Out, "%10" PRIu64 "  %5.1f%%      %s\n", edge[n].samples,
+            (100.0 * (double)edge[n].samples) / (double)total, edge[n].callee);
+  }
+  if (self != 0U) {
+    fprintf(Out, "\n%" PRIu64 " samples without caller (LR overwritten by a call of the sampled function)\n", self);
+  }
+  free(edge);
+}
+
+int main (int argc, char *argv[]) {
+  const char *elf_name  = NULL;
+  const char *dump_name = NULL;
+  const char *text_name = NULL;
+  const char *output    = NULL;
+  int         callee    = 0;
+  uint8_t    *elf;
+  long        size;
+  uint64_t    total, unknown;
+  func_t     *f;
+  uint32_t    n;
+  int         i;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-c") == 0) {
+      callee = 1;
+    } else if ((strcmp(argv[i], "-p") == 0) && ((i + 1) < argc)) {
+      text_name = argv[++i];
+    } else if ((strcmp(argv[i], "-o") == 0) && ((i + 1) < argc)) {
+      output = argv[++i];
+    } else if (elf_name == NULL) {
+      elf_name = argv[i];
+    } else {
+      dump_name = argv[i];
+    }
+  }
+  if ((elf_name == NULL) || ((dump_name == NULL) && (text_name == NULL))) {
+    fprintf(stderr, "Usage: %s [-c] [-p pcsr.txt] [-o output] app.elf [dump.bin]\n", argv[0]);
+    return 2;
+  }
+
+  elf = ReadFile(elf_name, &size);
+  LoadSymbols(elf_name, elf, size);
+  if (dump_name != NULL) {
+    LoadDump(dump_name);
+  }
+  if (text_name != NULL) {
+    LoadText(text_name);
+  }
+
+  // Accumulate the samples per function
+  total   = 0U;
+  unknown = 0U;
+  for (n = 0U; n < SampleCount; n++) {
+    total += Sample[n].count;
+    f = FuncFind(Sample[n].pc);
+    if (f != NULL) {
+      f->samples += Sample[n].count;
+    } else {
+      unknown += Sample[n].count;
+    }
+  }
+  if (total == 0U) {
+    fprintf(stderr, "no samples\n");
+    return 1;
+  }
+
+  Out = stdout;
+  if (output != NULL) {
+    Out = fopen(output, "w");
+    if (Out == NULL) {
+      perror(output);
+      return 1;
+    }
+  }
+
+  // Flat report (sorted by samples), then callee report (needs the address order)
+  f = malloc(FuncCount * sizeof(func_t));
+  if (f == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  memcpy(f, Func, FuncCount * sizeof(func_t));
+  qsort(f, FuncCount, sizeof(func_t), SamplesCompare);
+  WriteFlat(f, total, unknown);
+  free(f);
+  if (callee != 0) {
+    WriteCallee(total);
+  }
+
+  if (Out != stdout) {
+    fclose(Out);
+  }
+  free(Sample);
+  free(Func);
+  free(elf);
+
+  return 0;
+}
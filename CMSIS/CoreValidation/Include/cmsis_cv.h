@@ -120,6 +120,7 @@ extern void TC_GenTimer_CNTP_CVAL(void);
 extern void TC_CML1Cache_EnDisableICache(void);
 extern void TC_CML1Cache_EnDisableDCache(void);
 extern void TC_CML1Cache_CleanDCacheByAddrWhileDisabled(void);
+extern void TC_CML1Cache_DMABufferBidirectional(void);
 #elif defined(__CORTEX_A)
 extern void TC_CAL1Cache_EnDisable(void);
 extern void TC_CAL1Cache_EnDisableBTAC(void);
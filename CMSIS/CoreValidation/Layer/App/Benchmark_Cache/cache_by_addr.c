@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* D-Cache range maintenance always by address (no set/way operations for large ranges) */
+#define __SCB_DCACHE_SETWAY_RATIO   0U
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+
+void Bench_CleanDCache_by_Addr (volatile void *addr, int32_t dsize);
+void Bench_CleanDCache_by_Addr (volatile void *addr, int32_t dsize) {
+  SCB_CleanDCache_by_Addr(addr, dsize);
+}
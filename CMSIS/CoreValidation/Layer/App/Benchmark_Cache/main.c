@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Core Validation
+ * Title:       D-Cache range maintenance benchmark
+ *
+ * Measures cleaning a dirty buffer of increasing size by address (one
+ * operation per line), by set/way (whole D-Cache) and with the adaptive
+ * SCB_CleanDCache_by_Addr, and reports the size where set/way operations
+ * become faster (crossover point for __SCB_DCACHE_SETWAY_RATIO).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+
+//lint -e970 allow using int for main
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS    10U
+#endif
+
+// Largest buffer size in bytes (RAM of the target)
+#ifndef BENCH_BUFFER_SIZE
+#define BENCH_BUFFER_SIZE   0x10000U
+#endif
+
+// Smallest buffer size in bytes
+#define BENCH_SIZE_MIN      1024U
+
+// SCB_CleanDCache_by_Addr built with __SCB_DCACHE_SETWAY_RATIO = 0 (cache_by_addr.c)
+extern void Bench_CleanDCache_by_Addr (volatile void *addr, int32_t dsize);
+
+// Buffer (cache line aligned)
+static uint32_t Buffer[BENCH_BUFFER_SIZE / sizeof(uint32_t)] __ALIGNED(32U);
+
+// Cycles to read the cycle counter
+static uint32_t Overhead;
+
+// Cleaning methods
+#define METHOD_BY_ADDR      0U          // By address
+#define METHOD_SET_WAY      1U          // Whole D-Cache by set/way
+#define METHOD_ADAPTIVE     2U          // SCB_CleanDCache_by_Addr
+#define METHOD_COUNT        3U
+
+
+// Measure the overhead of reading the cycle counter.
+static void Calibrate (void) {
+  uint32_t t0, t1;
+  uint32_t n;
+
+  Overhead = UINT32_MAX;
+  for (n = 0U; n < 100U; n++) {
+    t0 = DWT->CYCCNT;
+    t1 = DWT->CYCCNT;
+    if ((t1 - t0) < Overhead) {
+      Overhead = t1 - t0;
+    }
+  }
+}
+
+// Write the first size bytes of the buffer (lines become dirty).
+static void Dirty (uint32_t size, uint32_t value) {
+  uint32_t n;
+
+  for (n = 0U; n < (size / sizeof(uint32_t)); n++) {
+    Buffer[n] = value + n;
+  }
+  __DSB();
+}
+
+// Average cycles to clean a dirty buffer of size bytes.
+static uint32_t Measure (uint32_t method, uint32_t size) {
+  uint64_t sum = 0U;
+  uint32_t t0, t1;
+  uint32_t n;
+
+  for (n = 0U; n < BENCH_ITERATIONS; n++) {
+    Dirty(size, n);
+    t0 = DWT->CYCCNT;
+    switch (method) {
+      case METHOD_BY_ADDR:
+        Bench_CleanDCache_by_Addr(Buffer, (int32_t)size);
+        break;
+      case METHOD_SET_WAY:
+        SCB_CleanDCache();
+        break;
+      default:
+        SCB_CleanDCache_by_Addr(Buffer, (int32_t)size);
+        break;
+    }
+    t1 = DWT->CYCCNT;
+    sum += ((t1 - t0) > Overhead) ? ((t1 - t0) - Overhead) : 0U;
+  }
+  return ((uint32_t)(sum / BENCH_ITERATIONS));
+}
+
+int main (void)
+{
+  uint32_t cycles[METHOD_COUNT];
+  uint32_t crossover = 0U;
+  uint32_t lines;
+  uint32_t size;
+  uint32_t m;
+
+  // System Initialization
+  SystemCoreClockUpdate();
+
+  SCB_EnableICache();
+  SCB_EnableDCache();
+
+  // Enable the cycle counter
+  DCB->DEMCR  |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT  = 0U;
+  DWT->CTRL   |= DWT_CTRL_CYCCNTENA_Msk;
+  Calibrate();
+
+  lines = SCB_GetDCacheLineCount();
+
+  printf("D-Cache clean of a dirty buffer, %u iterations\n", (unsigned int)BENCH_ITERATIONS);
+  printf("  D-Cache: %u lines of %u bytes, __SCB_DCACHE_SETWAY_RATIO = %u\n",
+         (unsigned int)lines, (unsigned int)__SCB_DCACHE_LINE_SIZE, (unsigned int)__SCB_DCACHE_SETWAY_RATIO);
+  printf("  %-10s %12s %12s %12s\n", "[bytes]", "by address", "by set/way", "adaptive");
+
+  for (size = BENCH_SIZE_MIN; size <= BENCH_BUFFER_SIZE; size *= 2U) {
+    for (m = 0U; m < METHOD_COUNT; m++) {
+      cycles[m] = Measure(m, size);
+    }
+    if ((crossover == 0U) && (cycles[METHOD_SET_WAY] < cycles[METHOD_BY_ADDR])) {
+      crossover = size;
+    }
+    printf("  %-10u %12u %12u %12u\n", (unsigned int)size,
+           (unsigned int)cycles[METHOD_BY_ADDR], (unsigned int)cycles[METHOD_SET_WAY], (unsigned int)cycles[METHOD_ADAPTIVE]);
+  }
+
+  if (crossover != 0U) {
+    printf("  set/way faster from %u bytes (D-Cache size %u bytes)\n",
+           (unsigned int)crossover, (unsigned int)(lines * __SCB_DCACHE_LINE_SIZE));
+  } else {
+    printf("  set/way not faster up to %u bytes\n", (unsigned int)BENCH_BUFFER_SIZE);
+  }
+
+  #ifdef __MICROLIB
+  for(;;) {}
+  #else
+  exit(0);
+  #endif
+}
+
+#if defined(__CORTEX_M)
+__NO_RETURN
+void HardFault_Handler(void);
+__NO_RETURN
+void HardFault_Handler(void) {
+  printf("Benchmark HardFault!\n");
+  #ifdef __MICROLIB
+  for(;;) {}
+  #else
+  exit(1);
+  #endif
+}
+#endif
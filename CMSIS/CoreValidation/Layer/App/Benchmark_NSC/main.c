@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Core Validation
+ * Title:       Non-secure callable gateway benchmark (non-secure part)
+ *
+ * Measures the round trip of calls from the non-secure application to
+ * non-secure callable functions of the secure image (SG veneer, secure
+ * function, register clearing and BXNS return) and compares N individual
+ * calls with one call of the batched gateway (template tz_batch.c) that
+ * processes N requests from a descriptor ring.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+
+#include "nsc_bench.h"
+#include "tz_batch.h"
+
+//lint -e970 allow using int for main
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS    1000U
+#endif
+
+// Number of descriptors of the batch ring (power of 2)
+#define BATCH_COUNT         32U
+
+// Batch sizes
+static const uint32_t BatchSize[] = { 1U, 8U, 32U };
+#define BATCH_SIZES         (sizeof(BatchSize) / sizeof(BatchSize[0]))
+
+// Descriptor ring (non-secure memory)
+static uint32_t RingMem[TZ_BATCH_RING_SIZE(BATCH_COUNT) / sizeof(uint32_t)];
+
+// Non-secure buffer for NSC_Bench_Sum_S
+static uint32_t Buffer[4] = { 1U, 2U, 3U, 4U };
+
+// Cycle statistics
+typedef struct {
+  uint64_t sum;
+  uint32_t min;
+} bench_stat_t;
+
+// Cycles to read the cycle counter
+static uint32_t Overhead;
+
+// Number of wrong results
+static uint32_t ResultErr;
+
+// Non-secure function (called through a pointer so that it is not inlined)
+static uint32_t Local_Add (uint32_t a, uint32_t b, uint32_t c) {
+  return (a + b + c);
+}
+static uint32_t (* volatile LocalAdd) (uint32_t a, uint32_t b, uint32_t c) = Local_Add;
+
+
+// Measure the overhead of reading the cycle counter.
+static void Calibrate (void) {
+  uint32_t t0, t1;
+  uint32_t n;
+
+  Overhead = UINT32_MAX;
+  for (n = 0U; n < 100U; n++) {
+    t0 = DWT->CYCCNT;
+    t1 = DWT->CYCCNT;
+    if ((t1 - t0) < Overhead) {
+      Overhead = t1 - t0;
+    }
+  }
+}
+
+static void StatInit (bench_stat_t *stat) {
+  stat->sum = 0U;
+  stat->min = UINT32_MAX;
+}
+
+static void StatAdd (bench_stat_t *stat, uint32_t t0, uint32_t t1) {
+  uint32_t t = ((t1 - t0) > Overhead) ? ((t1 - t0) - Overhead) : 0U;
+
+  stat->sum += t;
+  if (t < stat->min) {
+    stat->min = t;
+  }
+}
+
+static void StatPrint (const char *name, const bench_stat_t *stat, uint32_t div) {
+  printf("  %-38s %5u (%5u)\n", name,
+         (unsigned int)(stat->sum / ((uint64_t)BENCH_ITERATIONS * div)), (unsigned int)(stat->min / div));
+}
+
+// Round trip of single calls.
+static void MeasureCalls (void) {
+  bench_stat_t stat;
+  uint32_t     t0, t1;
+  uint32_t     n;
+
+  printf("Call round trip, %u iterations\n", (unsigned int)BENCH_ITERATIONS);
+  printf("  %-38s %13s\n", "[cycles avg (min)]", "per call");
+
+  StatInit(&stat);
+  for (n = 0U; n < BENCH_ITERATIONS; n++) {
+    t0 = DWT->CYCCNT;
+    if (LocalAdd(n, 1U, 2U) != (n + 3U)) {
+      ResultErr++;
+    }
+    t1 = DWT->CYCCNT;
+    StatAdd(&stat, t0, t1);
+  }
+  StatPrint("non-secure function (3 arguments)", &stat, 1U);
+
+  StatInit(&stat);
+  for (n = 0U; n < BENCH_ITERATIONS; n++) {
+    t0 = DWT->CYCCNT;
+    NSC_Bench_Void_S();
+    t1 = DWT->CYCCNT;
+    StatAdd(&stat, t0, t1);
+  }
+  StatPrint("NSC function (no arguments)", &stat, 1U);
+
+  StatInit(&stat);
+  for (n = 0U; n < BENCH_ITERATIONS; n++) {
+    t0 = DWT->CYCCNT;
+    if (NSC_Bench_Add_S(n, 1U, 2U) != (n + 3U)) {
+      ResultErr++;
+    }
+    t1 = DWT->CYCCNT;
+    StatAdd(&stat, t0, t1);
+  }
+  StatPrint("NSC function (3 arguments)", &stat, 1U);
+
+  StatInit(&stat);
+  for (n = 0U; n < BENCH_ITERATIONS; n++) {
+    t0 = DWT->CYCCNT;
+    if (NSC_Bench_Sum_S(Buffer, 4U) != 10U) {
+      ResultErr++;
+    }
+    t1 = DWT->CYCCNT;
+    StatAdd(&stat, t0, t1);
+  }
+  StatPrint("NSC function (16 byte buffer check)", &stat, 1U);
+}
+
+// N individual calls compared with one batched call of N requests.
+static void MeasureBatch (void) {
+  TZ_Batch_Ring_t    *ring = (TZ_Batch_Ring_t *)RingMem;
+  TZ_Batch_Request_t *req[BATCH_COUNT];
+  bench_stat_t        stat[2];
+  char                name[40];
+  uint32_t            t0, t1;
+  uint32_t            size;
+  uint32_t            i, k, n;
+
+  TZ_Batch_Init(ring, BATCH_COUNT);
+
+  printf("Batched gateway (TZ_Batch_Process_S), %u iterations\n", (unsigned int)BENCH_ITERATIONS);
+  printf("  %-38s %13s %13s\n", "[cycles per request avg (min)]", "single calls", "batched");
+
+  for (i = 0U; i < BATCH_SIZES; i++) {
+    size = BatchSize[i];
+
+    StatInit(&stat[0]);
+    for (n = 0U; n < BENCH_ITERATIONS; n++) {
+      t0 = DWT->CYCCNT;
+      for (k = 0U; k < size; k++) {
+        if (NSC_Bench_Add_S(n, k, 1U) != (n + k + 1U)) {
+          ResultErr++;
+        }
+      }
+      t1 = DWT->CYCCNT;
+      StatAdd(&stat[0], t0, t1);
+    }
+
+    // Filling the descriptors is part of the measured time
+    StatInit(&stat[1]);
+    for (n = 0U; n < BENCH_ITERATIONS; n++) {
+      t0 = DWT->CYCCNT;
+      for (k = 0U; k < size; k++) {
+        req[k] = TZ_Batch_Put(ring, NSC_BENCH_FUNC_ADD, n, k, 1U);
+      }
+      if (TZ_Batch_Submit(ring) != size) {
+        ResultErr++;
+      }
+      t1 = DWT->CYCCNT;
+      StatAdd(&stat[1], t0, t1);
+      for (k = 0U; k < size; k++) {
+        if ((req[k] == NULL) || (req[k]->result != (int32_t)(n + k + 1U))) {
+          ResultErr++;
+        }
+      }
+    }
+
+    snprintf(name, sizeof(name), "%u request(s)", (unsigned int)size);
+    printf("  %-38s %5u (%5u) %5u (%5u)\n", name,
+           (unsigned int)(stat[0].sum / ((uint64_t)BENCH_ITERATIONS * size)), (unsigned int)(stat[0].min / size),
+           (unsigned int)(stat[1].sum / ((uint64_t)BENCH_ITERATIONS * size)), (unsigned int)(stat[1].min / size));
+  }
+}
+
+int main (void)
+{
+  // System Initialization
+  SystemCoreClockUpdate();
+
+  // Enable the cycle counter
+  DCB->DEMCR  |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT  = 0U;
+  DWT->CTRL   |= DWT_CTRL_CYCCNTENA_Msk;
+  Calibrate();
+
+  MeasureCalls();
+  MeasureBatch();
+
+  if (ResultErr != 0U) {
+    printf("  error: %u wrong results\n", (unsigned int)ResultErr);
+  }
+
+  #ifdef __MICROLIB
+  for(;;) {}
+  #else
+  exit(0);
+  #endif
+}
+
+#if defined(__CORTEX_M)
+__NO_RETURN
+void HardFault_Handler(void);
+__NO_RETURN
+void HardFault_Handler(void) {
+  printf("Benchmark HardFault!\n");
+  #ifdef __MICROLIB
+  for(;;) {}
+  #else
+  exit(1);
+  #endif
+}
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Core Validation
+ * Title:       Non-secure callable gateway benchmark interface definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef NSC_BENCH_H_
+#define NSC_BENCH_H_
+
+#include <stdint.h>
+
+/// Function code of NSC_Bench_Add_S for batched requests (TZ_Batch_Process_S)
+#define NSC_BENCH_FUNC_ADD      0U
+
+/// Non-secure callable function without arguments
+void     NSC_Bench_Void_S (void);
+
+/// Non-secure callable function with three arguments
+uint32_t NSC_Bench_Add_S  (uint32_t a, uint32_t b, uint32_t c);
+
+/// Non-secure callable function that checks and reads a non-secure buffer
+uint32_t NSC_Bench_Sum_S  (const uint32_t *buf, uint32_t num);
+
+#endif  // NSC_BENCH_H_
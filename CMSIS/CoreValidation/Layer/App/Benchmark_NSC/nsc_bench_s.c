@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Core Validation
+ * Title:       Non-secure callable gateway benchmark (secure part)
+ *
+ * Non-secure callable functions measured by the non-secure benchmark and the
+ * request handlers of the batched gateway (template tz_batch.c).
+ * Built into the secure image (Bootloader project).
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stddef.h>
+
+/* Use CMSE intrinsics */
+#include <arm_cmse.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+
+#include "nsc_bench.h"
+#include "tz_batch.h"
+
+/// Non-secure callable function without arguments
+__attribute__((cmse_nonsecure_entry))
+void NSC_Bench_Void_S (void) {
+}
+
+/// Non-secure callable function with three arguments
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_Add_S (uint32_t a, uint32_t b, uint32_t c) {
+  return (a + b + c);
+}
+
+/// Non-secure callable function that checks and reads a non-secure buffer
+__attribute__((cmse_nonsecure_entry))
+uint32_t NSC_Bench_Sum_S (const uint32_t *buf, uint32_t num) {
+  const uint32_t *p;
+  uint32_t        sum = 0U;
+  uint32_t        n;
+
+  if (num > 256U) {
+    return 0U;
+  }
+  p = (const uint32_t *)cmse_check_address_range((void *)buf, num * sizeof(uint32_t), CMSE_NONSECURE | CMSE_MPU_READ);
+  if (p == NULL) {
+    return 0U;
+  }
+  for (n = 0U; n < num; n++) {
+    sum += p[n];
+  }
+  return sum;
+}
+
+// Batched request handler for NSC_BENCH_FUNC_ADD
+static int32_t Batch_Add (const uint32_t *arg) {
+  return (int32_t)(arg[0] + arg[1] + arg[2]);
+}
+
+/// Request handlers of the batched gateway (tz_batch.c)
+const TZ_Batch_Handler_t TZ_Batch_HandlerTable[] = {
+  Batch_Add                             // NSC_BENCH_FUNC_ADD
+};
+const uint32_t TZ_Batch_HandlerCount = sizeof(TZ_Batch_HandlerTable) / sizeof(TZ_Batch_HandlerTable[0]);
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-Core Validation
+ * Title:       TrustZone context switch benchmark (secure part)
+ *
+ * Measures the secure side of an RTOS thread switch (TZ_StoreContext_S of the
+ * outgoing thread and TZ_LoadContext_S of the incoming thread) with the
+ * template tz_context.c.
+ * The functions are called from PendSV like an RTOS kernel does.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+
+#include "tz_context.h"
+
+//lint -e970 allow using int for main
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS    1000U
+#endif
+
+// Thread switch scenarios
+#define SCENARIO_SECURE     0U          // Between two threads with secure context
+#define SCENARIO_MIXED      1U          // Between a thread with and a thread without secure context
+#define SCENARIO_COUNT      2U
+
+static const char *ScenarioName[SCENARIO_COUNT] = {
+  "secure thread <-> secure thread",
+  "secure thread <-> non-secure thread"
+};
+
+// Results: average and minimum cycles per thread switch
+static uint32_t ResultAvg[SCENARIO_COUNT];
+static uint32_t ResultMin[SCENARIO_COUNT];
+static uint32_t ResultErr;
+
+// Cycles to read the cycle counter
+static uint32_t Overhead;
+
+
+// Measure the overhead of reading the cycle counter.
+static void Calibrate (void) {
+  uint32_t t0, t1;
+  uint32_t n;
+
+  Overhead = UINT32_MAX;
+  for (n = 0U; n < 100U; n++) {
+    t0 = DWT->CYCCNT;
+    t1 = DWT->CYCCNT;
+    if ((t1 - t0) < Overhead) {
+      Overhead = t1 - t0;
+    }
+  }
+}
+
+// Run the thread switch scenarios (handler mode).
+static void Measure (void) {
+  TZ_MemoryId_t id[2];
+  uint64_t      sum;
+  uint32_t      min;
+  uint32_t      t0, t1, t;
+  uint32_t      scenario;
+  uint32_t      n;
+
+  if (TZ_InitContextSystem_S() == 0U) {
+    ResultErr++;
+    return;
+  }
+  id[0] = TZ_AllocModuleContext_S(1U);
+  id[1] = TZ_AllocModuleContext_S(1U);
+  if ((id[0] == 0U) || (id[1] == 0U) || (TZ_LoadContext_S(id[0]) == 0U)) {
+    ResultErr++;
+    return;
+  }
+
+  for (scenario = 0U; scenario < SCENARIO_COUNT; scenario++) {
+    sum = 0U;
+    min = UINT32_MAX;
+    for (n = 0U; n < BENCH_ITERATIONS; n++) {
+      if (scenario == SCENARIO_SECURE) {
+        // Outgoing thread id[0], incoming thread id[1] (and back)
+        t0 = DWT->CYCCNT;
+        (void)TZ_StoreContext_S(id[n & 1U]);
+        (void)TZ_LoadContext_S(id[(n & 1U) ^ 1U]);
+        t1 = DWT->CYCCNT;
+      } else {
+        // Switch to a thread without secure context and back: one call each
+        t0 = DWT->CYCCNT;
+        (void)TZ_StoreContext_S(id[0]);
+        (void)TZ_LoadContext_S(id[0]);
+        t1 = DWT->CYCCNT;
+      }
+      t = ((t1 - t0) > Overhead) ? ((t1 - t0) - Overhead) : 0U;
+      sum += t;
+      if (t < min) {
+        min = t;
+      }
+    }
+    if ((scenario == SCENARIO_SECURE) && ((BENCH_ITERATIONS & 1U) != 0U)) {
+      // Leave id[0] loaded
+      (void)TZ_StoreContext_S(id[1]);
+      (void)TZ_LoadContext_S(id[0]);
+    }
+    ResultAvg[scenario] = (uint32_t)(sum / BENCH_ITERATIONS);
+    ResultMin[scenario] = min;
+  }
+
+  (void)TZ_StoreContext_S(id[0]);
+  (void)TZ_FreeModuleContext_S(id[0]);
+  (void)TZ_FreeModuleContext_S(id[1]);
+}
+
+/// PendSV runs the benchmark in handler mode (context functions require an exception)
+void PendSV_Handler (void);
+void PendSV_Handler (void) {
+  Measure();
+}
+
+int main (void)
+{
+  uint32_t scenario;
+
+  // System Initialization
+  SystemCoreClockUpdate();
+
+  // Enable the cycle counter
+  DCB->DEMCR  |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT  = 0U;
+  DWT->CTRL   |= DWT_CTRL_CYCCNTENA_Msk;
+  Calibrate();
+
+  SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+  __DSB();
+  __ISB();
+
+  printf("TrustZone context switch (TZ_StoreContext_S + TZ_LoadContext_S), %u iterations\n",
+         (unsigned int)BENCH_ITERATIONS);
+  if (ResultErr != 0U) {
+    printf("  error: context management not available\n");
+  } else {
+    printf("  %-38s %10s\n", "[cycles]", "avg (min)");
+    for (scenario = 0U; scenario < SCENARIO_COUNT; scenario++) {
+      printf("  %-38s %5u (%3u)\n", ScenarioName[scenario],
+             (unsigned int)ResultAvg[scenario], (unsigned int)ResultMin[scenario]);
+    }
+  }
+
+  #ifdef __MICROLIB
+  for(;;) {}
+  #else
+  exit(0);
+  #endif
+}
+
+#if defined(__CORTEX_M)
+__NO_RETURN
+void HardFault_Handler(void);
+__NO_RETURN
+void HardFault_Handler(void) {
+  printf("Benchmark HardFault!\n");
+  #ifdef __MICROLIB
+  for(;;) {}
+  #else
+  exit(1);
+  #endif
+}
+#endif
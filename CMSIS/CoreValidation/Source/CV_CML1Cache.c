@@ -7,6 +7,7 @@
 
 #include "CV_Framework.h"
 #include "cmsis_cv.h"
+#include "cmsis_dma_buffer.h"
 
 /*-----------------------------------------------------------------------------
  *      Test implementation
@@ -54,3 +55,42 @@ void TC_CML1Cache_CleanDCacheByAddrWhileDisabled(void) {
   ASSERT_TRUE((SCB->CCR & SCB_CCR_DC_Msk) == 0U);
 #endif
 }
+
+/*=======0=========1=========2=========3=========4=========5=========6=========7=========8=========9=========0=========1====*/
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+static uint32_t TC_CML1Cache_DMABufferBidirectional_Buf[DMA_BUFFER_ALIGNMENT / 4U] __ALIGNED(DMA_BUFFER_ALIGNMENT);
+#endif
+
+void TC_CML1Cache_DMABufferBidirectional(void) {
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  volatile uint32_t *buf = TC_CML1Cache_DMABufferBidirectional_Buf;
+  uint32_t n;
+
+  SCB_EnableDCache();
+
+  // CPU data in a dirty D-Cache line
+  for (n = 0U; n < (DMA_BUFFER_ALIGNMENT / 4U); n++) {
+    buf[n] = n;
+  }
+  ASSERT_TRUE(dmaBufferToDevice((void *)buf, DMA_BUFFER_ALIGNMENT, DMA_BUFFER_BIDIRECTIONAL) == ARM_DRIVER_OK);
+
+  // Device writes to memory (D-Cache disabled without maintenance, cached lines are kept)
+  SCB->CCR &= ~SCB_CCR_DC_Msk;
+  __DSB();
+  __ISB();
+  for (n = 0U; n < (DMA_BUFFER_ALIGNMENT / 4U); n++) {
+    buf[n] = ~n;
+  }
+  SCB->CCR |= SCB_CCR_DC_Msk;
+  __DSB();
+  __ISB();
+
+  // No D-Cache line may differ from memory (DMA_BUFFER_DEBUG), the CPU reads the device data
+  ASSERT_TRUE(dmaBufferToCPU((void *)buf, DMA_BUFFER_ALIGNMENT, DMA_BUFFER_BIDIRECTIONAL) == ARM_DRIVER_OK);
+  for (n = 0U; n < (DMA_BUFFER_ALIGNMENT / 4U); n++) {
+    ASSERT_TRUE(buf[n] == ~n);
+  }
+
+  SCB_DisableDCache();
+#endif
+}
@@ -139,6 +139,8 @@
 #define TC_CML1CACHE_ENDISABLE_DCACHE              1
 // <q0> TC_CML1Cache_CleanDCacheByAddrWhileDisabled
 #define TC_CML1CACHE_CLEANDCACHEBYADDRWHILEDISABLED 1
+// <q0> TC_CML1Cache_DMABufferBidirectional
+#define TC_CML1CACHE_DMABUFFERBIDIRECTIONAL        1
 
 // </h>
 
@@ -155,6 +155,7 @@ static TEST_CASE TC_LIST[] = {
     TCD ( TC_CML1Cache_EnDisableICache,              TC_CML1CACHE_ENDISABLE_ICACHE          ),
     TCD ( TC_CML1Cache_EnDisableDCache,              TC_CML1CACHE_ENDISABLE_DCACHE          ),
     TCD ( TC_CML1Cache_CleanDCacheByAddrWhileDisabled, TC_CML1CACHE_CLEANDCACHEBYADDRWHILEDISABLED),
+    TCD ( TC_CML1Cache_DMABufferBidirectional,       TC_CML1CACHE_DMABUFFERBIDIRECTIONAL    ),
   #elif defined(__CORTEX_A)
     TCD ( TC_CAL1Cache_EnDisable,                    TC_CAL1CACHE_ENDISABLE                 ),
     TCD ( TC_CAL1Cache_EnDisableBTAC,                TC_CAL1CACHE_ENDISABLEBTAC             ),
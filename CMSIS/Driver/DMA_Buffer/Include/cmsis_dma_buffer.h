@@ -0,0 +1,88 @@
+/******************************************************************************
+ * @file     cmsis_dma_buffer.h
+ * @brief    CMSIS DMA Buffer header file
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CMSIS_DMA_BUFFER_H
+#define __CMSIS_DMA_BUFFER_H
+
+#include <stdint.h>
+#include "Driver_Common.h"
+
+// DMA buffer alignment and size granularity (D-Cache line size)
+#ifndef DMA_BUFFER_ALIGNMENT
+#define DMA_BUFFER_ALIGNMENT        32U
+#endif
+
+/// Size of a DMA buffer rounded up to whole D-Cache lines.
+#define DMA_BUFFER_SIZE(size)       ((((uint32_t)(size)) + (DMA_BUFFER_ALIGNMENT - 1U)) & ~(DMA_BUFFER_ALIGNMENT - 1U))
+
+// dmaBufferToDevice / dmaBufferToCPU: dir values
+#define DMA_BUFFER_TO_DEVICE        (1U)        ///< Device reads the buffer (for example transmit)
+#define DMA_BUFFER_FROM_DEVICE      (2U)        ///< Device writes the buffer (for example receive)
+#define DMA_BUFFER_BIDIRECTIONAL    (3U)        ///< Device reads and writes the buffer
+
+// DMA buffer specific error codes
+#define DMA_BUFFER_ERROR_ALIGNMENT  (ARM_DRIVER_ERROR_SPECIFIC - 1)     ///< Buffer address or size is not aligned to D-Cache lines
+#define DMA_BUFFER_ERROR_OWNER      (ARM_DRIVER_ERROR_SPECIFIC - 2)     ///< Buffer is not owned by the caller (debug mode)
+#define DMA_BUFFER_ERROR_ACCESS     (ARM_DRIVER_ERROR_SPECIFIC - 3)     ///< CPU accessed the buffer while owned by the device (debug mode)
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Allocate a DMA buffer from the pool (aligned to D-Cache lines, owned by the CPU).
+/// \param[in]     size         buffer size in bytes (rounded up to whole D-Cache lines).
+/// \return pointer to the buffer or NULL when not enough memory is available.
+void *dmaBufferAlloc (uint32_t size);
+
+/// Return a DMA buffer to the pool.
+/// \param[in]     buf          buffer allocated with \ref dmaBufferAlloc.
+/// \return \ref execution_status
+int32_t dmaBufferFree (void *buf);
+
+/// Hand a buffer over from the CPU to the device (before the DMA transfer is started).
+/// \param[in]     buf          buffer (aligned to D-Cache lines).
+/// \param[in]     size         buffer size in bytes (multiple of D-Cache lines).
+/// \param[in]     dir          transfer direction \ref DMA_BUFFER_TO_DEVICE, \ref DMA_BUFFER_FROM_DEVICE or \ref DMA_BUFFER_BIDIRECTIONAL.
+/// \return \ref execution_status
+int32_t dmaBufferToDevice (void *buf, uint32_t size, uint32_t dir);
+
+/// Hand a buffer back from the device to the CPU (after the DMA transfer is completed).
+/// \param[in]     buf          buffer (as passed to \ref dmaBufferToDevice).
+/// \param[in]     size         buffer size in bytes (as passed to \ref dmaBufferToDevice).
+/// \param[in]     dir          transfer direction (as passed to \ref dmaBufferToDevice).
+/// \return \ref execution_status
+int32_t dmaBufferToCPU (void *buf, uint32_t size, uint32_t dir);
+
+/// DMA buffer error notification (debug mode, weak function that can be overridden).
+/// \param[in]     error        error code \ref DMA_BUFFER_ERROR_OWNER or \ref DMA_BUFFER_ERROR_ACCESS.
+/// \param[in]     buf          buffer.
+/// \param[in]     size         buffer size in bytes.
+void dmaBufferError (int32_t error, const void *buf, uint32_t size);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* __CMSIS_DMA_BUFFER_H */
@@ -0,0 +1,378 @@
+/******************************************************************************
+ * @file     dma_buffer.c
+ * @brief    CMSIS DMA Buffer implementation for Cortex-M
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include "cmsis_dma_buffer.h"
+
+#include "RTE_Components.h"                 // Component selection
+#include CMSIS_device_header
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <o>DMA buffer pool size [bytes] <32-1048576:32>
+// <i> Memory for dmaBufferAlloc (multiple of the D-Cache line size).
+#ifndef DMA_BUFFER_POOL_SIZE
+#define DMA_BUFFER_POOL_SIZE        16384U
+#endif
+
+// <q>Debug mode
+// <i> Track buffer ownership and detect CPU accesses to buffers owned by the device.
+#ifndef DMA_BUFFER_DEBUG
+#define DMA_BUFFER_DEBUG            0
+#endif
+
+// <o>Number of tracked buffers (debug mode) <1-256>
+// <i> Maximum number of buffers owned by devices at the same time.
+#ifndef DMA_BUFFER_DEBUG_NUM
+#define DMA_BUFFER_DEBUG_NUM        16U
+#endif
+
+//------------- <<< end of configuration section >>> ---------------------------
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#if (DMA_BUFFER_ALIGNMENT < __SCB_DCACHE_LINE_SIZE)
+#error "DMA_BUFFER_ALIGNMENT is smaller than the D-Cache line size!"
+#endif
+#endif
+
+#if ((DMA_BUFFER_ALIGNMENT & (DMA_BUFFER_ALIGNMENT - 1U)) != 0U)
+#error "DMA_BUFFER_ALIGNMENT must be a power of 2!"
+#endif
+
+// Pool lines and line bitmaps
+#define POOL_LINES      (DMA_BUFFER_POOL_SIZE / DMA_BUFFER_ALIGNMENT)
+#define BITMAP_WORDS    ((POOL_LINES + 31U) / 32U)
+
+#ifdef DMA_BUFFER_SECTION
+static uint8_t  Pool[POOL_LINES * DMA_BUFFER_ALIGNMENT] __ALIGNED(DMA_BUFFER_ALIGNMENT) __attribute__((section(DMA_BUFFER_SECTION)));
+#else
+static uint8_t  Pool[POOL_LINES * DMA_BUFFER_ALIGNMENT] __ALIGNED(DMA_BUFFER_ALIGNMENT);
+#endif
+static uint32_t LineUsed[BITMAP_WORDS];     // Line is allocated
+static uint32_t LineLast[BITMAP_WORDS];     // Line is the last line of an allocation
+
+#define BIT_GET(map, n)     (((map)[(n) >> 5] >> ((n) & 31U)) & 1U)
+#define BIT_SET(map, n)     ((map)[(n) >> 5] |=  (1UL << ((n) & 31U)))
+#define BIT_CLR(map, n)     ((map)[(n) >> 5] &= ~(1UL << ((n) & 31U)))
+
+
+// Disable interrupts (returns previous state).
+static uint32_t Lock (void) {
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  return primask;
+}
+
+// Restore interrupts.
+static void Unlock (uint32_t primask) {
+  __set_PRIMASK(primask);
+}
+
+
+#if (DMA_BUFFER_DEBUG != 0)
+
+// Buffer owned by a device
+typedef struct {
+  const uint8_t *buf;                       // Buffer (NULL: entry not used)
+  uint32_t       size;                      // Size in bytes
+  uint32_t       dir;                       // Transfer direction
+  uint32_t       check;                     // Checksum (DMA_BUFFER_TO_DEVICE)
+} dma_owner_t;
+
+static dma_owner_t Owner[DMA_BUFFER_DEBUG_NUM];
+
+// Checksum of a buffer (as seen by the CPU).
+static uint32_t Checksum (const uint8_t *buf, uint32_t size) {
+  const volatile uint32_t *p = (const volatile uint32_t *)(const volatile void *)buf;
+  uint32_t check = 0U;
+  uint32_t n;
+
+  for (n = 0U; n < (size / 4U); n++) {
+    check = ((check << 5) | (check >> 27)) ^ p[n];
+  }
+  return check;
+}
+
+// Find the device owned buffer that overlaps a range.
+static dma_owner_t *OwnerFind (const uint8_t *buf, uint32_t size) {
+  uint32_t n;
+
+  for (n = 0U; n < DMA_BUFFER_DEBUG_NUM; n++) {
+    if ((Owner[n].buf != NULL) &&
+        (buf < (Owner[n].buf + Owner[n].size)) && (Owner[n].buf < (buf + size))) {
+      return &Owner[n];
+    }
+  }
+  return NULL;
+}
+
+// Record a buffer handed over to the device.
+static int32_t OwnerAdd (const uint8_t *buf, uint32_t size, uint32_t dir) {
+  dma_owner_t *owner;
+  uint32_t     primask;
+  uint32_t     n;
+  int32_t      status = ARM_DRIVER_ERROR_BUSY;
+
+  primask = Lock();
+  if (OwnerFind(buf, size) != NULL) {
+    status = DMA_BUFFER_ERROR_OWNER;        // Already owned by a device
+  } else {
+    for (n = 0U; n < DMA_BUFFER_DEBUG_NUM; n++) {
+      owner = &Owner[n];
+      if (owner->buf == NULL) {
+        owner->buf   = buf;
+        owner->size  = size;
+        owner->dir   = dir;
+        owner->check = 0U;
+        status = ARM_DRIVER_OK;
+        break;
+      }
+    }
+  }
+  Unlock(primask);
+
+  return status;
+}
+
+// Check and remove a buffer handed back to the CPU.
+static int32_t OwnerRemove (const uint8_t *buf, uint32_t size, uint32_t dir) {
+  dma_owner_t *owner;
+  uint32_t     primask;
+  uint32_t     check;
+  int32_t      status = ARM_DRIVER_OK;
+
+  primask = Lock();
+  owner = OwnerFind(buf, size);
+  if ((owner == NULL) || (owner->buf != buf) || (owner->size != size) || (owner->dir != dir)) {
+    Unlock(primask);
+    return DMA_BUFFER_ERROR_OWNER;
+  }
+  check = owner->check;
+  owner->buf = NULL;
+  Unlock(primask);
+
+  if (dir == DMA_BUFFER_TO_DEVICE) {
+    // Device reads only: buffer content is unchanged
+    if (Checksum(buf, size) != check) {
+      status = DMA_BUFFER_ERROR_ACCESS;
+    }
+  }
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  else {
+    // Lines were invalidated when handed over: a line in the cache that differs from
+    // memory was written (or read before the transfer completed) by the CPU
+    const volatile uint32_t *p = (const volatile uint32_t *)(const volatile void *)buf;
+    uint32_t cached[DMA_BUFFER_ALIGNMENT / 4U];
+    uint32_t line, n;
+
+    for (line = 0U; line < (size / 4U); line += (DMA_BUFFER_ALIGNMENT / 4U)) {
+      for (n = 0U; n < (DMA_BUFFER_ALIGNMENT / 4U); n++) {
+        cached[n] = p[line + n];
+      }
+      SCB_InvalidateDCache_by_Addr((volatile void *)&p[line], (int32_t)DMA_BUFFER_ALIGNMENT);
+      for (n = 0U; n < (DMA_BUFFER_ALIGNMENT / 4U); n++) {
+        if (cached[n] != p[line + n]) {
+          status = DMA_BUFFER_ERROR_ACCESS;
+        }
+      }
+    }
+  }
+#endif
+
+  return status;
+}
+
+#endif /* DMA_BUFFER_DEBUG != 0 */
+
+
+/// DMA buffer error notification (debug mode).
+__WEAK void dmaBufferError (int32_t error, const void *buf, uint32_t size) {
+  (void)error;
+  (void)buf;
+  (void)size;
+}
+
+/// Allocate a DMA buffer from the pool.
+void *dmaBufferAlloc (uint32_t size) {
+  uint32_t lines = DMA_BUFFER_SIZE(size) / DMA_BUFFER_ALIGNMENT;
+  uint32_t primask;
+  uint32_t run = 0U;
+  uint32_t n, k;
+  void    *buf = NULL;
+
+  if ((lines == 0U) || (lines > POOL_LINES)) {
+    return NULL;
+  }
+
+  primask = Lock();
+  for (n = 0U; n < POOL_LINES; n++) {
+    if (BIT_GET(LineUsed, n) != 0U) {
+      run = 0U;
+      continue;
+    }
+    run++;
+    if (run == lines) {
+      // First fit: lines n-lines+1 .. n
+      for (k = (n + 1U) - lines; k <= n; k++) {
+        BIT_SET(LineUsed, k);
+      }
+      BIT_SET(LineLast, n);
+      buf = &Pool[((n + 1U) - lines) * DMA_BUFFER_ALIGNMENT];
+      break;
+    }
+  }
+  Unlock(primask);
+
+  return buf;
+}
+
+/// Return a DMA buffer to the pool.
+int32_t dmaBufferFree (void *buf) {
+  uint32_t offset;
+  uint32_t primask;
+  uint32_t n;
+#if (DMA_BUFFER_DEBUG != 0)
+  uint32_t k;
+#endif
+
+  if (((uint8_t *)buf < Pool) || ((uint8_t *)buf >= &Pool[sizeof(Pool)])) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  offset = (uint32_t)((uint8_t *)buf - Pool);
+  if ((offset & (DMA_BUFFER_ALIGNMENT - 1U)) != 0U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  n = offset / DMA_BUFFER_ALIGNMENT;
+
+  primask = Lock();
+  // Buffer must be the start of an allocation
+  if ((BIT_GET(LineUsed, n) == 0U) ||
+      ((n != 0U) && (BIT_GET(LineUsed, n - 1U) != 0U) && (BIT_GET(LineLast, n - 1U) == 0U))) {
+    Unlock(primask);
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+#if (DMA_BUFFER_DEBUG != 0)
+  for (k = n; BIT_GET(LineLast, k) == 0U; k++) {}
+  if (OwnerFind((const uint8_t *)buf, ((k - n) + 1U) * DMA_BUFFER_ALIGNMENT) != NULL) {
+    Unlock(primask);
+    dmaBufferError(DMA_BUFFER_ERROR_OWNER, buf, ((k - n) + 1U) * DMA_BUFFER_ALIGNMENT);
+    return DMA_BUFFER_ERROR_OWNER;
+  }
+#endif
+  for (;;) {
+    BIT_CLR(LineUsed, n);
+    if (BIT_GET(LineLast, n) != 0U) {
+      BIT_CLR(LineLast, n);
+      break;
+    }
+    n++;
+  }
+  Unlock(primask);
+
+  return ARM_DRIVER_OK;
+}
+
+/// Hand a buffer over from the CPU to the device.
+int32_t dmaBufferToDevice (void *buf, uint32_t size, uint32_t dir) {
+#if (DMA_BUFFER_DEBUG != 0)
+  dma_owner_t *owner;
+  uint32_t     primask;
+  int32_t      status;
+#endif
+
+  if ((buf == NULL) || (size == 0U) || (size > (uint32_t)INT32_MAX) ||
+      (dir < DMA_BUFFER_TO_DEVICE) || (dir > DMA_BUFFER_BIDIRECTIONAL)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (((((uint32_t)buf) | size) & (DMA_BUFFER_ALIGNMENT - 1U)) != 0U) {
+    return DMA_BUFFER_ERROR_ALIGNMENT;
+  }
+
+#if (DMA_BUFFER_DEBUG != 0)
+  status = OwnerAdd((const uint8_t *)buf, size, dir);
+  if (status != ARM_DRIVER_OK) {
+    dmaBufferError(status, buf, size);
+    return status;
+  }
+#endif
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if (dir == DMA_BUFFER_FROM_DEVICE) {
+    // Discard the lines: no dirty line may be evicted over data written by the device
+    SCB_InvalidateDCache_by_Addr(buf, (int32_t)size);
+  } else if (dir == DMA_BUFFER_BIDIRECTIONAL) {
+    // Write the CPU data to memory and discard the lines: the device also writes the buffer
+    SCB_CleanInvalidateDCache_by_Addr(buf, (int32_t)size);
+  } else {
+    // Write the CPU data to memory (device reads only, lines stay valid)
+    SCB_CleanDCache_by_Addr(buf, (int32_t)size);
+  }
+#else
+  // CPU writes are completed before the transfer is started
+  __DSB();
+#endif
+
+#if (DMA_BUFFER_DEBUG != 0)
+  if (dir == DMA_BUFFER_TO_DEVICE) {
+    primask = Lock();
+    owner   = OwnerFind((const uint8_t *)buf, size);
+    if (owner != NULL) {
+      owner->check = Checksum((const uint8_t *)buf, size);
+    }
+    Unlock(primask);
+  }
+#endif
+
+  return ARM_DRIVER_OK;
+}
+
+/// Hand a buffer back from the device to the CPU.
+int32_t dmaBufferToCPU (void *buf, uint32_t size, uint32_t dir) {
+  int32_t status = ARM_DRIVER_OK;
+
+  if ((buf == NULL) || (size == 0U) || (size > (uint32_t)INT32_MAX) ||
+      (dir < DMA_BUFFER_TO_DEVICE) || (dir > DMA_BUFFER_BIDIRECTIONAL)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (((((uint32_t)buf) | size) & (DMA_BUFFER_ALIGNMENT - 1U)) != 0U) {
+    return DMA_BUFFER_ERROR_ALIGNMENT;
+  }
+
+#if (DMA_BUFFER_DEBUG != 0)
+  status = OwnerRemove((const uint8_t *)buf, size, dir);
+  if (status != ARM_DRIVER_OK) {
+    dmaBufferError(status, buf, size);
+  }
+#endif
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if (dir != DMA_BUFFER_TO_DEVICE) {
+    // Discard lines loaded (speculatively) while the device owned the buffer
+    SCB_InvalidateDCache_by_Addr(buf, (int32_t)size);
+  }
+#endif
+
+  return status;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2020 Arm Limited. All rights reserved.
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -18,6 +18,16 @@
 
 #include "Driver_ETH_MAC.h"
 
+#if defined(_RTE_)
+#include "RTE_Components.h"
+#endif
+
+/* DMA frame buffers with D-Cache maintenance (CMSIS Driver:DMA Buffer component) */
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+#include <string.h>
+#include "cmsis_dma_buffer.h"
+#endif
+
 #define ARM_ETH_MAC_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /* driver version */
 
 /* Driver Version */
@@ -26,6 +36,15 @@ static const ARM_DRIVER_VERSION DriverVersion = {
     ARM_ETH_MAC_DRV_VERSION
 };
 
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+/* DMA frame buffers (aligned to D-Cache lines) */
+#define ETH_BUF_SIZE    DMA_BUFFER_SIZE(1536U)
+
+static uint8_t *TxBuf;
+static uint8_t *RxBuf;
+static uint32_t TxLen;
+#endif
+
 /* Driver Capabilities */
 static const ARM_ETH_MAC_CAPABILITIES DriverCapabilities = {
     0, /* 1 = IPv4 header checksum verified on receive */
@@ -74,12 +93,55 @@ static int32_t ARM_ETH_MAC_PowerControl(ARM_POWER_STATE state)
     switch (state)
     {
     case ARM_POWER_OFF:
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+        /* Stop the DMA, then return the buffers to the pool */
+        if (RxBuf != NULL)
+        {
+            dmaBufferToCPU(RxBuf, ETH_BUF_SIZE, DMA_BUFFER_FROM_DEVICE);
+            dmaBufferFree(RxBuf);
+            RxBuf = NULL;
+        }
+        if (TxBuf != NULL)
+        {
+            dmaBufferFree(TxBuf);
+            TxBuf = NULL;
+        }
+#endif
         break;
 
     case ARM_POWER_LOW:
         break;
 
     case ARM_POWER_FULL:
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+        if ((TxBuf != NULL) && (RxBuf != NULL))
+        {
+            /* Already powered */
+            break;
+        }
+        TxBuf = dmaBufferAlloc(ETH_BUF_SIZE);
+        RxBuf = dmaBufferAlloc(ETH_BUF_SIZE);
+        if ((TxBuf == NULL) || (RxBuf == NULL))
+        {
+            if (TxBuf != NULL)
+            {
+                dmaBufferFree(TxBuf);
+                TxBuf = NULL;
+            }
+            if (RxBuf != NULL)
+            {
+                dmaBufferFree(RxBuf);
+                RxBuf = NULL;
+            }
+            return ARM_DRIVER_ERROR;
+        }
+        TxLen = 0U;
+        /* Receive buffer is owned by the DMA until a frame is received */
+        if (dmaBufferToDevice(RxBuf, ETH_BUF_SIZE, DMA_BUFFER_FROM_DEVICE) != ARM_DRIVER_OK)
+        {
+            return ARM_DRIVER_ERROR;
+        }
+#endif
         break;
     }
     return ARM_DRIVER_OK;
@@ -99,10 +161,65 @@ static int32_t ARM_ETH_MAC_SetAddressFilter(const ARM_ETH_MAC_ADDR *ptr_addr, ui
 
 static int32_t ARM_ETH_MAC_SendFrame(const uint8_t *frame, uint32_t len, uint32_t flags)
 {
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+    int32_t status;
+
+    if (TxBuf == NULL)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+    if ((frame == NULL) || (len == 0U) || (len > (ETH_BUF_SIZE - TxLen)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    memcpy(&TxBuf[TxLen], frame, len);
+    TxLen += len;
+    if (flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT)
+    {
+        return ARM_DRIVER_OK;
+    }
+
+    /* Clean only the D-Cache lines of the frame, then start the transmit DMA */
+    status = ARM_DRIVER_ERROR;
+    if (dmaBufferToDevice(TxBuf, DMA_BUFFER_SIZE(TxLen), DMA_BUFFER_TO_DEVICE) == ARM_DRIVER_OK)
+    {
+        /* Start the transmit DMA and wait until the frame is sent */
+        dmaBufferToCPU(TxBuf, DMA_BUFFER_SIZE(TxLen), DMA_BUFFER_TO_DEVICE);
+        status = ARM_DRIVER_OK;
+    }
+    TxLen = 0U;
+
+    return status;
+#endif
 }
 
 static int32_t ARM_ETH_MAC_ReadFrame(uint8_t *frame, uint32_t len)
 {
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+    if (RxBuf == NULL)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+    if (len > ETH_BUF_SIZE)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    /* Received frame: invalidate the D-Cache lines of the receive buffer */
+    dmaBufferToCPU(RxBuf, ETH_BUF_SIZE, DMA_BUFFER_FROM_DEVICE);
+    if (frame != NULL)
+    {
+        memcpy(frame, RxBuf, len);
+    }
+
+    /* Return the receive buffer to the DMA */
+    if (dmaBufferToDevice(RxBuf, ETH_BUF_SIZE, DMA_BUFFER_FROM_DEVICE) != ARM_DRIVER_OK)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    return (int32_t)len;
+#endif
 }
 
 static uint32_t ARM_ETH_MAC_GetRxFrameSize(void)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2020 Arm Limited. All rights reserved.
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -18,6 +18,15 @@
  
 #include "Driver_MCI.h"
 
+#if defined(_RTE_)
+#include "RTE_Components.h"
+#endif
+
+/* DMA buffer hand-over with D-Cache maintenance (CMSIS Driver:DMA Buffer component) */
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+#include "cmsis_dma_buffer.h"
+#endif
+
 #define ARM_MCI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /* driver version */
 
 /* Driver Version */
@@ -26,6 +35,13 @@ static const ARM_DRIVER_VERSION DriverVersion = {
     ARM_MCI_DRV_VERSION
 };
 
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+/* DMA transfer buffer */
+static uint8_t *XferData;
+static uint32_t XferSize;
+static uint32_t XferDir;
+#endif
+
 /* Driver Capabilities */
 static const ARM_MCI_CAPABILITIES DriverCapabilities = {
     0, /* cd_state          */
@@ -128,6 +144,22 @@ static int32_t ARM_MCI_SendCommand(uint32_t cmd, uint32_t arg, uint32_t flags, u
 
 static int32_t ARM_MCI_SetupTransfer(uint8_t  *data, uint32_t block_count, uint32_t block_size, uint32_t mode)
 {
+#if defined(RTE_CMSIS_DRIVER_DMA_BUFFER)
+    XferData = data;
+    XferSize = block_count * block_size;
+    XferDir  = (mode & ARM_MCI_TRANSFER_WRITE) ? DMA_BUFFER_TO_DEVICE : DMA_BUFFER_FROM_DEVICE;
+
+    /* Hand the data buffer over to the DMA (D-Cache maintenance for the transfer direction) */
+    if (dmaBufferToDevice(XferData, XferSize, XferDir) != ARM_DRIVER_OK)
+    {
+        /* Buffer not aligned to D-Cache lines: the application must use a buffer from dmaBufferAlloc */
+        XferData = NULL;
+        return ARM_DRIVER_ERROR;
+    }
+
+    /* On transfer complete or abort: dmaBufferToCPU(XferData, XferSize, XferDir) */
+    return ARM_DRIVER_OK;
+#endif
 }
 
 static int32_t ARM_MCI_AbortTransfer(void)
@@ -0,0 +1,664 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Benchmark
+ * Title:       RTOS2 latency and throughput benchmarks
+ *
+ * Measures the cost of RTOS2 primitives through the cmsis_os2.h API only,
+ * so that any RTOS2 implementation can be compared:
+ *  - semaphore ping-pong between two threads (round trip)
+ *  - mutex acquire/release without contention and hand-over with contention
+ *  - osThreadFlagsSet from ISR to thread wake-up
+ *  - message queue round trip between two threads
+ *  - memory pool alloc and free
+ *  - periodic timer callback jitter
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "rtos2_bench.h"
+#include "rtos2_bench_config.h"
+
+#define BENCH_TIME_DWT      0
+#define BENCH_TIME_PMU      1
+#define BENCH_TIME_POSIX    2
+
+#if   (BENCH_TIME_SOURCE == BENCH_TIME_POSIX)
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#else
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#endif
+
+#define FLAG_START          0x01U       // Start helper iteration
+#define FLAG_DONE           0x02U       // Helper or callback finished
+
+// Shared benchmark state
+static int32_t            Samples[BENCH_SAMPLES];
+static uint32_t           Overhead;
+static volatile uint32_t  TimeStart;
+static volatile uint32_t  SampleCount;
+static osThreadId_t       BenchThread;
+static osThreadId_t       HelperThread;
+static osSemaphoreId_t    SemA;
+static osSemaphoreId_t    SemB;
+static osMutexId_t        Mutex;
+static osMessageQueueId_t MsgQ1;
+static osMessageQueueId_t MsgQ2;
+static uint32_t           TimerLast;
+static uint32_t           TimerExpected;
+
+
+//  ==== Time source and interrupt porting ====
+
+#if   (BENCH_TIME_SOURCE == BENCH_TIME_DWT)
+
+static void BENCH_TimeInit (void) {
+  DCB->DEMCR  |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT  = 0U;
+  DWT->CTRL   |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t BENCH_Time (void) {
+  return DWT->CYCCNT;
+}
+
+static uint32_t BENCH_TimeFreq (void) {
+  return SystemCoreClock;
+}
+
+#elif (BENCH_TIME_SOURCE == BENCH_TIME_PMU)
+
+static void BENCH_TimeInit (void) {
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  ARM_PMU_Enable();
+  ARM_PMU_CYCCNT_Reset();
+  ARM_PMU_CNTR_Enable(PMU_CNTENSET_CCNTR_ENABLE_Msk);
+}
+
+static inline uint32_t BENCH_Time (void) {
+  return ARM_PMU_Get_CCNTR();
+}
+
+static uint32_t BENCH_TimeFreq (void) {
+  return SystemCoreClock;
+}
+
+#elif (BENCH_TIME_SOURCE == BENCH_TIME_POSIX)
+
+static void BENCH_TimeInit (void) {
+}
+
+static inline uint32_t BENCH_Time (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+static uint32_t BENCH_TimeFreq (void) {
+  return 1000000000U;
+}
+
+#else
+#error "Invalid BENCH_TIME_SOURCE"
+#endif
+
+#if   (BENCH_TIME_SOURCE == BENCH_TIME_POSIX)
+
+// Host thread that emulates the interrupt (non-RTOS threads execute in ISR context)
+static sem_t IrqSem;
+
+static void *BENCH_IrqThread (void *arg) {
+  (void)arg;
+
+  for (;;) {
+    if (sem_wait(&IrqSem) == 0) {
+      RTOS2_Bench_IRQHandler();
+    }
+  }
+  return NULL;
+}
+
+static int32_t BENCH_IrqInit (void) {
+  static uint8_t started = 0U;
+  pthread_t      thread;
+
+  if (started == 0U) {
+    if ((sem_init(&IrqSem, 0, 0U) != 0) ||
+        (pthread_create(&thread, NULL, BENCH_IrqThread, NULL) != 0)) {
+      return (-1);
+    }
+    (void)pthread_detach(thread);
+    started = 1U;
+  }
+  return (0);
+}
+
+static void BENCH_IrqTrigger (void) {
+  (void)sem_post(&IrqSem);
+}
+
+#elif defined(BENCH_IRQn)
+
+static int32_t BENCH_IrqInit (void) {
+  NVIC_ClearPendingIRQ((IRQn_Type)BENCH_IRQn);
+  NVIC_EnableIRQ((IRQn_Type)BENCH_IRQn);
+  return (0);
+}
+
+static void BENCH_IrqTrigger (void) {
+  NVIC_SetPendingIRQ((IRQn_Type)BENCH_IRQn);
+}
+
+#else
+
+static int32_t BENCH_IrqInit (void) {
+  return (-1);
+}
+
+static void BENCH_IrqTrigger (void) {
+}
+
+#endif
+
+/// Benchmark interrupt handler.
+void RTOS2_Bench_IRQHandler (void) {
+  TimeStart = BENCH_Time();
+  (void)osThreadFlagsSet(HelperThread, FLAG_START);
+}
+
+/// Get time source unit name.
+const char *RTOS2_Bench_GetUnit (void) {
+#if (BENCH_TIME_SOURCE == BENCH_TIME_POSIX)
+  return "ns";
+#else
+  return "cycles";
+#endif
+}
+
+
+//  ==== Statistics ====
+
+static int CompareSample (const void *a, const void *b) {
+  int32_t x = *(const int32_t *)a;
+  int32_t y = *(const int32_t *)b;
+
+  return ((x > y) - (x < y));
+}
+
+// Calculate statistics of the collected samples.
+static void BENCH_Statistics (uint32_t count, RTOS2_Bench_Stat_t *stat) {
+  int64_t  sum = 0;
+  uint32_t n;
+
+  qsort(Samples, count, sizeof(int32_t), CompareSample);
+
+  for (n = 0U; n < count; n++) {
+    sum += Samples[n];
+  }
+  stat->count = count;
+  stat->min   = Samples[0];
+  stat->max   = Samples[count - 1U];
+  stat->avg   = (int32_t)(sum / (int64_t)count);
+  stat->p50   = Samples[((count - 1U) * 50U) / 100U];
+  stat->p90   = Samples[((count - 1U) * 90U) / 100U];
+  stat->p99   = Samples[((count - 1U) * 99U) / 100U];
+}
+
+// Store a latency sample (measurement overhead removed).
+static inline void BENCH_Sample (uint32_t n, uint32_t t0, uint32_t t1) {
+  uint32_t t = t1 - t0;
+
+  Samples[n] = (int32_t)((t > Overhead) ? (t - Overhead) : 0U);
+}
+
+// Measure the overhead of reading the time source.
+static void BENCH_Calibrate (void) {
+  uint32_t t0, t1;
+  uint32_t min = UINT32_MAX;
+  uint32_t n;
+
+  for (n = 0U; n < 100U; n++) {
+    t0 = BENCH_Time();
+    t1 = BENCH_Time();
+    if ((t1 - t0) < min) {
+      min = t1 - t0;
+    }
+  }
+  Overhead = min;
+}
+
+// Create a helper thread with a priority above the benchmark thread.
+static osThreadId_t BENCH_HelperNew (osThreadFunc_t func, const char *name) {
+  osThreadAttr_t attr = { 0 };
+
+  attr.name       = name;
+  attr.stack_size = BENCH_STACK_SIZE;
+  attr.priority   = (osPriority_t)(osThreadGetPriority(osThreadGetId()) + 1);
+
+  return osThreadNew(func, NULL, &attr);
+}
+
+
+//  ==== Benchmarks ====
+
+// Semaphore ping-pong: helper side.
+static void SemPong (void *argument) {
+  uint32_t n;
+  (void)argument;
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    if (osSemaphoreAcquire(SemB, osWaitForever) != osOK) {
+      break;
+    }
+    (void)osSemaphoreRelease(SemA);
+  }
+  (void)osThreadFlagsSet(BenchThread, FLAG_DONE);
+}
+
+// Semaphore ping-pong round trip.
+static uint32_t Bench_SemaphorePingPong (void) {
+  uint32_t t0, t1;
+  uint32_t n;
+
+  SemA = osSemaphoreNew(1U, 0U, NULL);
+  SemB = osSemaphoreNew(1U, 0U, NULL);
+  if ((SemA == NULL) || (SemB == NULL) || (BENCH_HelperNew(SemPong, "SemPong") == NULL)) {
+    return 0U;
+  }
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    t0 = BENCH_Time();
+    (void)osSemaphoreRelease(SemB);
+    if (osSemaphoreAcquire(SemA, osWaitForever) != osOK) {
+      break;
+    }
+    t1 = BENCH_Time();
+    BENCH_Sample(n, t0, t1);
+  }
+
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  (void)osSemaphoreDelete(SemA);
+  (void)osSemaphoreDelete(SemB);
+
+  return n;
+}
+
+// Mutex acquire/release without contention.
+static uint32_t Bench_MutexUncontended (void) {
+  uint32_t t0, t1;
+  uint32_t n;
+
+  Mutex = osMutexNew(NULL);
+  if (Mutex == NULL) {
+    return 0U;
+  }
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    t0 = BENCH_Time();
+    (void)osMutexAcquire(Mutex, osWaitForever);
+    (void)osMutexRelease(Mutex);
+    t1 = BENCH_Time();
+    BENCH_Sample(n, t0, t1);
+  }
+
+  (void)osMutexDelete(Mutex);
+
+  return n;
+}
+
+// Mutex contention: helper side (blocks on the mutex owned by the benchmark thread).
+static void MutexWaiter (void *argument) {
+  uint32_t n;
+  (void)argument;
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    (void)osThreadFlagsWait(FLAG_START, osFlagsWaitAny, osWaitForever);
+    if (osMutexAcquire(Mutex, osWaitForever) != osOK) {
+      break;
+    }
+    BENCH_Sample(n, TimeStart, BENCH_Time());
+    (void)osMutexRelease(Mutex);
+    SampleCount = n + 1U;
+  }
+  (void)osThreadFlagsSet(BenchThread, FLAG_DONE);
+}
+
+// Mutex hand-over from release to the higher priority waiter.
+static uint32_t Bench_MutexContended (void) {
+  const osMutexAttr_t attr = { NULL, osMutexPrioInherit, NULL, 0U };
+  uint32_t n;
+
+  Mutex = osMutexNew(&attr);
+  SampleCount = 0U;
+  if (Mutex == NULL) {
+    return 0U;
+  }
+  HelperThread = BENCH_HelperNew(MutexWaiter, "MutexWaiter");
+  if (HelperThread == NULL) {
+    (void)osMutexDelete(Mutex);
+    return 0U;
+  }
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    (void)osMutexAcquire(Mutex, osWaitForever);
+    (void)osThreadFlagsSet(HelperThread, FLAG_START);
+    // Wait until the helper is blocked on the mutex
+    while (osThreadGetState(HelperThread) != osThreadBlocked) {
+      (void)osThreadYield();
+    }
+    TimeStart = BENCH_Time();
+    (void)osMutexRelease(Mutex);
+    // Helper preempts, samples and releases the mutex
+    while (SampleCount == n) {
+      (void)osThreadYield();
+    }
+  }
+
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  (void)osMutexDelete(Mutex);
+
+  return SampleCount;
+}
+
+// ISR to thread: helper side (woken by osThreadFlagsSet from the interrupt).
+static void IrqWaiter (void *argument) {
+  uint32_t n;
+  (void)argument;
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    if ((osThreadFlagsWait(FLAG_START, osFlagsWaitAny, osWaitForever) & osFlagsError) != 0U) {
+      break;
+    }
+    BENCH_Sample(n, TimeStart, BENCH_Time());
+    SampleCount = n + 1U;
+    (void)osSemaphoreRelease(SemA);
+  }
+  (void)osThreadFlagsSet(BenchThread, FLAG_DONE);
+}
+
+// osThreadFlagsSet from ISR to thread wake-up.
+static uint32_t Bench_IsrToThread (void) {
+  uint32_t n;
+
+  if (BENCH_IrqInit() != 0) {
+    return 0U;
+  }
+  SemA = osSemaphoreNew(1U, 0U, NULL);
+  SampleCount = 0U;
+  if (SemA == NULL) {
+    return 0U;
+  }
+  HelperThread = BENCH_HelperNew(IrqWaiter, "IrqWaiter");
+  if (HelperThread == NULL) {
+    (void)osSemaphoreDelete(SemA);
+    return 0U;
+  }
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    // Wait until the helper is blocked on its thread flags
+    while (osThreadGetState(HelperThread) != osThreadBlocked) {
+      (void)osThreadYield();
+    }
+    BENCH_IrqTrigger();
+    if (osSemaphoreAcquire(SemA, osWaitForever) != osOK) {
+      break;
+    }
+  }
+
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  (void)osSemaphoreDelete(SemA);
+
+  return SampleCount;
+}
+
+// Message queue round trip: helper side (echoes messages).
+static void MsgEcho (void *argument) {
+  uint32_t msg;
+  uint32_t n;
+  (void)argument;
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    if (osMessageQueueGet(MsgQ1, &msg, NULL, osWaitForever) != osOK) {
+      break;
+    }
+    (void)osMessageQueuePut(MsgQ2, &msg, 0U, osWaitForever);
+  }
+  (void)osThreadFlagsSet(BenchThread, FLAG_DONE);
+}
+
+// Message queue round trip.
+static uint32_t Bench_MessageQueueRoundTrip (void) {
+  uint32_t t0, t1;
+  uint32_t msg;
+  uint32_t n;
+
+  MsgQ1 = osMessageQueueNew(1U, sizeof(uint32_t), NULL);
+  MsgQ2 = osMessageQueueNew(1U, sizeof(uint32_t), NULL);
+  if ((MsgQ1 == NULL) || (MsgQ2 == NULL) || (BENCH_HelperNew(MsgEcho, "MsgEcho") == NULL)) {
+    return 0U;
+  }
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    msg = n;
+    t0 = BENCH_Time();
+    (void)osMessageQueuePut(MsgQ1, &msg, 0U, osWaitForever);
+    if (osMessageQueueGet(MsgQ2, &msg, NULL, osWaitForever) != osOK) {
+      break;
+    }
+    t1 = BENCH_Time();
+    BENCH_Sample(n, t0, t1);
+  }
+
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  (void)osMessageQueueDelete(MsgQ1);
+  (void)osMessageQueueDelete(MsgQ2);
+
+  return n;
+}
+
+// Memory pool alloc (op_free = 0U) or free (op_free = 1U).
+static uint32_t Bench_MemoryPool (uint32_t op_free) {
+  osMemoryPoolId_t mp;
+  void    *block;
+  uint32_t t0, t1;
+  uint32_t n;
+
+  mp = osMemoryPoolNew(8U, 32U, NULL);
+  if (mp == NULL) {
+    return 0U;
+  }
+
+  for (n = 0U; n < BENCH_SAMPLES; n++) {
+    t0 = BENCH_Time();
+    block = osMemoryPoolAlloc(mp, 0U);
+    t1 = BENCH_Time();
+    if (block == NULL) {
+      break;
+    }
+    if (op_free != 0U) {
+      t0 = BENCH_Time();
+      (void)osMemoryPoolFree(mp, block);
+      t1 = BENCH_Time();
+    } else {
+      (void)osMemoryPoolFree(mp, block);
+    }
+    BENCH_Sample(n, t0, t1);
+  }
+
+  (void)osMemoryPoolDelete(mp);
+
+  return n;
+}
+
+static uint32_t Bench_MemoryPoolAlloc (void) {
+  return Bench_MemoryPool(0U);
+}
+
+static uint32_t Bench_MemoryPoolFree (void) {
+  return Bench_MemoryPool(1U);
+}
+
+// Periodic timer callback: deviation from the timer period.
+static void TimerCallback (void *argument) {
+  uint32_t t = BENCH_Time();
+  uint32_t n = SampleCount;
+  (void)argument;
+
+  if (TimerLast != 0U) {
+    if (n < BENCH_SAMPLES) {
+      Samples[n] = (int32_t)((t - TimerLast) - TimerExpected);
+      SampleCount = n + 1U;
+      if ((n + 1U) == BENCH_SAMPLES) {
+        (void)osThreadFlagsSet(BenchThread, FLAG_DONE);
+      }
+    }
+  }
+  TimerLast = (t != 0U) ? t : 1U;
+}
+
+// Periodic timer callback jitter.
+static uint32_t Bench_TimerJitter (void) {
+  osTimerId_t timer;
+  uint32_t    timeout;
+
+  TimerExpected = (uint32_t)(((uint64_t)BENCH_TimeFreq() * BENCH_TIMER_PERIOD) / osKernelGetTickFreq());
+  TimerLast     = 0U;
+  SampleCount   = 0U;
+
+  timer = osTimerNew(TimerCallback, osTimerPeriodic, NULL, NULL);
+  if (timer == NULL) {
+    return 0U;
+  }
+  (void)osTimerStart(timer, BENCH_TIMER_PERIOD);
+
+  timeout = (BENCH_SAMPLES + 10U) * BENCH_TIMER_PERIOD * 2U;
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, timeout);
+
+  (void)osTimerStop(timer);
+  (void)osTimerDelete(timer);
+
+  return SampleCount;
+}
+
+
+//  ==== Benchmark runner ====
+
+typedef struct {
+  const char *name;
+  uint32_t  (*func) (void);
+} BENCH_Item_t;
+
+static const BENCH_Item_t BenchList[] = {
+  { "semaphore ping-pong",      Bench_SemaphorePingPong     },
+  { "mutex uncontended",        Bench_MutexUncontended      },
+  { "mutex contended",          Bench_MutexContended        },
+  { "ISR flags to thread",      Bench_IsrToThread           },
+  { "message queue round trip", Bench_MessageQueueRoundTrip },
+  { "memory pool alloc",        Bench_MemoryPoolAlloc       },
+  { "memory pool free",         Bench_MemoryPoolFree        },
+  { "timer callback jitter",    Bench_TimerJitter           },
+};
+
+// Print a result line.
+static void BENCH_Print (const char *name, const RTOS2_Bench_Stat_t *stat) {
+
+  if (stat == NULL) {
+    printf("  %-26s %s\n", name, "skipped");
+    return;
+  }
+  printf("  %-26s %8ld %8ld %8ld %8ld %8ld %8ld\n", name,
+         (long)stat->min, (long)stat->avg, (long)stat->p50,
+         (long)stat->p90, (long)stat->p99, (long)stat->max);
+}
+
+/// Run all benchmarks.
+uint32_t RTOS2_Bench_Run (RTOS2_Bench_Report_t report) {
+  RTOS2_Bench_Stat_t stat;
+  uint32_t failed = 0U;
+  uint32_t count;
+  uint32_t i;
+
+  if (report == NULL) {
+    report = BENCH_Print;
+  }
+
+  BENCH_TimeInit();
+  BENCH_Calibrate();
+  BenchThread = osThreadGetId();
+
+  for (i = 0U; i < (sizeof(BenchList) / sizeof(BenchList[0])); i++) {
+    (void)osThreadFlagsClear(FLAG_START | FLAG_DONE);
+    count = BenchList[i].func();
+    if (count == 0U) {
+      report(BenchList[i].name, NULL);
+      failed++;
+      continue;
+    }
+    BENCH_Statistics(count, &stat);
+    report(BenchList[i].name, &stat);
+    // Let terminated helper threads be cleaned up
+    (void)osDelay(1U);
+  }
+
+  return failed;
+}
+
+/// Benchmark thread function.
+void RTOS2_Bench_Thread (void *argument) {
+  osVersion_t version;
+  char        id[32];
+  (void)argument;
+
+  (void)osKernelGetInfo(&version, id, sizeof(id));
+  BENCH_TimeInit();
+  BENCH_Calibrate();
+
+  printf("CMSIS-RTOS2 benchmark: %s, %u samples, time source overhead %lu %s\n",
+         id, (unsigned int)BENCH_SAMPLES, (unsigned long)Overhead, RTOS2_Bench_GetUnit());
+  printf("  %-26s %8s %8s %8s %8s %8s %8s [%s]\n",
+         "benchmark", "min", "avg", "p50", "p90", "p99", "max", RTOS2_Bench_GetUnit());
+
+  (void)RTOS2_Bench_Run(NULL);
+
+#ifdef BENCH_MAIN
+  exit(0);
+#endif
+}
+
+#ifdef BENCH_MAIN
+int main (void) {
+  osThreadAttr_t attr = { 0 };
+
+  (void)osKernelInitialize();
+  attr.name     = "Bench";
+  attr.priority = osPriorityNormal;
+  (void)osThreadNew(RTOS2_Bench_Thread, NULL, &attr);
+  (void)osKernelStart();
+
+  return 0;
+}
+#endif
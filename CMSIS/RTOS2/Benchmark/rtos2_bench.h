@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Benchmark
+ * Title:       Benchmark interface definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef RTOS2_BENCH_H_
+#define RTOS2_BENCH_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Benchmark statistics (time source units).
+typedef struct {
+  uint32_t count;                       ///< Number of samples
+  int32_t  min;                         ///< Minimum
+  int32_t  avg;                         ///< Average
+  int32_t  p50;                         ///< 50th percentile (median)
+  int32_t  p90;                         ///< 90th percentile
+  int32_t  p99;                         ///< 99th percentile
+  int32_t  max;                         ///< Maximum
+} RTOS2_Bench_Stat_t;
+
+/// Benchmark result callback (called for each benchmark).
+/// \param[in]     name          benchmark name.
+/// \param[in]     stat          benchmark statistics or NULL if the benchmark was skipped.
+typedef void (*RTOS2_Bench_Report_t) (const char *name, const RTOS2_Bench_Stat_t *stat);
+
+/// Run all benchmarks (call from a thread with the kernel running).
+/// \param[in]     report        result callback or NULL to print a table with printf.
+/// \return number of benchmarks that failed.
+uint32_t RTOS2_Bench_Run (RTOS2_Bench_Report_t report);
+
+/// Benchmark thread function (runs \ref RTOS2_Bench_Run and prints the results).
+/// \param[in]     argument      not used.
+void RTOS2_Bench_Thread (void *argument);
+
+/// Get time source unit name ("cycles" or "ns").
+/// \return unit name.
+const char *RTOS2_Bench_GetUnit (void);
+
+/// Benchmark interrupt handler (install as handler of BENCH_IRQn).
+void RTOS2_Bench_IRQHandler (void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // RTOS2_BENCH_H_
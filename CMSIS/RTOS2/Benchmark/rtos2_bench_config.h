@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Revision:   V1.0.0
+ *
+ * Project:     CMSIS-RTOS2 Benchmark
+ * Title:       Benchmark configuration definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef RTOS2_BENCH_CONFIG_H_
+#define RTOS2_BENCH_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>Benchmark Configuration
+// ==========================
+
+//   <o>Time Source
+//     <0=> DWT Cycle Counter (CYCCNT)
+//     <1=> PMU Cycle Counter (CCNTR)
+//     <2=> POSIX clock_gettime
+//   <i> DWT: Armv7-M and Armv8-M Mainline. PMU: Armv8.1-M with PMU.
+//   <i> POSIX: host builds (nanoseconds).
+//   <i> Default: POSIX on hosts, DWT otherwise
+#ifndef BENCH_TIME_SOURCE
+#if defined(__unix__) || defined(__APPLE__)
+#define BENCH_TIME_SOURCE           2
+#else
+#define BENCH_TIME_SOURCE           0
+#endif
+#endif
+
+//   <o>Number of Samples <10-100000>
+//   <i> Defines the number of samples per benchmark.
+//   <i> Sample memory: 4 bytes per sample.
+//   <i> Default: 1000
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES               1000
+#endif
+
+//   <o>Timer Period [ticks] <1-1000>
+//   <i> Defines the period of the timer used for the callback jitter benchmark.
+//   <i> Default: 1
+#ifndef BENCH_TIMER_PERIOD
+#define BENCH_TIMER_PERIOD          1
+#endif
+
+//   <o>Helper Thread Stack Size [bytes] <256-65536:8>
+//   <i> Defines the stack size of the benchmark helper threads.
+//   <i> Default: 512
+#ifndef BENCH_STACK_SIZE
+#define BENCH_STACK_SIZE            512
+#endif
+
+// </h>
+
+// <h>Interrupt Configuration
+// ==========================
+// <i> The ISR to thread benchmark uses a software triggered interrupt.
+// <i> RTOS2_Bench_IRQHandler must be installed as handler of this interrupt.
+// <i> The benchmark is skipped when BENCH_IRQn is not defined (target builds).
+
+//   <o>Interrupt Number <0-479>
+//   <i> Defines an unused device interrupt (IRQn).
+//#define BENCH_IRQn                  0
+
+// </h>
+
+//------------- <<< end of configuration section >>> ---------------------------
+
+#endif  // RTOS2_BENCH_CONFIG_H_
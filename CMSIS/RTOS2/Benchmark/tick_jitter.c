@@ -0,0 +1,505 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Benchmark
+ * Title:       OS Tick jitter and interrupt latency harness
+ *
+ * Drives an OS Tick implementation (os_tick.h) without an RTOS kernel and
+ * records for each tick interrupt:
+ *  - the latency from the tick event to the handler entry (OS_Tick_GetCount)
+ *  - the deviation of the time between two handler entries from the ideal
+ *    tick period (OS_Tick_GetTimestamp64)
+ *  - ticks that were lost
+ * while synthetic interrupt load and critical sections run in the background.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "os_tick.h"
+#include "tick_jitter.h"
+#include "tick_jitter_config.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define JITTER_HOST         1
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#else
+#define JITTER_HOST         0
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#if !defined(__CORTEX_M)
+#include "irq_ctrl.h"
+#endif
+#endif
+
+// SysTick_Handler is provided on Cortex-M (no RTOS kernel defines it)
+#ifndef JITTER_SYSTICK_HANDLER
+#if defined(SysTick_LOAD_RELOAD_Msk)
+#define JITTER_SYSTICK_HANDLER      1
+#else
+#define JITTER_SYSTICK_HANDLER      0
+#endif
+#endif
+
+#define SCENARIO_IRQ        0x01U       // Interrupt load
+#define SCENARIO_CRITICAL   0x02U       // Critical sections
+
+// Samples of the current scenario
+static int32_t           Latency[JITTER_TICKS];
+static int32_t           Period [JITTER_TICKS];
+static uint32_t          Hist   [JITTER_HIST_BINS];
+static uint32_t          Hist2  [JITTER_HIST_BINS];
+
+// Tick handler state
+static volatile uint32_t TickCount;
+static uint32_t          TickMissed;
+static uint32_t          TickIndex;
+static uint64_t          TickBase;
+static uint64_t          TickLast;
+static uint32_t          Interval;
+
+// Load state
+static uint32_t          Random = 0x12345678U;
+static volatile uint32_t LoadCounts;
+static volatile uint32_t LoadCount;
+
+
+//  ==== Interrupt masking and load interrupt porting ====
+
+#if   (JITTER_HOST != 0)
+
+// Host threads emulate interrupts: the tick and load "interrupts" are mutually exclusive
+// and critical sections exclude both
+static pthread_mutex_t JitterMutex = PTHREAD_MUTEX_INITIALIZER;
+static sem_t           IrqSem;
+
+static inline uint32_t JITTER_Lock (void) {
+  (void)pthread_mutex_lock(&JitterMutex);
+  return 0U;
+}
+
+static inline void JITTER_Unlock (uint32_t lock) {
+  (void)lock;
+  (void)pthread_mutex_unlock(&JitterMutex);
+}
+
+static void *JITTER_IrqThread (void *arg) {
+  uint32_t lock;
+  (void)arg;
+
+  for (;;) {
+    if (sem_wait(&IrqSem) == 0) {
+      lock = JITTER_Lock();
+      Tick_Jitter_LoadIRQHandler();
+      JITTER_Unlock(lock);
+    }
+  }
+  return NULL;
+}
+
+static int32_t JITTER_IrqInit (void) {
+  static uint8_t started = 0U;
+  pthread_t      thread;
+
+  if (started == 0U) {
+    if ((sem_init(&IrqSem, 0, 0U) != 0) ||
+        (pthread_create(&thread, NULL, JITTER_IrqThread, NULL) != 0)) {
+      return (-1);
+    }
+    (void)pthread_detach(thread);
+    started = 1U;
+  }
+  return (0);
+}
+
+static void JITTER_IrqTrigger (void) {
+  (void)sem_post(&IrqSem);
+}
+
+// Busy waits read the host clock directly (OS Tick timer clock of os_tick_posix.c), since polling
+// OS_Tick_GetTimestamp64 would contend with the timer thread
+static inline uint64_t JITTER_Time (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Gaps between load events sleep, so that the timer thread also runs on a single CPU host
+static void JITTER_Idle (uint32_t counts) {
+  struct timespec ts;
+
+  ts.tv_sec  = 0;
+  ts.tv_nsec = (long)(counts % 1000000000U);
+  (void)nanosleep(&ts, NULL);
+}
+
+#elif defined(__CORTEX_M)
+
+static inline uint32_t JITTER_Lock (void) {
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  return primask;
+}
+
+static inline void JITTER_Unlock (uint32_t lock) {
+  __set_PRIMASK(lock);
+}
+
+#if defined(JITTER_IRQn)
+static int32_t JITTER_IrqInit (void) {
+  NVIC_SetPriority((IRQn_Type)JITTER_IRQn, JITTER_IRQ_PRIORITY);
+  NVIC_ClearPendingIRQ((IRQn_Type)JITTER_IRQn);
+  NVIC_EnableIRQ((IRQn_Type)JITTER_IRQn);
+  return (0);
+}
+
+static void JITTER_IrqTrigger (void) {
+  NVIC_SetPendingIRQ((IRQn_Type)JITTER_IRQn);
+}
+#endif
+
+#else
+
+static inline uint32_t JITTER_Lock (void) {
+  uint32_t cpsr = __get_CPSR();
+
+  __disable_irq();
+  return cpsr;
+}
+
+static inline void JITTER_Unlock (uint32_t lock) {
+  if ((lock & CPSR_I_Msk) == 0U) {
+    __enable_irq();
+  }
+}
+
+#if defined(JITTER_IRQn)
+static int32_t JITTER_IrqInit (void) {
+  if ((IRQ_SetHandler((IRQn_ID_t)JITTER_IRQn, Tick_Jitter_LoadIRQHandler) != 0) ||
+      (IRQ_SetPriority((IRQn_ID_t)JITTER_IRQn, JITTER_IRQ_PRIORITY)   != 0) ||
+      (IRQ_Enable     ((IRQn_ID_t)JITTER_IRQn)                        != 0)) {
+    return (-1);
+  }
+  return (0);
+}
+
+static void JITTER_IrqTrigger (void) {
+  if (JITTER_IRQn < 16) {
+    // Software generated interrupt to this CPU
+    GIC_SendSGI((IRQn_Type)JITTER_IRQn, 0U, 2U);
+  } else {
+    (void)IRQ_SetPending((IRQn_ID_t)JITTER_IRQn);
+  }
+}
+#endif
+
+#endif
+
+#if (JITTER_HOST == 0) && !defined(JITTER_IRQn)
+static int32_t JITTER_IrqInit (void) {
+  return (-1);
+}
+
+static void JITTER_IrqTrigger (void) {
+}
+#endif
+
+#if (JITTER_HOST == 0)
+static inline uint64_t JITTER_Time (void) {
+  return OS_Tick_GetTimestamp64();
+}
+
+#define JITTER_Idle(counts)     JITTER_Busy(counts)
+#endif
+
+#if (JITTER_SYSTICK_HANDLER != 0)
+/// SysTick interrupt handler.
+void SysTick_Handler (void);
+void SysTick_Handler (void) {
+  Tick_Jitter_TickHandler();
+}
+#endif
+
+
+//  ==== Load generation ====
+
+// Pseudo random number (xorshift32).
+static uint32_t JITTER_Random (void) {
+  uint32_t x = Random;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  Random = x;
+  return x;
+}
+
+// Busy wait for the specified number of timer counts.
+static void JITTER_Busy (uint32_t counts) {
+  uint64_t start = JITTER_Time();
+
+  while ((JITTER_Time() - start) < counts) {}
+}
+
+// Convert microseconds to timer counts (limited to a quarter of the tick period).
+static uint32_t JITTER_Counts (uint32_t us, uint32_t limit) {
+  uint64_t counts = ((uint64_t)us * OS_Tick_GetClock()) / 1000000U;
+
+  if ((limit != 0U) && (counts > (Interval / 4U))) {
+    counts = Interval / 4U;
+  }
+  return ((counts != 0U) ? (uint32_t)counts : 1U);
+}
+
+/// Load interrupt handler.
+void Tick_Jitter_LoadIRQHandler (void) {
+  JITTER_Busy(LoadCounts);
+  LoadCount++;
+}
+
+
+//  ==== Tick measurement ====
+
+/// OS Tick interrupt handler.
+void Tick_Jitter_TickHandler (void) {
+  uint32_t latency;
+  uint32_t ticks;
+  uint32_t count;
+  uint64_t timestamp;
+  uint64_t ideal;
+#if (JITTER_HOST != 0)
+  uint32_t lock = JITTER_Lock();
+#endif
+
+  latency   = OS_Tick_GetCount();
+  timestamp = OS_Tick_GetTimestamp64();
+  OS_Tick_AcknowledgeIRQ();
+
+  count = TickCount;
+  if (count == 0U) {
+    // Reference tick: tick event time defines the ideal tick grid
+    TickBase  = timestamp - latency;
+    TickIndex = 0U;
+  } else if (count <= JITTER_TICKS) {
+    // Ideal time of the next tick event; later events were lost
+    ticks = 1U;
+    TickIndex++;
+    ideal = TickBase + ((uint64_t)TickIndex * Interval);
+    while ((timestamp - latency) >= (ideal + Interval)) {
+      ideal += Interval;
+      TickIndex++;
+      TickMissed++;
+      ticks++;
+    }
+    Latency[count - 1U] = (int32_t)latency;
+    Period [count - 1U] = (int32_t)((int64_t)(timestamp - TickLast) - ((int64_t)ticks * Interval));
+  } else {
+    // Scenario complete
+    count = JITTER_TICKS;
+  }
+  TickLast  = timestamp;
+  TickCount = count + 1U;
+
+#if (JITTER_HOST != 0)
+  JITTER_Unlock(lock);
+#endif
+}
+
+
+//  ==== Statistics ====
+
+static int CompareSample (const void *a, const void *b) {
+  int32_t x = *(const int32_t *)a;
+  int32_t y = *(const int32_t *)b;
+
+  return ((x > y) - (x < y));
+}
+
+// Calculate statistics and histogram of the collected samples.
+static void JITTER_Statistics (int32_t *samples, uint32_t count, uint32_t *hist, Tick_Jitter_Stat_t *stat) {
+  int64_t  sum = 0;
+  uint32_t range;
+  uint32_t n;
+
+  qsort(samples, count, sizeof(int32_t), CompareSample);
+
+  for (n = 0U; n < count; n++) {
+    sum += samples[n];
+  }
+  stat->count = count;
+  stat->min   = samples[0];
+  stat->max   = samples[count - 1U];
+  stat->avg   = (int32_t)(sum / (int64_t)count);
+  stat->p50   = samples[((count - 1U) * 50U) / 100U];
+  stat->p99   = samples[((count - 1U) * 99U) / 100U];
+
+  // Bin width covers the sample range with all bins
+  range = (uint32_t)(stat->max - stat->min) + 1U;
+  stat->hist_start = stat->min;
+  stat->hist_width = (range + (JITTER_HIST_BINS - 1U)) / JITTER_HIST_BINS;
+  stat->hist_bins  = JITTER_HIST_BINS;
+  stat->hist       = hist;
+  for (n = 0U; n < JITTER_HIST_BINS; n++) {
+    hist[n] = 0U;
+  }
+  for (n = 0U; n < count; n++) {
+    hist[(uint32_t)(samples[n] - stat->min) / stat->hist_width]++;
+  }
+}
+
+// Convert timer counts to nanoseconds.
+static long JITTER_Nanoseconds (int32_t counts, uint32_t clock) {
+  return (long)(((int64_t)counts * 1000000000) / (int64_t)clock);
+}
+
+// Print statistics and histogram.
+static void JITTER_PrintStat (const char *name, const Tick_Jitter_Stat_t *stat, uint32_t clock) {
+  uint32_t peak = 0U;
+  uint32_t bar;
+  uint32_t n, k;
+  int32_t  lo;
+
+  printf("  %s [counts]: min %ld, avg %ld, p50 %ld, p99 %ld, max %ld (max %ld ns)\n", name,
+         (long)stat->min, (long)stat->avg, (long)stat->p50, (long)stat->p99, (long)stat->max,
+         JITTER_Nanoseconds(stat->max, clock));
+
+  for (n = 0U; n < stat->hist_bins; n++) {
+    if (stat->hist[n] > peak) {
+      peak = stat->hist[n];
+    }
+  }
+  for (n = 0U; n < stat->hist_bins; n++) {
+    if (stat->hist[n] == 0U) {
+      continue;
+    }
+    lo  = stat->hist_start + (int32_t)(n * stat->hist_width);
+    bar = ((stat->hist[n] * 40U) + (peak - 1U)) / peak;
+    printf("    %8ld..%8ld %6lu |", (long)lo, (long)(lo + (int32_t)stat->hist_width - 1),
+           (unsigned long)stat->hist[n]);
+    for (k = 0U; k < bar; k++) {
+      putchar('#');
+    }
+    putchar('\n');
+  }
+}
+
+// Print the result of a scenario.
+static void JITTER_Print (const char *scenario, const Tick_Jitter_Result_t *result) {
+  if (result == NULL) {
+    printf("%s: skipped\n", scenario);
+    return;
+  }
+  printf("%s: %lu ticks, %lu missed (period %lu counts, clock %lu Hz)\n", scenario,
+         (unsigned long)result->latency.count, (unsigned long)result->missed,
+         (unsigned long)result->interval, (unsigned long)result->clock);
+  JITTER_PrintStat("latency", &result->latency, result->clock);
+  JITTER_PrintStat("period ", &result->period,  result->clock);
+}
+
+
+//  ==== Scenarios ====
+
+static const struct {
+  const char *name;
+  uint32_t    flags;
+} ScenarioList[] = {
+  { "idle",                           0U                               },
+  { "interrupt load",                 SCENARIO_IRQ                     },
+  { "critical sections",              SCENARIO_CRITICAL                },
+  { "interrupt load + critical",      SCENARIO_IRQ | SCENARIO_CRITICAL },
+};
+
+// Run a scenario until the samples are collected.
+static void JITTER_Scenario (uint32_t flags) {
+  uint32_t critical_max = JITTER_Counts(JITTER_CRITICAL_MAX_US, 1U);
+  uint32_t load_max     = JITTER_Counts(JITTER_LOAD_MAX_US,     1U);
+  uint32_t gap_max      = JITTER_Counts(JITTER_GAP_MAX_US,      0U);
+  uint32_t lock;
+  uint32_t r;
+
+  TickCount  = 0U;
+  TickMissed = 0U;
+  LoadCount  = 0U;
+  OS_Tick_Enable();
+
+  while (TickCount <= JITTER_TICKS) {
+    JITTER_Idle(JITTER_Random() % gap_max);
+    r = JITTER_Random();
+    if (((flags & SCENARIO_IRQ) != 0U) && (((flags & SCENARIO_CRITICAL) == 0U) || ((r & 1U) != 0U))) {
+      LoadCounts = (r >> 1) % load_max;
+      JITTER_IrqTrigger();
+    } else if ((flags & SCENARIO_CRITICAL) != 0U) {
+      lock = JITTER_Lock();
+      JITTER_Busy((r >> 1) % critical_max);
+      JITTER_Unlock(lock);
+    }
+  }
+
+  OS_Tick_Disable();
+}
+
+/// Run all scenarios.
+uint32_t Tick_Jitter_Run (Tick_Jitter_Report_t report) {
+  Tick_Jitter_Result_t result;
+  uint32_t failed = 0U;
+  int32_t  irq;
+  uint32_t i;
+
+  if (report == NULL) {
+    report = JITTER_Print;
+  }
+
+  if (OS_Tick_Setup(JITTER_TICK_FREQ, Tick_Jitter_TickHandler) != 0) {
+    return (sizeof(ScenarioList) / sizeof(ScenarioList[0]));
+  }
+  Interval = OS_Tick_GetInterval();
+  irq      = JITTER_IrqInit();
+
+  for (i = 0U; i < (sizeof(ScenarioList) / sizeof(ScenarioList[0])); i++) {
+    if (((ScenarioList[i].flags & SCENARIO_IRQ) != 0U) && (irq != 0)) {
+      report(ScenarioList[i].name, NULL);
+      failed++;
+      continue;
+    }
+    JITTER_Scenario(ScenarioList[i].flags);
+
+    result.clock    = OS_Tick_GetClock();
+    result.interval = Interval;
+    result.missed   = TickMissed;
+    JITTER_Statistics(Latency, JITTER_TICKS, Hist,  &result.latency);
+    JITTER_Statistics(Period,  JITTER_TICKS, Hist2, &result.period);
+    report(ScenarioList[i].name, &result);
+  }
+
+  return failed;
+}
+
+#ifdef JITTER_MAIN
+int main (void) {
+  printf("OS Tick jitter: %u Hz, %u ticks per scenario\n",
+         (unsigned int)JITTER_TICK_FREQ, (unsigned int)JITTER_TICKS);
+  return (int)Tick_Jitter_Run(NULL);
+}
+#endif
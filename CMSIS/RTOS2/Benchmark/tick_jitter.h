@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 Benchmark
+ * Title:       OS Tick jitter harness interface definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef TICK_JITTER_H_
+#define TICK_JITTER_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Tick jitter statistics (timer counts).
+typedef struct {
+  uint32_t        count;                ///< Number of samples
+  int32_t         min;                  ///< Minimum
+  int32_t         avg;                  ///< Average
+  int32_t         p50;                  ///< 50th percentile (median)
+  int32_t         p99;                  ///< 99th percentile
+  int32_t         max;                  ///< Maximum
+  int32_t         hist_start;           ///< Lower bound of the first histogram bin
+  uint32_t        hist_width;           ///< Width of a histogram bin
+  uint32_t        hist_bins;            ///< Number of histogram bins
+  const uint32_t *hist;                 ///< Number of samples per histogram bin
+} Tick_Jitter_Stat_t;
+
+/// Tick jitter result of a scenario.
+typedef struct {
+  uint32_t           clock;             ///< Timer clock frequency in Hz
+  uint32_t           interval;          ///< Tick period in timer counts
+  uint32_t           missed;            ///< Number of ticks without interrupt
+  Tick_Jitter_Stat_t latency;           ///< Timer counts from tick event to handler entry
+  Tick_Jitter_Stat_t period;            ///< Deviation of the time between handler entries from the tick period (signed)
+} Tick_Jitter_Result_t;
+
+/// Tick jitter result callback (called for each scenario).
+/// \param[in]     scenario      scenario name.
+/// \param[in]     result        scenario result or NULL if the scenario was skipped.
+typedef void (*Tick_Jitter_Report_t) (const char *scenario, const Tick_Jitter_Result_t *result);
+
+/// Run all scenarios (OS Tick must not be used by an RTOS kernel).
+/// \param[in]     report        result callback or NULL to print histograms with printf.
+/// \return number of scenarios that failed or were skipped.
+uint32_t Tick_Jitter_Run (Tick_Jitter_Report_t report);
+
+/// OS Tick interrupt handler (installed with OS_Tick_Setup).
+void Tick_Jitter_TickHandler (void);
+
+/// Load interrupt handler (install as handler of JITTER_IRQn on Cortex-M).
+void Tick_Jitter_LoadIRQHandler (void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // TICK_JITTER_H_
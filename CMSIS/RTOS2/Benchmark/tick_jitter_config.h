@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Revision:   V1.0.0
+ *
+ * Project:     CMSIS-RTOS2 Benchmark
+ * Title:       OS Tick jitter harness configuration definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef TICK_JITTER_CONFIG_H_
+#define TICK_JITTER_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>Tick Jitter Configuration
+// ============================
+
+//   <o>Tick Frequency [Hz] <1-1000000>
+//   <i> Defines the OS Tick frequency used for the measurement.
+//   <i> Default: 1000
+#ifndef JITTER_TICK_FREQ
+#define JITTER_TICK_FREQ            1000
+#endif
+
+//   <o>Number of Ticks <10-100000>
+//   <i> Defines the number of ticks recorded per scenario.
+//   <i> Sample memory: 8 bytes per tick.
+//   <i> Default: 1000
+#ifndef JITTER_TICKS
+#define JITTER_TICKS                1000
+#endif
+
+//   <o>Histogram Bins <4-100>
+//   <i> Defines the number of histogram bins. The bin width is selected from the sample range.
+//   <i> Default: 16
+#ifndef JITTER_HIST_BINS
+#define JITTER_HIST_BINS            16
+#endif
+
+//   <o>Maximum Critical Section [us] <1-100000>
+//   <i> Defines the maximum duration of a critical section with interrupts disabled.
+//   <i> Limited to a quarter of the tick period.
+//   <i> Default: 50
+#ifndef JITTER_CRITICAL_MAX_US
+#define JITTER_CRITICAL_MAX_US      50
+#endif
+
+//   <o>Maximum Load Interrupt Duration [us] <1-100000>
+//   <i> Defines the maximum execution time of the load interrupt handler.
+//   <i> Limited to a quarter of the tick period.
+//   <i> Default: 20
+#ifndef JITTER_LOAD_MAX_US
+#define JITTER_LOAD_MAX_US          20
+#endif
+
+//   <o>Maximum Load Gap [us] <1-1000000>
+//   <i> Defines the maximum time between two load events (interrupt or critical section).
+//   <i> Default: 200
+#ifndef JITTER_GAP_MAX_US
+#define JITTER_GAP_MAX_US           200
+#endif
+
+// </h>
+
+// <h>Load Interrupt Configuration
+// ===============================
+// <i> The interrupt load uses a software triggered interrupt.
+// <i> Cortex-M: Tick_Jitter_LoadIRQHandler must be installed as handler of this interrupt.
+// <i> Cortex-A: the handler is installed with IRQ_SetHandler; SGI 0..15 are suitable.
+// <i> The load scenarios are skipped when JITTER_IRQn is not defined (target builds).
+
+//   <o>Interrupt Number <0-1019>
+//   <i> Defines an unused interrupt (IRQn).
+//#define JITTER_IRQn                 0
+
+//   <o>Interrupt Priority <0-255>
+//   <i> Defines the priority of the load interrupt (0: highest).
+//   <i> The OS Tick interrupt has the lowest priority, so any value delays the tick.
+//   <i> Default: 0
+#ifndef JITTER_IRQ_PRIORITY
+#define JITTER_IRQ_PRIORITY         0
+#endif
+
+// </h>
+
+//------------- <<< end of configuration section >>> ---------------------------
+
+#endif  // TICK_JITTER_CONFIG_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,12 +17,42 @@
  *
  * ----------------------------------------------------------------------
  *
- * $Date:        30. June 2023
- * $Revision:    V2.3.0
+ * $Date:        17. October 2024
+ * $Revision:    V2.4.0
  *
  * Project:      CMSIS-RTOS2 API
  * Title:        cmsis_os2.h header file
  *
+ * Version 2.4.0
+ *    Added batched Message Queue functions:
+ *    - osMessageQueuePutN, osMessageQueueGetN
+ *    Added zero-copy Message Queue functions:
+ *    - osMessageQueueAcquire, osMessageQueueCommit
+ *    - osMessageQueueBorrow, osMessageQueueRelease
+ *    Added execution time accounting:
+ *    - osThreadGetRuntime, osKernelGetIdleRuntime
+ *    Added multiple object wait functions:
+ *    - osWaitAny, osWaitAll
+ *    Added Reader-Writer Lock object:
+ *    - osRwLockNew, osRwLockGetName, osRwLockAcquireShared,
+ *      osRwLockAcquireExclusive, osRwLockRelease, osRwLockGetOwner,
+ *      osRwLockDelete
+ *    Added Stream Buffer object:
+ *    - osStreamBufferNew, osStreamBufferGetName, osStreamBufferWrite,
+ *      osStreamBufferRead, osStreamBufferGetSpan, osStreamBufferConsume,
+ *      osStreamBufferSetTriggerLevel, osStreamBufferGetCapacity,
+ *      osStreamBufferGetCount, osStreamBufferGetSpace,
+ *      osStreamBufferReset, osStreamBufferDelete
+ *    Added Work Queue object (deferred work):
+ *    - osWorkQueueNew, osWorkQueueGetName, osWorkQueueGetCount,
+ *      osWorkQueueDelete
+ *    - osWorkNew, osWorkGetName, osWorkSubmit, osWorkSubmitDelayed,
+ *      osWorkCancel, osWorkIsPending, osWorkDelete
+ *    Added Memory Pool caching (per-thread/per-processor magazines):
+ *    - osMemoryPoolAttr_t: cache_depth
+ *    - osMemoryPoolGetStats
+ *    Added sub-tick delays (System Timer resolution):
+ *    - osDelayUs, osDelayUntilSysTimer
  * Version 2.3.0
  *    Added provisional support for processor affinity in SMP systems:
       - osThreadAttr_t: affinity_mask
@@ -183,6 +213,9 @@ typedef void (*osThreadFunc_t) (void *argument);
 /// Timer callback function.
 typedef void (*osTimerFunc_t) (void *argument);
  
+/// Work item function.
+typedef void (*osWorkFunc_t) (void *argument);
+ 
 /// Timer type.
 typedef enum {
   osTimerOnce             = 0,          ///< One-shot timer.
@@ -266,6 +299,9 @@ typedef void *osEventFlagsId_t;
 /// \details Mutex ID identifies the mutex.
 typedef void *osMutexId_t;
  
+/// \details Reader-Writer Lock ID identifies the reader-writer lock.
+typedef void *osRwLockId_t;
+ 
 /// \details Semaphore ID identifies the semaphore.
 typedef void *osSemaphoreId_t;
  
@@ -275,6 +311,15 @@ typedef void *osMemoryPoolId_t;
 /// \details Message Queue ID identifies the message queue.
 typedef void *osMessageQueueId_t;
  
+/// \details Stream Buffer ID identifies the stream buffer.
+typedef void *osStreamBufferId_t;
+ 
+/// \details Work Queue ID identifies the work queue.
+typedef void *osWorkQueueId_t;
+ 
+/// \details Work ID identifies the work item.
+typedef void *osWorkId_t;
+ 
  
 #ifndef TZ_MODULEID_T
 #define TZ_MODULEID_T
@@ -320,6 +365,14 @@ typedef struct {
   uint32_t                   cb_size;   ///< size of provided memory for control block
 } osMutexAttr_t;
  
+/// Attributes structure for reader-writer lock.
+typedef struct {
+  const char                   *name;   ///< name of the reader-writer lock
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osRwLockAttr_t;
+ 
 /// Attributes structure for semaphore.
 typedef struct {
   const char                   *name;   ///< name of the semaphore
@@ -336,8 +389,19 @@ typedef struct {
   uint32_t                   cb_size;   ///< size of provided memory for control block
   void                      *mp_mem;    ///< memory for data storage
   uint32_t                   mp_size;   ///< size of provided memory for data storage 
+  uint32_t               cache_depth;   ///< number of blocks cached per thread or processor (0: no cache)
 } osMemoryPoolAttr_t;
  
+/// Memory Pool statistics (\ref osMemoryPoolGetStats).
+typedef struct {
+  uint32_t               alloc_count;   ///< number of allocations
+  uint32_t                alloc_hits;   ///< number of allocations served from a cache
+  uint32_t                free_count;   ///< number of returned memory blocks
+  uint32_t                 free_hits;   ///< number of returned memory blocks kept in a cache
+  uint32_t                    cached;   ///< number of memory blocks currently held in caches
+  uint32_t                  max_used;   ///< high-water mark of memory blocks taken from the pool (used or cached)
+} osMemoryPoolStats_t;
+ 
 /// Attributes structure for message queue.
 typedef struct {
   const char                   *name;   ///< name of the message queue
@@ -348,6 +412,36 @@ typedef struct {
   uint32_t                   mq_size;   ///< size of provided memory for data storage 
 } osMessageQueueAttr_t;
  
+/// Attributes structure for stream buffer.
+typedef struct {
+  const char                   *name;   ///< name of the stream buffer
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                      *sb_mem;    ///< memory for data storage
+  uint32_t                   sb_size;   ///< size of provided memory for data storage
+} osStreamBufferAttr_t;
+ 
+/// Attributes structure for work queue.
+typedef struct {
+  const char                   *name;   ///< name of the work queue
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  uint32_t                stack_size;   ///< stack size of each worker thread
+  osPriority_t              priority;   ///< worker thread priority (default: osPriorityNormal)
+  uint32_t                   workers;   ///< number of worker threads (default: 1)
+  uint32_t                     lanes;   ///< number of priority lanes (default: 1)
+} osWorkQueueAttr_t;
+ 
+/// Attributes structure for work item.
+typedef struct {
+  const char                   *name;   ///< name of the work item
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osWorkAttr_t;
+ 
  
 //  ==== Kernel Management Functions ====
  
@@ -418,6 +512,10 @@ uint32_t osKernelGetSysTimerCount (void);
 /// \return frequency of the system timer in hertz, i.e. timer ticks per second.
 uint32_t osKernelGetSysTimerFreq (void);
  
+/// Get the accumulated idle time of the RTOS kernel.
+/// \return execution time of the idle state in runtime counter units.
+uint64_t osKernelGetIdleRuntime (void);
+ 
  
 //  ==== Thread Management Functions ====
  
@@ -462,6 +560,11 @@ uint32_t osThreadGetStackSize (osThreadId_t thread_id);
 /// \return remaining stack space in bytes.
 uint32_t osThreadGetStackSpace (osThreadId_t thread_id);
  
+/// Get the accumulated execution time of a thread.
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+/// \return execution time in runtime counter units or 0 if not available.
+uint64_t osThreadGetRuntime (osThreadId_t thread_id);
+ 
 /// Change priority of a thread.
 /// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
 /// \param[in]     priority      new priority value for the thread function.
@@ -590,6 +693,30 @@ osStatus_t osDelay (uint32_t ticks);
 /// \return status code that indicates the execution status of the function.
 osStatus_t osDelayUntil (uint32_t ticks);
  
+/// Wait for Timeout in microseconds (sub-tick Delay).
+/// \param[in]     usec          time delay value in microseconds
+/// \return status code that indicates the execution status of the function.
+osStatus_t osDelayUs (uint32_t usec);
+ 
+/// Wait until specified system timer count (sub-tick Delay).
+/// \param[in]     count         absolute time in system timer counts
+/// \return status code that indicates the execution status of the function.
+osStatus_t osDelayUntilSysTimer (uint32_t count);
+ 
+/// Wait until any of the specified objects is ready.
+/// \param[in]     object_ids    array of Event Flags, Mutex, Semaphore, Memory Pool or Message Queue IDs.
+/// \param[in]     count         number of IDs in object_ids.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return index of the ready object in object_ids or error code (negative value).
+int32_t osWaitAny (void * const *object_ids, uint32_t count, uint32_t timeout);
+ 
+/// Wait until all of the specified objects are ready.
+/// \param[in]     object_ids    array of Event Flags, Mutex, Semaphore, Memory Pool or Message Queue IDs.
+/// \param[in]     count         number of IDs in object_ids.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osWaitAll (void * const *object_ids, uint32_t count, uint32_t timeout);
+ 
  
 //  ==== Timer Management Functions ====
  
@@ -705,6 +832,46 @@ osThreadId_t osMutexGetOwner (osMutexId_t mutex_id);
 osStatus_t osMutexDelete (osMutexId_t mutex_id);
  
  
+//  ==== Reader-Writer Lock Management Functions ====
+ 
+/// Create and Initialize a Reader-Writer Lock object.
+/// \param[in]     attr          reader-writer lock attributes; NULL: default values.
+/// \return reader-writer lock ID for reference by other functions or NULL in case of error.
+osRwLockId_t osRwLockNew (const osRwLockAttr_t *attr);
+ 
+/// Get name of a Reader-Writer Lock object.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \return name as null-terminated string.
+const char *osRwLockGetName (osRwLockId_t rwlock_id);
+ 
+/// Acquire a Reader-Writer Lock for shared access or timeout if it is locked for exclusive access.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osRwLockAcquireShared (osRwLockId_t rwlock_id, uint32_t timeout);
+ 
+/// Acquire a Reader-Writer Lock for exclusive access or timeout if it is locked.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osRwLockAcquireExclusive (osRwLockId_t rwlock_id, uint32_t timeout);
+ 
+/// Release a Reader-Writer Lock that was acquired by \ref osRwLockAcquireShared or \ref osRwLockAcquireExclusive.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osRwLockRelease (osRwLockId_t rwlock_id);
+ 
+/// Get Thread which owns a Reader-Writer Lock for exclusive access.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \return thread ID of owner thread or NULL when the lock is not acquired for exclusive access.
+osThreadId_t osRwLockGetOwner (osRwLockId_t rwlock_id);
+ 
+/// Delete a Reader-Writer Lock object.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osRwLockDelete (osRwLockId_t rwlock_id);
+ 
+ 
 //  ==== Semaphore Management Functions ====
  
 /// Create and Initialize a Semaphore object.
@@ -787,6 +954,12 @@ uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id);
 /// \return number of memory blocks available.
 uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id);
  
+/// Get statistics of a Memory Pool.
+/// \param[in]     mp_id         memory pool ID obtained by \ref osMemoryPoolNew.
+/// \param[out]    stats         pointer to buffer for the statistics.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osMemoryPoolGetStats (osMemoryPoolId_t mp_id, osMemoryPoolStats_t *stats);
+ 
 /// Delete a Memory Pool object.
 /// \param[in]     mp_id         memory pool ID obtained by \ref osMemoryPoolNew.
 /// \return status code that indicates the execution status of the function.
@@ -823,6 +996,50 @@ osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uin
 /// \return status code that indicates the execution status of the function.
 osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
  
+/// Put multiple Messages into a Queue or timeout if Queue is full.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     msg_ptr       pointer to buffer with consecutive messages to put into a queue.
+/// \param[in]     msg_count     number of messages to put into a queue.
+/// \param[in]     msg_prio      message priority.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return number of messages put into the queue.
+uint32_t osMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio, uint32_t timeout);
+ 
+/// Get multiple Messages from a Queue or timeout if Queue is empty.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[out]    msg_ptr       pointer to buffer for consecutive messages to get from a queue.
+/// \param[in]     msg_count     maximum number of messages to get from a queue.
+/// \param[out]    msg_prio      pointer to buffer for message priorities (one per message) or NULL.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return number of messages retrieved from the queue.
+uint32_t osMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint8_t *msg_prio, uint32_t timeout);
+ 
+/// Acquire a free Message slot in a Queue or timeout if Queue is full.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return pointer to the message slot or NULL in case of error.
+void *osMessageQueueAcquire (osMessageQueueId_t mq_id, uint32_t timeout);
+ 
+/// Commit an acquired Message slot to a Queue.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     msg_ptr       pointer to the message slot obtained by \ref osMessageQueueAcquire.
+/// \param[in]     msg_prio      message priority.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio);
+ 
+/// Borrow a Message from a Queue for in-place reading or timeout if Queue is empty.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[out]    msg_prio      pointer to buffer for message priority or NULL.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return pointer to the borrowed message or NULL in case of error.
+void *osMessageQueueBorrow (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout);
+ 
+/// Release a borrowed or an unused acquired Message slot back to a Queue.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     msg_ptr       pointer to the message slot obtained by \ref osMessageQueueBorrow or \ref osMessageQueueAcquire.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr);
+ 
 /// Get maximum number of messages in a Message Queue.
 /// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
 /// \return maximum number of messages.
@@ -854,6 +1071,146 @@ osStatus_t osMessageQueueReset (osMessageQueueId_t mq_id);
 osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id);
  
  
+//  ==== Stream Buffer Management Functions ====
+ 
+/// Create and Initialize a Stream Buffer object.
+/// \param[in]     size          capacity of the stream buffer in bytes.
+/// \param[in]     trigger_level number of bytes that release a waiting reader (0 or 1: any data).
+/// \param[in]     attr          stream buffer attributes; NULL: default values.
+/// \return stream buffer ID for reference by other functions or NULL in case of error.
+osStreamBufferId_t osStreamBufferNew (uint32_t size, uint32_t trigger_level, const osStreamBufferAttr_t *attr);
+ 
+/// Get name of a Stream Buffer object.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \return name as null-terminated string.
+const char *osStreamBufferGetName (osStreamBufferId_t sb_id);
+ 
+/// Write data into a Stream Buffer or timeout if the Stream Buffer is full.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \param[in]     data          pointer to the data to write.
+/// \param[in]     size          number of bytes to write.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return number of bytes written into the stream buffer.
+uint32_t osStreamBufferWrite (osStreamBufferId_t sb_id, const void *data, uint32_t size, uint32_t timeout);
+ 
+/// Read data from a Stream Buffer or timeout if less than the trigger level is available.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \param[out]    data          pointer to buffer for the data to read.
+/// \param[in]     size          maximum number of bytes to read.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return number of bytes read from the stream buffer.
+uint32_t osStreamBufferRead (osStreamBufferId_t sb_id, void *data, uint32_t size, uint32_t timeout);
+ 
+/// Get the contiguous span of readable data in a Stream Buffer or timeout if less than the trigger level is available.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \param[out]    size          pointer to buffer for the number of bytes in the span.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return pointer to the first byte of the span or NULL in case of error or no data.
+void *osStreamBufferGetSpan (osStreamBufferId_t sb_id, uint32_t *size, uint32_t timeout);
+ 
+/// Consume data from a Stream Buffer that was obtained by \ref osStreamBufferGetSpan.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \param[in]     size          number of bytes to remove from the stream buffer.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osStreamBufferConsume (osStreamBufferId_t sb_id, uint32_t size);
+ 
+/// Set the trigger level of a Stream Buffer.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \param[in]     trigger_level number of bytes that release a waiting reader (0 or 1: any data).
+/// \return status code that indicates the execution status of the function.
+osStatus_t osStreamBufferSetTriggerLevel (osStreamBufferId_t sb_id, uint32_t trigger_level);
+ 
+/// Get capacity of a Stream Buffer.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \return capacity in bytes.
+uint32_t osStreamBufferGetCapacity (osStreamBufferId_t sb_id);
+ 
+/// Get number of bytes stored in a Stream Buffer.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \return number of bytes available for reading.
+uint32_t osStreamBufferGetCount (osStreamBufferId_t sb_id);
+ 
+/// Get number of free bytes in a Stream Buffer.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \return number of bytes available for writing.
+uint32_t osStreamBufferGetSpace (osStreamBufferId_t sb_id);
+ 
+/// Reset a Stream Buffer to initial empty state.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osStreamBufferReset (osStreamBufferId_t sb_id);
+ 
+/// Delete a Stream Buffer object.
+/// \param[in]     sb_id         stream buffer ID obtained by \ref osStreamBufferNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osStreamBufferDelete (osStreamBufferId_t sb_id);
+ 
+ 
+//  ==== Work Queue Management Functions ====
+ 
+/// Create and Initialize a Work Queue object with its worker threads.
+/// \param[in]     attr          work queue attributes; NULL: default values.
+/// \return work queue ID for reference by other functions or NULL in case of error.
+osWorkQueueId_t osWorkQueueNew (const osWorkQueueAttr_t *attr);
+ 
+/// Get name of a Work Queue object.
+/// \param[in]     wq_id         work queue ID obtained by \ref osWorkQueueNew.
+/// \return name as null-terminated string.
+const char *osWorkQueueGetName (osWorkQueueId_t wq_id);
+ 
+/// Get number of work items queued in a Work Queue.
+/// \param[in]     wq_id         work queue ID obtained by \ref osWorkQueueNew.
+/// \return number of queued work items (excluding delayed work items).
+uint32_t osWorkQueueGetCount (osWorkQueueId_t wq_id);
+ 
+/// Delete a Work Queue object.
+/// \param[in]     wq_id         work queue ID obtained by \ref osWorkQueueNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osWorkQueueDelete (osWorkQueueId_t wq_id);
+ 
+/// Create and Initialize a work item.
+/// \param[in]     func          work item function.
+/// \param[in]     argument      pointer that is passed to the work item function as argument.
+/// \param[in]     attr          work item attributes; NULL: default values.
+/// \return work ID for reference by other functions or NULL in case of error.
+osWorkId_t osWorkNew (osWorkFunc_t func, void *argument, const osWorkAttr_t *attr);
+ 
+/// Get name of a work item.
+/// \param[in]     work_id       work ID obtained by \ref osWorkNew.
+/// \return name as null-terminated string.
+const char *osWorkGetName (osWorkId_t work_id);
+ 
+/// Submit a work item to a Work Queue.
+/// \param[in]     wq_id         work queue ID obtained by \ref osWorkQueueNew.
+/// \param[in]     work_id       work ID obtained by \ref osWorkNew.
+/// \param[in]     lane          priority lane (0 .. lanes-1; higher lanes execute first).
+/// \return status code that indicates the execution status of the function.
+osStatus_t osWorkSubmit (osWorkQueueId_t wq_id, osWorkId_t work_id, uint32_t lane);
+ 
+/// Submit a work item to a Work Queue after a delay.
+/// \param[in]     wq_id         work queue ID obtained by \ref osWorkQueueNew.
+/// \param[in]     work_id       work ID obtained by \ref osWorkNew.
+/// \param[in]     lane          priority lane (0 .. lanes-1; higher lanes execute first).
+/// \param[in]     ticks         \ref CMSIS_RTOS_TimeOutValue "time ticks" value of the delay.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osWorkSubmitDelayed (osWorkQueueId_t wq_id, osWorkId_t work_id, uint32_t lane, uint32_t ticks);
+ 
+/// Cancel a pending (queued or delayed) work item.
+/// \param[in]     work_id       work ID obtained by \ref osWorkNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osWorkCancel (osWorkId_t work_id);
+ 
+/// Check if a work item is pending (queued or delayed).
+/// \param[in]     work_id       work ID obtained by \ref osWorkNew.
+/// \return 0 not pending, 1 pending.
+uint32_t osWorkIsPending (osWorkId_t work_id);
+ 
+/// Delete a work item.
+/// \param[in]     work_id       work ID obtained by \ref osWorkNew.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osWorkDelete (osWorkId_t work_id);
+ 
+ 
 //  ==== Handler Functions ====
  
 /// Handler for expired thread watchdogs.
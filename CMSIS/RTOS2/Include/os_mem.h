@@ -0,0 +1,95 @@
+/**************************************************************************//**
+ * @file     os_mem.h
+ * @brief    CMSIS OS Memory header file
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OS_MEM_H
+#define OS_MEM_H
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// \details Memory region ID identifies a memory region.
+typedef void *OS_Mem_RegionId_t;
+
+/// Memory region statistics
+typedef struct {
+  uint32_t                      size;   ///< size of the memory region in bytes (including control data)
+  uint32_t                      used;   ///< allocated bytes (including block headers)
+  uint32_t                  max_used;   ///< high-water mark of allocated bytes
+  uint32_t                free_bytes;   ///< free bytes (including block headers)
+  uint32_t              largest_free;   ///< size of the largest block that can be allocated
+  uint32_t               free_blocks;   ///< number of free blocks
+  uint32_t               alloc_count;   ///< number of successful allocations
+  uint32_t              alloc_failed;   ///< number of failed allocations
+  uint32_t                free_count;   ///< number of freed blocks
+  uint32_t             fragmentation;   ///< fragmentation of free memory in 0.1 % (0: one free block)
+} OS_Mem_Stats_t;
+
+/// Add a memory region
+/// \param[in]     name          name of the memory region (may be NULL).
+/// \param[in]     mem           start address of the memory region (8-byte aligned).
+/// \param[in]     size          size of the memory region in bytes.
+/// \return memory region ID or NULL in case of error.
+OS_Mem_RegionId_t OS_Mem_AddRegion (const char *name, void *mem, uint32_t size);
+
+/// Get a memory region by name
+/// \param[in]     name          name of the memory region or NULL for the default (first added) region.
+/// \return memory region ID or NULL when the region does not exist.
+OS_Mem_RegionId_t OS_Mem_GetRegion (const char *name);
+
+/// Get name of a memory region
+/// \param[in]     region        memory region ID obtained by \ref OS_Mem_AddRegion or \ref OS_Mem_GetRegion.
+/// \return name as null-terminated string or NULL in case of error.
+const char *OS_Mem_GetRegionName (OS_Mem_RegionId_t region);
+
+/// Allocate a memory block from a memory region
+/// \param[in]     region        memory region ID or NULL for the default region.
+/// \param[in]     size          size of the memory block in bytes.
+/// \return address of the allocated memory block (8-byte aligned) or NULL in case of no memory is available.
+void *OS_Mem_Alloc (OS_Mem_RegionId_t region, uint32_t size);
+
+/// Return an allocated memory block back to its memory region
+/// \param[in]     block         address of the allocated memory block.
+/// \return 0 on success, -1 on error (block not allocated by \ref OS_Mem_Alloc).
+int32_t OS_Mem_Free (void *block);
+
+/// Get the usable size of an allocated memory block
+/// \param[in]     block         address of the allocated memory block.
+/// \return usable size in bytes or 0 in case of error.
+uint32_t OS_Mem_GetBlockSize (const void *block);
+
+/// Get statistics of a memory region
+/// \param[in]     region        memory region ID or NULL for the default region.
+/// \param[out]    stats         pointer to buffer for the statistics.
+/// \return 0 on success, -1 on error.
+int32_t OS_Mem_GetStats (OS_Mem_RegionId_t region, OS_Mem_Stats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* OS_MEM_H */
@@ -0,0 +1,60 @@
+/**************************************************************************//**
+ * @file     os_runtime.h
+ * @brief    CMSIS OS Runtime header file
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OS_RUNTIME_H
+#define OS_RUNTIME_H
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Setup and start the runtime counter
+/// \return 0 on success, -1 on error (no cycle counter available).
+int32_t  OS_Runtime_Setup (void);
+
+/// Get runtime counter frequency
+/// \return runtime counter frequency in Hz
+uint32_t OS_Runtime_GetFreq (void);
+
+/// Get runtime counter value extended to 64 bits
+/// \note Must be called at least once per overflow period of the hardware counter.
+/// \return runtime counter value
+uint64_t OS_Runtime_GetCount (void);
+
+/// Account the execution time since the previous thread switch (call from the kernel thread switch with interrupts disabled)
+/// \param[in,out] runtime      execution time of the thread that stops running (idle time when no thread was running)
+void     OS_Runtime_Switch (uint64_t *runtime);
+
+/// Get the execution time since the last thread switch
+/// \return runtime counter ticks since the last call of \ref OS_Runtime_Switch
+uint64_t OS_Runtime_GetElapsed (void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* OS_RUNTIME_H */
@@ -0,0 +1,78 @@
+/**************************************************************************//**
+ * @file     os_thread_load.h
+ * @brief    CMSIS OS Thread Load header file
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OS_THREAD_LOAD_H
+#define OS_THREAD_LOAD_H
+
+#include <stdint.h>
+#include "cmsis_os2.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of samples in the sliding load window
+#ifndef OS_THREAD_LOAD_WINDOW
+#define OS_THREAD_LOAD_WINDOW   4U
+#endif
+
+/// Thread load entry
+typedef struct {
+  osThreadId_t thread_id;                               ///< Thread ID
+  uint32_t     load;                                    ///< Load over the window in 0.1 % units (0..1000)
+  uint64_t     runtime[OS_THREAD_LOAD_WINDOW + 1U];     ///< Execution time history (internal)
+} OS_ThreadLoad_Entry_t;
+
+/// Thread load control block
+typedef struct {
+  OS_ThreadLoad_Entry_t *entry;                         ///< Thread load entries (one per thread)
+  osThreadId_t          *id_buf;                        ///< Buffer for \ref osThreadEnumerate
+  uint32_t               max;                           ///< Number of items in entry and id_buf
+  uint32_t               count;                         ///< Number of valid entries
+  uint32_t               idle_load;                     ///< Idle load over the window in 0.1 % units (0..1000)
+  uint32_t               index;                         ///< History index of the next sample (internal)
+  uint32_t               samples;                       ///< Number of valid history samples (internal)
+  uint64_t               idle[OS_THREAD_LOAD_WINDOW + 1U];   ///< Idle time history (internal)
+  uint64_t               total[OS_THREAD_LOAD_WINDOW + 1U];  ///< Total time history (internal)
+} OS_ThreadLoad_t;
+
+/// Initialize thread load measurement
+/// \param[out]    info         thread load control block
+/// \param[in]     entry        array for thread load entries
+/// \param[in]     id_buf       array for thread IDs
+/// \param[in]     max          number of items in entry and id_buf
+/// \return 0 on success, -1 on error.
+int32_t  OS_ThreadLoad_Init (OS_ThreadLoad_t *info, OS_ThreadLoad_Entry_t *entry, osThreadId_t *id_buf, uint32_t max);
+
+/// Take a sample and update the thread loads over the last \ref OS_THREAD_LOAD_WINDOW samples
+/// \param[in,out] info         thread load control block
+/// \return number of valid entries in info->entry.
+uint32_t OS_ThreadLoad_Update (OS_ThreadLoad_t *info);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* OS_THREAD_LOAD_H */
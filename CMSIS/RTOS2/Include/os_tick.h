@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_tick.h
  * @brief    CMSIS OS Tick header file
- * @version  V1.0.2
- * @date     19. March 2021
+ * @version  V1.1.0
+ * @date     17. October 2024
  ******************************************************************************/
 /*
- * Copyright (c) 2017-2021 ARM Limited. All rights reserved.
+ * Copyright (c) 2017-2024 ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -73,6 +73,28 @@ uint32_t OS_Tick_GetCount (void);
 /// \return OS Tick overflow status (1 - overflow, 0 - no overflow).
 uint32_t OS_Tick_GetOverflow (void);
 
+/// Program OS Tick timer to generate the next interrupt after the specified number of ticks (tickless idle)
+/// \param[in]     ticks        number of ticks until the next interrupt
+/// \return number of ticks programmed (limited by the timer range), 0 on error.
+uint32_t OS_Tick_SetNextEvent (uint32_t ticks);
+
+/// Get number of ticks elapsed since \ref OS_Tick_SetNextEvent and continue periodic ticks
+/// \return number of elapsed ticks.
+uint32_t OS_Tick_GetElapsed (void);
+
+/// Program a one-shot OS Tick timer interrupt before the next tick (sub-tick event)
+/// \param[in]     cycles       number of timer clock cycles until the interrupt
+/// \return 0 on success, -1 on error (next tick expires first or one-shot events not supported).
+int32_t  OS_Tick_SetOneShot (uint32_t cycles);
+
+/// Check for a one-shot event in the OS Tick interrupt handler and continue the tick period
+/// \return 1 - one-shot event only (no tick), 0 - tick.
+uint32_t OS_Tick_GetOneShot (void);
+
+/// Get 64-bit OS Tick timestamp (monotonic, timer clock cycles)
+/// \return timestamp in OS Tick timer clock cycles.
+uint64_t OS_Tick_GetTimestamp64 (void);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,127 @@
+/**************************************************************************//**
+ * @file     os_trace.h
+ * @brief    CMSIS OS Trace header file
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OS_TRACE_H
+#define OS_TRACE_H
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Trace buffer identification ("OSTR") and format version.
+#define OS_TRACE_MAGIC              0x5254534FU
+#define OS_TRACE_VERSION            1U
+
+/// Trace events (bits 15..8: event type, bits 7..0: event parameter).
+#define OS_TRACE_THREAD_SWITCH      0x0100U     ///< arg0: new thread (0: idle), arg1: previous thread
+#define OS_TRACE_THREAD_CREATE      0x0200U     ///< arg0: thread, arg1: priority
+#define OS_TRACE_THREAD_EXIT        0x0300U     ///< arg0: thread
+#define OS_TRACE_THREAD_NAME        0x0400U     ///< parameter: name chunk index, arg0: thread, arg1: 4 characters
+#define OS_TRACE_WAIT_ENTER         0x0500U     ///< parameter: wait reason, arg0: thread, arg1: timeout
+#define OS_TRACE_WAIT_EXIT          0x0600U     ///< arg0: thread, arg1: wait result
+#define OS_TRACE_ISR_ENTER          0x0700U     ///< arg0: interrupt number
+#define OS_TRACE_ISR_EXIT           0x0800U     ///< arg0: interrupt number
+#define OS_TRACE_USER               0x8000U     ///< bits 14..0: user event ID, arg0/arg1: user data
+
+/// Wait reasons (parameter of \ref OS_TRACE_WAIT_ENTER).
+#define OS_TRACE_WAIT_OTHER         0x00U
+#define OS_TRACE_WAIT_DELAY         0x01U
+#define OS_TRACE_WAIT_JOIN          0x02U
+#define OS_TRACE_WAIT_THREAD_FLAGS  0x03U
+#define OS_TRACE_WAIT_EVENT_FLAGS   0x04U
+#define OS_TRACE_WAIT_MUTEX         0x05U
+#define OS_TRACE_WAIT_SEMAPHORE     0x06U
+#define OS_TRACE_WAIT_MEMORY_POOL   0x07U
+#define OS_TRACE_WAIT_MESSAGE_GET   0x08U
+#define OS_TRACE_WAIT_MESSAGE_PUT   0x09U
+#define OS_TRACE_WAIT_TIMER         0x0AU
+#define OS_TRACE_WAIT_MULTIPLE      0x0BU
+#define OS_TRACE_WAIT_RWLOCK        0x0CU
+#define OS_TRACE_WAIT_STREAM_READ   0x0DU
+#define OS_TRACE_WAIT_STREAM_WRITE  0x0EU
+#define OS_TRACE_WAIT_WORK          0x0FU
+
+/// Trace record (16 bytes).
+typedef struct {
+  uint32_t                 timestamp;   ///< timestamp counter (lower 32 bits)
+  uint16_t                     event;   ///< event (OS_TRACE_xxx)
+  uint16_t                       seq;   ///< sequence tag: 0x8000 | (buffer lap & 0x7FFF), 0 while written
+  uint32_t                      arg0;   ///< event argument 0
+  uint32_t                      arg1;   ///< event argument 1
+} OS_Trace_Record_t;
+
+/// Trace buffer header (32 bytes), followed by the trace records.
+typedef struct {
+  uint32_t                     magic;   ///< OS_TRACE_MAGIC
+  uint16_t                   version;   ///< OS_TRACE_VERSION
+  uint16_t               record_size;   ///< size of a trace record in bytes
+  uint32_t                     count;   ///< number of trace records (power of 2)
+  uint32_t                      freq;   ///< timestamp counter frequency in Hz
+  volatile uint32_t             head;   ///< number of records written since start
+  volatile uint32_t           enable;   ///< recording enabled (1) or stopped (0)
+  uint32_t               reserved[2];   ///< reserved (0)
+} OS_Trace_Header_t;
+
+/// Initialize the trace buffer
+/// \param[in]     mem           trace buffer memory (4-byte aligned).
+/// \param[in]     size          size of the trace buffer memory in bytes.
+/// \return number of trace records or 0 in case of error.
+uint32_t OS_Trace_Init (void *mem, uint32_t size);
+
+/// Start recording of trace events
+void OS_Trace_Start (void);
+
+/// Stop recording of trace events
+void OS_Trace_Stop (void);
+
+/// Record a trace event
+/// \param[in]     event         event (OS_TRACE_xxx with event parameter).
+/// \param[in]     arg0          event argument 0.
+/// \param[in]     arg1          event argument 1.
+void OS_Trace_Record (uint32_t event, uint32_t arg0, uint32_t arg1);
+
+/// Record the name of a thread
+/// \param[in]     thread        thread identification.
+/// \param[in]     name          name of the thread as null-terminated string.
+void OS_Trace_ThreadName (uint32_t thread, const char *name);
+
+/// Record a user event
+/// \param[in]     id            user event ID (0..0x7FFF).
+/// \param[in]     arg0          user data 0.
+/// \param[in]     arg1          user data 1.
+void OS_Trace_User (uint32_t id, uint32_t arg0, uint32_t arg1);
+
+/// Get the trace buffer
+/// \param[out]    size          pointer to buffer for the size of the trace buffer in bytes (may be NULL).
+/// \return trace buffer header followed by the trace records or NULL when not initialized.
+const OS_Trace_Header_t *OS_Trace_GetBuffer (uint32_t *size);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* OS_TRACE_H */
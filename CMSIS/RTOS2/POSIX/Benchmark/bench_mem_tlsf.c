@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       OS Memory (TLSF) benchmark
+ *
+ * A random sequence of allocations and frees with RTOS object sizes
+ * (control blocks, message queue and stream buffer data) is executed with
+ * the TLSF allocator (os_mem_tlsf.c) and with the host heap. The memory is
+ * filled up to 50 % and 90 %. Reported are the average, 99.9 % percentile and
+ * worst case execution time of alloc and free, failed allocations and the
+ * fragmentation of the TLSF region at the end. The worst case includes host
+ * preemption; the percentile shows the bound of the allocator itself.
+ *
+ * Build: add $RTOS2/Source/os_mem_tlsf.c to the sources.
+ * Usage: bench_mem_tlsf [operations]
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "os_mem.h"
+
+#define REGION_SIZE     (1024U * 1024U) // TLSF region size
+#define SLOTS           4096U           // Maximum number of live blocks
+
+#define ALLOC_TLSF      0U
+#define ALLOC_HOST      1U
+
+typedef struct {
+  uint64_t            sum;              // Execution time sum [ns]
+  uint32_t           *sample;           // Execution time samples [ns]
+  uint32_t            cnt;
+} TIME_t;
+
+static uint64_t Region[REGION_SIZE / 8U];
+static void    *Block[SLOTS];
+static uint32_t Ops = 1000000U;
+static uint32_t Seed;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Pseudo random number generator (same sequence for both allocators).
+static uint32_t Random (void) {
+  Seed = (Seed * 1103515245U) + 12345U;
+  return (Seed >> 8);
+}
+
+// Random block size: mostly control blocks, some data buffers.
+static uint32_t RandomSize (void) {
+  uint32_t r = Random() % 100U;
+
+  if (r < 70U) {
+    return (32U + (Random() % 96U));    // Control blocks
+  }
+  if (r < 95U) {
+    return (128U + (Random() % 896U));  // Message queue data
+  }
+  return (1024U + (Random() % 7168U));  // Stream buffer data
+}
+
+// Account one execution time sample.
+static void TimeAdd (TIME_t *t, uint64_t ns) {
+  t->sum += ns;
+  t->sample[t->cnt] = (ns > UINT32_MAX) ? UINT32_MAX : (uint32_t)ns;
+  t->cnt++;
+}
+
+// Compare execution time samples.
+static int TimeCompare (const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+
+  return ((x > y) - (x < y));
+}
+
+// Print average, 99.9 % percentile and maximum.
+static void TimePrint (TIME_t *t) {
+
+  if (t->cnt == 0U) {
+    printf(" %8s %8s %8s", "-", "-", "-");
+    return;
+  }
+  qsort(t->sample, t->cnt, sizeof(uint32_t), TimeCompare);
+  printf(" %8.1f %8u %8u", (double)t->sum / (double)t->cnt,
+         t->sample[(uint32_t)(((uint64_t)t->cnt * 999U) / 1000U)], t->sample[t->cnt - 1U]);
+}
+
+// Run one configuration.
+static void Run (uint32_t alloc, uint32_t fill) {
+  static const char * const name[] = { "TLSF", "host heap" };
+  OS_Mem_RegionId_t region = NULL;
+  OS_Mem_Stats_t    stats;
+  TIME_t            t_alloc = { 0U, NULL, 0U };
+  TIME_t            t_free  = { 0U, NULL, 0U };
+  uint64_t          t0, t1;
+  uint32_t          used    = 0U;
+  uint32_t          limit   = (REGION_SIZE / 100U) * fill;
+  uint32_t          failed  = 0U;
+  uint32_t          size[SLOTS];
+  uint32_t          n, i;
+
+  (void)memset(Block, 0, sizeof(Block));
+  t_alloc.sample = malloc(Ops * sizeof(uint32_t));
+  t_free.sample  = malloc(Ops * sizeof(uint32_t));
+  if ((t_alloc.sample == NULL) || (t_free.sample == NULL)) {
+    printf("out of host memory\n");
+    exit(1);
+  }
+  Seed = 1U;
+  if (alloc == ALLOC_TLSF) {
+    region = OS_Mem_AddRegion(NULL, Region, sizeof(Region));
+    if (region == NULL) {
+      printf("region creation failed\n");
+      exit(1);
+    }
+  }
+
+  for (n = 0U; n < Ops; n++) {
+    i = Random() % SLOTS;
+    if (Block[i] != NULL) {
+      t0 = GetTime_ns();
+      if (alloc == ALLOC_TLSF) {
+        (void)OS_Mem_Free(Block[i]);
+      } else {
+        free(Block[i]);
+      }
+      t1 = GetTime_ns();
+      TimeAdd(&t_free, t1 - t0);
+      Block[i] = NULL;
+      used    -= size[i];
+    } else {
+      size[i] = RandomSize();
+      if ((used + size[i]) > limit) {
+        continue;
+      }
+      t0 = GetTime_ns();
+      if (alloc == ALLOC_TLSF) {
+        Block[i] = OS_Mem_Alloc(region, size[i]);
+      } else {
+        Block[i] = malloc(size[i]);
+      }
+      t1 = GetTime_ns();
+      TimeAdd(&t_alloc, t1 - t0);
+      if (Block[i] == NULL) {
+        failed++;
+      } else {
+        *(volatile uint32_t *)Block[i] = n;
+        used += size[i];
+      }
+    }
+  }
+
+  printf("  %-20s %4u%%", name[alloc], fill);
+  TimePrint(&t_alloc);
+  TimePrint(&t_free);
+  printf(" %7u", failed);
+  if (alloc == ALLOC_TLSF) {
+    (void)OS_Mem_GetStats(region, &stats);
+    printf(" %5u.%u%%\n", stats.fragmentation / 10U, stats.fragmentation % 10U);
+  } else {
+    printf("\n");
+  }
+
+  for (i = 0U; i < SLOTS; i++) {
+    if ((Block[i] != NULL) && (alloc == ALLOC_HOST)) {
+      free(Block[i]);
+    }
+  }
+  free(t_alloc.sample);
+  free(t_free.sample);
+}
+
+int main (int argc, char *argv[]) {
+
+  if (argc > 1) {
+    Ops = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  if (Ops == 0U) {
+    Ops = 1000000U;
+  }
+
+  printf("OS Memory benchmark: %u random alloc/free operations, %u KB\n", Ops, REGION_SIZE / 1024U);
+  printf("  execution times in ns (including clock_gettime)\n\n");
+  printf("  %-20s %5s %8s %8s %8s %8s %8s %8s %7s %7s\n",
+         "allocator", "fill", "alloc", "p99.9", "max", "free", "p99.9", "max", "failed", "frag");
+
+  Run(ALLOC_TLSF, 50U);
+  Run(ALLOC_HOST, 50U);
+  Run(ALLOC_TLSF, 90U);
+  Run(ALLOC_HOST, 90U);
+
+  return 0;
+}
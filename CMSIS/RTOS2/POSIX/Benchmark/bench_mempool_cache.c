@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Memory Pool cache benchmark
+ *
+ * 1..8 threads allocate bursts of 1..16 blocks from one memory pool and free
+ * them again, without cache and with a cache depth of 16 blocks. A second
+ * pattern passes blocks from producer threads through a message queue to a
+ * consumer thread that frees them (blocks move between caches).
+ * Reported are the alloc/free pairs per second and the cache hit rate.
+ *
+ * Usage: bench_mempool_cache [operations] [concurrent]
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define THREADS_MAX     8U              // Maximum number of worker threads
+#define BURST_MAX       16U             // Maximum blocks per burst
+#define CACHE_DEPTH     16U             // Cache depth of cached configuration
+#define BLOCK_SIZE      64U             // Memory block size in bytes
+
+#define MODE_BURST      0U              // Alloc burst, then free burst
+#define MODE_PIPELINE   1U              // Producers allocate, consumer frees
+
+typedef struct {
+  uint32_t            mode;
+  uint32_t            burst;
+  uint32_t            ops;              // Alloc/free pairs per thread
+  osMemoryPoolId_t    mp;
+  osMessageQueueId_t  mq;
+  osSemaphoreId_t     finished;
+} BENCH_t;
+
+static uint32_t Ops = 200000U;
+static BENCH_t  Bench;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Burst worker: allocate a burst of blocks, touch them and free them.
+static void Worker (void *argument) {
+  BENCH_t *b = (BENCH_t *)argument;
+  void    *block[BURST_MAX];
+  uint32_t n, k;
+
+  for (n = 0U; n < b->ops; n += b->burst) {
+    for (k = 0U; k < b->burst; k++) {
+      block[k] = osMemoryPoolAlloc(b->mp, osWaitForever);
+      *(volatile uint32_t *)block[k] = n;
+    }
+    for (k = 0U; k < b->burst; k++) {
+      (void)osMemoryPoolFree(b->mp, block[k]);
+    }
+  }
+  (void)osSemaphoreRelease(b->finished);
+}
+
+// Producer: allocate blocks and pass them to the consumer.
+static void Producer (void *argument) {
+  BENCH_t *b = (BENCH_t *)argument;
+  void    *block;
+  uint32_t n;
+
+  for (n = 0U; n < b->ops; n++) {
+    block = osMemoryPoolAlloc(b->mp, osWaitForever);
+    *(volatile uint32_t *)block = n;
+    (void)osMessageQueuePut(b->mq, &block, 0U, osWaitForever);
+  }
+  (void)osSemaphoreRelease(b->finished);
+}
+
+// Consumer: free blocks received from the producers.
+static void Consumer (void *argument) {
+  BENCH_t *b = (BENCH_t *)argument;
+  void    *block;
+
+  for (;;) {
+    if (osMessageQueueGet(b->mq, &block, NULL, osWaitForever) != osOK) {
+      break;
+    }
+    (void)osMemoryPoolFree(b->mp, block);
+  }
+}
+
+// Run one configuration.
+static void Run (uint32_t mode, uint32_t threads, uint32_t burst, uint32_t cache_depth) {
+  BENCH_t            *b = &Bench;
+  osMemoryPoolAttr_t  mp_attr;
+  osMemoryPoolStats_t stats;
+  osThreadId_t        consumer = NULL;
+  uint64_t            t0, t1;
+  uint32_t            blocks;
+  uint32_t            n;
+
+  (void)memset(b, 0, sizeof(BENCH_t));
+  b->mode     = mode;
+  b->burst    = burst;
+  b->ops      = (Ops / threads / burst) * burst;
+  b->finished = osSemaphoreNew(THREADS_MAX, 0U, NULL);
+
+  // Room for all bursts plus one full cache per thread
+  blocks = threads * (burst + cache_depth + 64U);
+  (void)memset(&mp_attr, 0, sizeof(mp_attr));
+  mp_attr.cache_depth = cache_depth;
+  b->mp = osMemoryPoolNew(blocks, BLOCK_SIZE, &mp_attr);
+
+  if (mode == MODE_PIPELINE) {
+    b->mq    = osMessageQueueNew(64U, sizeof(void *), NULL);
+    consumer = osThreadNew(Consumer, b, &(osThreadAttr_t){ .priority = osPriorityAboveNormal });
+  }
+  if ((b->finished == NULL) || (b->mp == NULL) || ((mode == MODE_PIPELINE) && (consumer == NULL))) {
+    printf("object creation failed\n");
+    exit(1);
+  }
+
+  t0 = GetTime_ns();
+  for (n = 0U; n < threads; n++) {
+    (void)osThreadNew((mode == MODE_BURST) ? Worker : Producer, b, NULL);
+  }
+  for (n = 0U; n < threads; n++) {
+    (void)osSemaphoreAcquire(b->finished, osWaitForever);
+  }
+  if (mode == MODE_PIPELINE) {
+    // Wait until the consumer freed all blocks
+    while (osMessageQueueGetCount(b->mq) != 0U) {
+      (void)osDelay(1U);
+    }
+  }
+  t1 = GetTime_ns();
+
+  (void)osMemoryPoolGetStats(b->mp, &stats);
+
+  if (mode == MODE_PIPELINE) {
+    (void)osThreadTerminate(consumer);
+    (void)osMessageQueueDelete(b->mq);
+  }
+  (void)osMemoryPoolDelete(b->mp);
+  (void)osSemaphoreDelete(b->finished);
+
+  printf("  %-14s %7u %5u %5u %12.0f %9.1f%% %9.1f%% %8u\n",
+         (mode == MODE_BURST) ? "burst" : "pipeline", threads, burst, cache_depth,
+         ((double)b->ops * threads * 1e9) / (double)(t1 - t0),
+         (stats.alloc_count != 0U) ? ((100.0 * stats.alloc_hits) / stats.alloc_count) : 0.0,
+         (stats.free_count  != 0U) ? ((100.0 * stats.free_hits)  / stats.free_count)  : 0.0,
+         stats.max_used);
+}
+
+// Benchmark main thread.
+static void Main (void *argument) {
+  static const uint32_t threads[] = { 1U, 2U, 4U, 8U };
+  static const uint32_t burst[]   = { 1U, 4U, 16U };
+  uint32_t n, k;
+  (void)argument;
+
+  printf("CMSIS-RTOS2 memory pool cache benchmark: %u alloc/free pairs per configuration\n", Ops);
+  printf("  scheduler: %s\n\n",
+         (osPosixKernelGetSchedMode() == osPosixSchedDeterministic) ? "deterministic" : "concurrent");
+  printf("  %-14s %7s %5s %5s %12s %10s %10s %8s\n",
+         "pattern", "threads", "burst", "cache", "pairs/s", "alloc hit", "free hit", "max used");
+
+  for (n = 0U; n < (sizeof(threads) / sizeof(threads[0])); n++) {
+    for (k = 0U; k < (sizeof(burst) / sizeof(burst[0])); k++) {
+      Run(MODE_BURST, threads[n], burst[k], 0U);
+      Run(MODE_BURST, threads[n], burst[k], CACHE_DEPTH);
+    }
+  }
+  for (n = 0U; n < (sizeof(threads) / sizeof(threads[0])); n++) {
+    Run(MODE_PIPELINE, threads[n], 1U, 0U);
+    Run(MODE_PIPELINE, threads[n], 1U, CACHE_DEPTH);
+  }
+
+  exit(0);
+}
+
+int main (int argc, char *argv[]) {
+  int i;
+
+  (void)osKernelInitialize();
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "concurrent") == 0) {
+      (void)osPosixKernelSetSchedMode(osPosixSchedConcurrent);
+    } else {
+      Ops = (uint32_t)strtoul(argv[i], NULL, 0);
+    }
+  }
+  if (Ops == 0U) {
+    Ops = 200000U;
+  }
+
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+
+  return 0;
+}
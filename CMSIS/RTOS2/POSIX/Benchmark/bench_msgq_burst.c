@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Message Queue burst benchmark
+ *
+ * Measures message throughput between a producer and a consumer thread
+ * for single message transfers (osMessageQueuePut/osMessageQueueGet) and
+ * batched transfers (osMessageQueuePutN/osMessageQueueGetN) with burst
+ * sizes 1..64 and zero-copy transfers (osMessageQueueAcquire/Commit and
+ * osMessageQueueBorrow/Release).
+ *
+ * Usage: bench_msgq_burst [messages] [concurrent]
+ * The message payload size is set at build time with -DMSG_WORDS=<n>.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define QUEUE_DEPTH     64U             // Message queue capacity
+#define BURST_MAX       64U             // Largest burst size
+#define FLAG_DONE       0x01U           // Consumer finished
+#define BURST_ZERO_COPY 0xFFFFFFFFU     // Zero-copy functions
+
+#ifndef MSG_WORDS
+#define MSG_WORDS       1U              // Message payload size in words
+#endif
+
+typedef struct {
+  uint32_t seq;
+  uint32_t data[MSG_WORDS];
+} MSG_t;
+
+typedef struct {
+  osMessageQueueId_t mq;
+  osThreadId_t       producer;
+  uint32_t           burst;             // 0: single message functions, BURST_ZERO_COPY: zero-copy functions
+  uint32_t           total;
+  uint32_t           errors;
+} BENCH_t;
+
+static uint32_t Messages = 1000000U;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Consumer thread: receives all messages and checks the sequence.
+static void Consumer (void *argument) {
+  BENCH_t *b = (BENCH_t *)argument;
+  MSG_t    msg[BURST_MAX];
+  MSG_t   *slot;
+  uint32_t expect = 0U;
+  uint32_t n;
+  uint32_t i;
+
+  while (expect < b->total) {
+    if (b->burst == BURST_ZERO_COPY) {
+      slot = osMessageQueueBorrow(b->mq, NULL, osWaitForever);
+      if (slot != NULL) {
+        if (slot->seq != expect) {
+          b->errors++;
+        }
+        expect++;
+        (void)osMessageQueueRelease(b->mq, slot);
+      }
+      continue;
+    }
+    if (b->burst == 0U) {
+      n = (osMessageQueueGet(b->mq, &msg[0], NULL, osWaitForever) == osOK) ? 1U : 0U;
+    } else {
+      n = osMessageQueueGetN(b->mq, msg, b->burst, NULL, osWaitForever);
+    }
+    for (i = 0U; i < n; i++) {
+      if (msg[i].seq != expect) {
+        b->errors++;
+      }
+      expect++;
+    }
+  }
+
+  (void)osThreadFlagsSet(b->producer, FLAG_DONE);
+}
+
+// Run one measurement and return messages per second.
+static double RunBurst (uint32_t burst) {
+  BENCH_t  b;
+  MSG_t    msg[BURST_MAX];
+  MSG_t   *slot;
+  uint64_t t0;
+  uint64_t t1;
+  uint32_t sent = 0U;
+  uint32_t n;
+  uint32_t i;
+
+  memset(&b, 0, sizeof(b));
+  b.mq       = osMessageQueueNew(QUEUE_DEPTH, sizeof(MSG_t), NULL);
+  b.producer = osThreadGetId();
+  b.burst    = burst;
+  b.total    = Messages;
+  if (b.mq == NULL) {
+    return 0.0;
+  }
+
+  (void)osThreadNew(Consumer, &b, NULL);
+
+  t0 = GetTime_ns();
+  while (sent < b.total) {
+    if (burst == BURST_ZERO_COPY) {
+      slot = osMessageQueueAcquire(b.mq, osWaitForever);
+      if (slot != NULL) {
+        slot->seq  = sent;
+        slot->data[0] = ~sent;
+        (void)osMessageQueueCommit(b.mq, slot, 0U);
+        sent++;
+      }
+      continue;
+    }
+    n = (burst == 0U) ? 1U : burst;
+    if (n > (b.total - sent)) {
+      n = b.total - sent;
+    }
+    for (i = 0U; i < n; i++) {
+      msg[i].seq  = sent + i;
+      msg[i].data[0] = ~(sent + i);
+    }
+    if (burst == 0U) {
+      if (osMessageQueuePut(b.mq, &msg[0], 0U, osWaitForever) == osOK) {
+        sent++;
+      }
+    } else {
+      sent += osMessageQueuePutN(b.mq, msg, n, 0U, osWaitForever);
+    }
+  }
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  t1 = GetTime_ns();
+
+  (void)osMessageQueueDelete(b.mq);
+
+  if (b.errors != 0U) {
+    printf("  sequence errors: %u\n", b.errors);
+  }
+  return ((double)b.total * 1e9) / (double)(t1 - t0);
+}
+
+// Benchmark main thread.
+static void Bench (void *argument) {
+  uint32_t burst;
+  double   rate;
+  double   base;
+  (void)argument;
+
+  printf("CMSIS-RTOS2 message queue burst benchmark\n");
+  printf("  scheduler: %s, queue depth: %u, message size: %u bytes, messages: %u\n\n",
+         (osPosixKernelGetSchedMode() == osPosixSchedDeterministic) ? "deterministic" : "concurrent",
+         QUEUE_DEPTH, (uint32_t)sizeof(MSG_t), Messages);
+  printf("  %-22s %14s %10s %8s\n", "function", "messages/s", "ns/msg", "speedup");
+
+  base = RunBurst(0U);
+  printf("  %-22s %14.0f %10.1f %8.2f\n", "Put/Get", base, 1e9 / base, 1.0);
+
+  rate = RunBurst(BURST_ZERO_COPY);
+  printf("  %-22s %14.0f %10.1f %8.2f\n", "Acquire/Borrow", rate, 1e9 / rate, rate / base);
+
+  for (burst = 1U; burst <= BURST_MAX; burst *= 2U) {
+    rate = RunBurst(burst);
+    printf("  PutN/GetN burst %-6u %14.0f %10.1f %8.2f\n", burst, rate, 1e9 / rate, rate / base);
+  }
+
+  exit(0);
+}
+
+int main (int argc, char *argv[]) {
+  int i;
+
+  (void)osKernelInitialize();
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "concurrent") == 0) {
+      (void)osPosixKernelSetSchedMode(osPosixSchedConcurrent);
+    } else {
+      Messages = (uint32_t)strtoul(argv[i], NULL, 0);
+    }
+  }
+  if (Messages == 0U) {
+    Messages = 1000000U;
+  }
+
+  (void)osThreadNew(Bench, NULL, NULL);
+  (void)osKernelStart();
+
+  return 0;
+}
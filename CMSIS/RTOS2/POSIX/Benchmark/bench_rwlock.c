@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Reader-Writer Lock contention benchmark
+ *
+ * A configuration table is read by 1..16 reader threads and updated by one
+ * writer thread once per tick. The table is protected either by a mutex
+ * (osMutexAcquire for readers and the writer) or by a reader-writer lock
+ * (osRwLockAcquireShared for readers, osRwLockAcquireExclusive for the
+ * writer). Reported are the read throughput, the number of updates and the
+ * time the writer waits for the lock. Readers verify that they never see a
+ * partially updated table.
+ *
+ * Usage: bench_rwlock [duration_ms] [deterministic]
+ * The benchmark runs in concurrent scheduler mode unless "deterministic" is
+ * specified. The table size is set at build time with -DTABLE_WORDS=<n>.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#ifndef TABLE_WORDS
+#define TABLE_WORDS     256U            // Configuration table size in words
+#endif
+
+#define READERS_MAX     16U             // Largest number of reader threads
+
+#define LOCK_MUTEX      0U              // Table protected by osMutex
+#define LOCK_RWLOCK     1U              // Table protected by osRwLock
+
+typedef struct {
+  uint32_t            lock_type;
+  osMutexId_t         mutex;
+  osRwLockId_t        rwlock;
+  osSemaphoreId_t     done;             // Released by each thread on exit
+  volatile uint32_t   stop;
+  uint32_t            errors;           // Inconsistent table reads
+  uint32_t            writes;
+  uint64_t            write_wait_sum;   // Writer lock wait time (ns)
+  uint64_t            write_wait_max;
+} BENCH_t;
+
+typedef struct {
+  BENCH_t            *b;
+  uint32_t            reads;
+} READER_t;
+
+static volatile uint32_t Table[TABLE_WORDS];
+static uint32_t          Duration = 1000U;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Acquire the table lock.
+static void LockAcquire (BENCH_t *b, uint32_t exclusive) {
+  if (b->lock_type == LOCK_MUTEX) {
+    (void)osMutexAcquire(b->mutex, osWaitForever);
+  } else if (exclusive != 0U) {
+    (void)osRwLockAcquireExclusive(b->rwlock, osWaitForever);
+  } else {
+    (void)osRwLockAcquireShared(b->rwlock, osWaitForever);
+  }
+}
+
+// Release the table lock.
+static void LockRelease (BENCH_t *b) {
+  if (b->lock_type == LOCK_MUTEX) {
+    (void)osMutexRelease(b->mutex);
+  } else {
+    (void)osRwLockRelease(b->rwlock);
+  }
+}
+
+// Reader thread: reads the complete table and checks its consistency.
+static void Reader (void *argument) {
+  READER_t *r = (READER_t *)argument;
+  BENCH_t  *b = r->b;
+  uint32_t  first;
+  uint32_t  n;
+
+  while (b->stop == 0U) {
+    LockAcquire(b, 0U);
+    first = Table[0];
+    for (n = 1U; n < TABLE_WORDS; n++) {
+      if (Table[n] != first) {
+        b->errors++;
+        break;
+      }
+    }
+    LockRelease(b);
+    r->reads++;
+  }
+  (void)osSemaphoreRelease(b->done);
+}
+
+// Writer thread: updates the complete table once per tick.
+static void Writer (void *argument) {
+  BENCH_t  *b = (BENCH_t *)argument;
+  uint64_t  t0, wait;
+  uint32_t  n;
+
+  while (b->stop == 0U) {
+    t0 = GetTime_ns();
+    LockAcquire(b, 1U);
+    wait = GetTime_ns() - t0;
+    for (n = 0U; n < TABLE_WORDS; n++) {
+      Table[n] = b->writes + 1U;
+    }
+    LockRelease(b);
+    b->writes++;
+    b->write_wait_sum += wait;
+    if (wait > b->write_wait_max) {
+      b->write_wait_max = wait;
+    }
+    (void)osDelay(1U);
+  }
+  (void)osSemaphoreRelease(b->done);
+}
+
+// Run readers and the writer for the benchmark duration.
+static void Run (uint32_t lock_type, uint32_t readers) {
+  static READER_t reader[READERS_MAX];
+  osThreadAttr_t  attr = { 0 };
+  BENCH_t         b    = { 0 };
+  uint64_t        t0, t1;
+  uint64_t        reads = 0U;
+  uint32_t        n;
+
+  b.lock_type = lock_type;
+  b.mutex     = osMutexNew(NULL);
+  b.rwlock    = osRwLockNew(NULL);
+  b.done      = osSemaphoreNew(READERS_MAX + 1U, 0U, NULL);
+  if ((b.mutex == NULL) || (b.rwlock == NULL) || (b.done == NULL)) {
+    printf("object creation failed\n");
+    exit(1);
+  }
+
+  (void)memset((void *)Table, 0, sizeof(Table));
+
+  // Readers run below the benchmark thread, the writer above the readers
+  attr.priority = osPriorityBelowNormal;
+  for (n = 0U; n < readers; n++) {
+    reader[n].b     = &b;
+    reader[n].reads = 0U;
+    (void)osThreadNew(Reader, &reader[n], &attr);
+  }
+  attr.priority = osPriorityNormal;
+  (void)osThreadNew(Writer, &b, &attr);
+
+  t0 = GetTime_ns();
+  (void)osDelay(Duration);
+  b.stop = 1U;
+  for (n = 0U; n <= readers; n++) {
+    (void)osSemaphoreAcquire(b.done, osWaitForever);
+  }
+  t1 = GetTime_ns();
+
+  for (n = 0U; n < readers; n++) {
+    reads += reader[n].reads;
+  }
+
+  printf("  %-7s %7u %14.0f %8u %12.1f %12.1f %7u\n",
+         (lock_type == LOCK_MUTEX) ? "osMutex" : "osRwLock", readers,
+         ((double)reads * 1e9) / (double)(t1 - t0), b.writes,
+         (b.writes != 0U) ? ((double)b.write_wait_sum / b.writes / 1e3) : 0.0,
+         (double)b.write_wait_max / 1e3, b.errors);
+
+  (void)osMutexDelete(b.mutex);
+  (void)osRwLockDelete(b.rwlock);
+  (void)osSemaphoreDelete(b.done);
+}
+
+// Benchmark main thread.
+static void Bench (void *argument) {
+  uint32_t readers;
+  (void)argument;
+
+  printf("CMSIS-RTOS2 reader-writer lock contention benchmark\n");
+  printf("  scheduler: %s, table size: %u bytes, duration: %u ms per run\n\n",
+         (osPosixKernelGetSchedMode() == osPosixSchedDeterministic) ? "deterministic" : "concurrent",
+         (uint32_t)sizeof(Table), Duration);
+  printf("  %-7s %7s %14s %8s %12s %12s %7s\n",
+         "lock", "readers", "reads/s", "writes", "wr-wait us", "wr-max us", "errors");
+
+  for (readers = 1U; readers <= READERS_MAX; readers *= 2U) {
+    Run(LOCK_MUTEX,  readers);
+    Run(LOCK_RWLOCK, readers);
+  }
+
+  exit(0);
+}
+
+int main (int argc, char *argv[]) {
+  osThreadAttr_t attr = { 0 };
+  int i;
+
+  (void)osKernelInitialize();
+  (void)osPosixKernelSetSchedMode(osPosixSchedConcurrent);
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "deterministic") == 0) {
+      (void)osPosixKernelSetSchedMode(osPosixSchedDeterministic);
+    } else {
+      Duration = (uint32_t)strtoul(argv[i], NULL, 0);
+    }
+  }
+  if (Duration == 0U) {
+    Duration = 1000U;
+  }
+
+  attr.priority = osPriorityAboveNormal;
+  (void)osThreadNew(Bench, NULL, &attr);
+  (void)osKernelStart();
+
+  return 0;
+}
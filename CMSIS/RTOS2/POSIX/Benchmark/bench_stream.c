@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Stream Buffer benchmark
+ *
+ * An emulated interrupt (a host thread) writes a byte stream in chunks of
+ * 1..64 bytes with timeout 0; a thread reads and checks it. The stream is
+ * passed through a message queue with 1-byte messages (osMessageQueuePut and
+ * osMessageQueueGetN) and through a stream buffer (osStreamBufferRead with
+ * trigger level 1 and 32, osStreamBufferGetSpan/Consume). Reported are the
+ * throughput and the number of reader calls that returned data.
+ *
+ * Usage: bench_stream [bytes] [concurrent]
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define BUFFER_SIZE     256U            // Queue depth and stream buffer capacity in bytes
+#define READ_MAX        64U             // Largest read size
+
+#define MODE_MSGQ       0U              // osMessageQueuePut / osMessageQueueGetN
+#define MODE_READ       1U              // osStreamBufferWrite / osStreamBufferRead
+#define MODE_SPAN       2U              // osStreamBufferWrite / osStreamBufferGetSpan
+
+typedef struct {
+  uint32_t            mode;
+  uint32_t            chunk;            // Bytes per emulated interrupt
+  uint32_t            trigger;
+  osMessageQueueId_t  mq;
+  osStreamBufferId_t  sb;
+  osSemaphoreId_t     done;
+  uint32_t            reads;            // Reader calls that returned data
+  uint32_t            errors;
+} BENCH_t;
+
+static uint32_t Bytes = 4000000U;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Emulated interrupt: writes the byte stream, retries when the buffer is full.
+static void *Interrupt (void *arg) {
+  BENCH_t *b = (BENCH_t *)arg;
+  uint8_t  chunk[64];
+  uint32_t seq = 0U;
+  uint32_t size;
+  uint32_t n;
+
+  while (seq < Bytes) {
+    size = (b->chunk < (Bytes - seq)) ? b->chunk : (Bytes - seq);
+    for (n = 0U; n < size; n++) {
+      chunk[n] = (uint8_t)(seq + n);
+    }
+    n = 0U;
+    while (n < size) {
+      if (b->mode == MODE_MSGQ) {
+        if (osMessageQueuePut(b->mq, &chunk[n], 0U, 0U) == osOK) {
+          n++;
+          continue;
+        }
+      } else {
+        n += osStreamBufferWrite(b->sb, &chunk[n], size - n, 0U);
+        if (n == size) {
+          continue;
+        }
+      }
+      (void)sched_yield();              // Buffer full: let the reader run
+    }
+    seq += size;
+  }
+  return NULL;
+}
+
+// Reader thread: reads the byte stream and checks the sequence.
+static void Reader (void *argument) {
+  BENCH_t *b = (BENCH_t *)argument;
+  uint8_t  buf[READ_MAX];
+  uint8_t *data;
+  uint32_t seq = 0U;
+  uint32_t size;
+  uint32_t n;
+
+  while (seq < Bytes) {
+    data = buf;
+    if (b->mode == MODE_MSGQ) {
+      size = osMessageQueueGetN(b->mq, buf, READ_MAX, NULL, 100U);
+    } else if (b->mode == MODE_READ) {
+      size = osStreamBufferRead(b->sb, buf, READ_MAX, 100U);
+    } else {
+      data = (uint8_t *)osStreamBufferGetSpan(b->sb, &size, 100U);
+    }
+    if (size == 0U) {
+      continue;
+    }
+    for (n = 0U; n < size; n++) {
+      if (data[n] != (uint8_t)(seq + n)) {
+        b->errors++;
+        break;
+      }
+    }
+    if (b->mode == MODE_SPAN) {
+      (void)osStreamBufferConsume(b->sb, size);
+    }
+    seq += size;
+    b->reads++;
+  }
+  (void)osSemaphoreRelease(b->done);
+}
+
+// Run one configuration.
+static void Run (uint32_t mode, uint32_t chunk, uint32_t trigger) {
+  static const char * const name[] = { "osMessageQueue", "osStreamBufferRead", "osStreamBufferGetSpan" };
+  BENCH_t   b = { 0 };
+  pthread_t irq;
+  uint64_t  t0, t1;
+
+  b.mode    = mode;
+  b.chunk   = chunk;
+  b.trigger = trigger;
+  b.mq      = osMessageQueueNew(BUFFER_SIZE, 1U, NULL);
+  b.sb      = osStreamBufferNew(BUFFER_SIZE, trigger, NULL);
+  b.done    = osSemaphoreNew(1U, 0U, NULL);
+  if ((b.mq == NULL) || (b.sb == NULL) || (b.done == NULL)) {
+    printf("object creation failed\n");
+    exit(1);
+  }
+
+  (void)osThreadNew(Reader, &b, NULL);
+
+  t0 = GetTime_ns();
+  (void)pthread_create(&irq, NULL, Interrupt, &b);
+  (void)osSemaphoreAcquire(b.done, osWaitForever);
+  t1 = GetTime_ns();
+  (void)pthread_join(irq, NULL);
+
+  printf("  %-22s %5u %7u %10.1f %10u %10.1f %7u\n", name[mode], chunk, (mode == MODE_MSGQ) ? 1U : trigger,
+         ((double)Bytes * 1e3) / (double)(t1 - t0), b.reads, (double)Bytes / b.reads, b.errors);
+
+  (void)osMessageQueueDelete(b.mq);
+  (void)osStreamBufferDelete(b.sb);
+  (void)osSemaphoreDelete(b.done);
+}
+
+// Benchmark main thread.
+static void Bench (void *argument) {
+  static const uint32_t chunk[] = { 1U, 8U, 64U };
+  uint32_t n;
+  (void)argument;
+
+  printf("CMSIS-RTOS2 stream buffer benchmark: %u bytes from an emulated interrupt to a thread\n", Bytes);
+  printf("  scheduler: %s, buffer: %u bytes, reads of up to %u bytes\n\n",
+         (osPosixKernelGetSchedMode() == osPosixSchedDeterministic) ? "deterministic" : "concurrent",
+         BUFFER_SIZE, READ_MAX);
+  printf("  %-22s %5s %7s %10s %10s %10s %7s\n",
+         "reader", "chunk", "trigger", "MB/s", "reads", "bytes/read", "errors");
+
+  for (n = 0U; n < (sizeof(chunk) / sizeof(chunk[0])); n++) {
+    Run(MODE_MSGQ, chunk[n], 1U);
+    Run(MODE_READ, chunk[n], 1U);
+    Run(MODE_READ, chunk[n], 32U);
+    Run(MODE_SPAN, chunk[n], 32U);
+  }
+
+  exit(0);
+}
+
+int main (int argc, char *argv[]) {
+  int i;
+
+  (void)osKernelInitialize();
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "concurrent") == 0) {
+      (void)osPosixKernelSetSchedMode(osPosixSchedConcurrent);
+    } else {
+      Bytes = (uint32_t)strtoul(argv[i], NULL, 0);
+    }
+  }
+  if (Bytes == 0U) {
+    Bytes = 4000000U;
+  }
+
+  (void)osThreadNew(Bench, NULL, NULL);
+  (void)osKernelStart();
+
+  return 0;
+}
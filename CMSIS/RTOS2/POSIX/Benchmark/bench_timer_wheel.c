@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Timer service benchmark
+ *
+ * Measures the timer service with a large number of armed timers:
+ *  - cost of osTimerStart, restart (osTimerStart of a running timer) and
+ *    osTimerStop with all timers armed
+ *  - expiry of one-shot timers with random timeouts: callbacks executed
+ *    and lateness (ticks between expiry and callback execution)
+ *  - periodic timers with random periods running concurrently
+ *
+ * Usage: bench_timer_wheel [timers]
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define FLAG_DONE       0x01U           // All callbacks executed
+
+static uint32_t     Timers = 10000U;
+static osTimerId_t *Timer;
+static uint32_t    *Expect;             // Expected expiry tick
+static uint32_t    *Period;             // Period of periodic timers
+static osThreadId_t BenchThread;
+static uint32_t     Random = 1U;
+
+// Callback statistics (timer thread)
+static uint32_t     Fired;
+static uint32_t     FiredTarget;
+static uint32_t     LateMax;
+static uint64_t     LateSum;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Get a pseudo random number in the range 1..range.
+static uint32_t GetRandom (uint32_t range) {
+  Random = (Random * 1103515245U) + 12345U;
+  return (((Random >> 8) % range) + 1U);
+}
+
+// Timer callback: record lateness against the expected expiry tick.
+static void TimerCallback (void *argument) {
+  uint32_t n    = (uint32_t)(uintptr_t)argument;
+  uint32_t late = osKernelGetTickCount() - Expect[n];
+
+  if ((int32_t)late < 0) {
+    late = 0U;
+  }
+  if (late > LateMax) {
+    LateMax = late;
+  }
+  LateSum += late;
+  Expect[n] += Period[n];
+
+  Fired++;
+  if (Fired == FiredTarget) {
+    (void)osThreadFlagsSet(BenchThread, FLAG_DONE);
+  }
+}
+
+// Create all timers.
+static int CreateTimers (osTimerType_t type) {
+  uint32_t n;
+
+  for (n = 0U; n < Timers; n++) {
+    Timer[n] = osTimerNew(TimerCallback, type, (void *)(uintptr_t)n, NULL);
+    if (Timer[n] == NULL) {
+      return -1;
+    }
+    Period[n] = 0U;
+  }
+  return 0;
+}
+
+// Delete all timers.
+static void DeleteTimers (void) {
+  uint32_t n;
+
+  for (n = 0U; n < Timers; n++) {
+    (void)osTimerDelete(Timer[n]);
+  }
+}
+
+// Start, restart and stop cost with all timers armed.
+static void BenchStartStop (void) {
+  uint64_t t0, t1, t2, t3;
+  uint32_t n;
+
+  if (CreateTimers(osTimerOnce) != 0) {
+    printf("timer creation failed\n");
+    return;
+  }
+
+  // Long timeouts: no timer expires during the measurement
+  t0 = GetTime_ns();
+  for (n = 0U; n < Timers; n++) {
+    (void)osTimerStart(Timer[n], 100000U + GetRandom(100000U));
+  }
+  t1 = GetTime_ns();
+  for (n = 0U; n < Timers; n++) {
+    (void)osTimerStart(Timer[GetRandom(Timers) - 1U], 100000U + GetRandom(100000U));
+  }
+  t2 = GetTime_ns();
+  for (n = 0U; n < Timers; n++) {
+    (void)osTimerStop(Timer[n]);
+  }
+  t3 = GetTime_ns();
+
+  printf("  %-28s %10.1f ns/op\n", "osTimerStart",           (double)(t1 - t0) / Timers);
+  printf("  %-28s %10.1f ns/op\n", "osTimerStart (restart)", (double)(t2 - t1) / Timers);
+  printf("  %-28s %10.1f ns/op\n", "osTimerStop",            (double)(t3 - t2) / Timers);
+
+  DeleteTimers();
+}
+
+// Expiry of one-shot or periodic timers with random timeouts.
+static void BenchExpiry (osTimerType_t type, uint32_t range, uint32_t rounds) {
+  uint32_t tick;
+  uint32_t ticks;
+  uint32_t flags;
+  uint32_t n;
+  uint64_t t0, t1;
+
+  if (CreateTimers(type) != 0) {
+    printf("timer creation failed\n");
+    return;
+  }
+
+  Fired       = 0U;
+  FiredTarget = Timers * rounds;
+  LateMax     = 0U;
+  LateSum     = 0U;
+
+  (void)osThreadFlagsClear(FLAG_DONE);
+  t0 = GetTime_ns();
+
+  // Start all timers within one tick
+  (void)osKernelLock();
+  tick = osKernelGetTickCount();
+  for (n = 0U; n < Timers; n++) {
+    ticks = GetRandom(range);
+    Expect[n] = tick + ticks;
+    if (type == osTimerPeriodic) {
+      Period[n] = ticks;
+    }
+    (void)osTimerStart(Timer[n], ticks);
+  }
+  (void)osKernelUnlock();
+
+  flags = osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, (range * rounds) + 5000U);
+  t1 = GetTime_ns();
+
+  for (n = 0U; n < Timers; n++) {
+    (void)osTimerStop(Timer[n]);
+  }
+
+  printf("  %-28s %10u callbacks in %.0f ms, lateness avg %.2f max %u ticks%s\n",
+         (type == osTimerOnce) ? "one-shot expiry" : "periodic expiry",
+         Fired, (double)(t1 - t0) / 1e6,
+         (Fired != 0U) ? ((double)LateSum / Fired) : 0.0, LateMax,
+         ((flags & osFlagsError) != 0U) ? " (timeout)" : "");
+
+  DeleteTimers();
+}
+
+// Benchmark thread.
+static void Bench (void *argument) {
+  (void)argument;
+
+  BenchThread = osThreadGetId();
+
+  printf("Timer service benchmark: %u timers, tick %u Hz\n", Timers, osKernelGetTickFreq());
+
+  BenchStartStop();
+  BenchExpiry(osTimerOnce,     1000U, 1U);
+  BenchExpiry(osTimerPeriodic, 100U,  10U);
+
+  exit(0);
+}
+
+int main (int argc, char *argv[]) {
+  osThreadAttr_t attr = { 0 };
+
+  if (argc > 1) {
+    Timers = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  Timer  = calloc(Timers, sizeof(osTimerId_t));
+  Expect = calloc(Timers, sizeof(uint32_t));
+  Period = calloc(Timers, sizeof(uint32_t));
+  if ((Timers == 0U) || (Timer == NULL) || (Expect == NULL) || (Period == NULL)) {
+    return 1;
+  }
+
+  (void)osKernelInitialize();
+  attr.name     = "Bench";
+  attr.priority = osPriorityNormal;
+  (void)osThreadNew(Bench, NULL, &attr);
+  (void)osKernelStart();
+
+  return 0;
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Work Queue benchmark
+ *
+ * An emulated interrupt (a host thread) defers work in bursts of 1..16 items.
+ * The work is executed by a hand-rolled handler thread that reads item
+ * pointers from a message queue, and by osWorkQueue with one and with four
+ * workers. Every 8th item is urgent: it is put to the front of the message
+ * queue (message priority) or submitted to the high priority lane.
+ * Reported are the throughput and the submit-to-execute latency of normal
+ * and urgent items.
+ *
+ * Usage: bench_workqueue [items] [concurrent]
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define ITEM_COUNT      64U             // Pre-allocated work items
+#define URGENT_RATE     8U              // Every n-th item is urgent
+
+#define MODE_MSGQ       0U              // Handler thread with osMessageQueueGet
+#define MODE_WQ         1U              // osWorkQueue
+
+typedef struct {
+  osWorkId_t          work;
+  uint64_t            t_submit;         // Host time of submission [ns]
+  uint32_t            urgent;
+  uint32_t            done;
+} ITEM_t;
+
+typedef struct {
+  uint32_t            mode;
+  uint32_t            burst;            // Items per emulated interrupt
+  uint32_t            workers;
+  osMessageQueueId_t  mq;
+  osWorkQueueId_t     wq;
+  osSemaphoreId_t     finished;
+  ITEM_t              item[ITEM_COUNT];
+  uint32_t            executed;
+  uint64_t            lat_sum[2];       // Latency sum (normal, urgent) [ns]
+  uint64_t            lat_max[2];
+  uint32_t            lat_cnt[2];
+} BENCH_t;
+
+static uint32_t Items = 200000U;
+static BENCH_t  Bench;
+
+// Get monotonic host time in nanoseconds.
+static uint64_t GetTime_ns (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Deferred work: record latency and release the item.
+static void Work (void *argument) {
+  ITEM_t  *item = (ITEM_t *)argument;
+  BENCH_t *b    = &Bench;
+  uint64_t lat  = GetTime_ns() - item->t_submit;
+  uint32_t n    = item->urgent;
+
+  (void)osKernelLock();                 // Serialize statistics between workers
+  b->lat_sum[n] += lat;
+  b->lat_cnt[n]++;
+  if (lat > b->lat_max[n]) {
+    b->lat_max[n] = lat;
+  }
+  b->executed++;
+  if (b->executed == Items) {
+    (void)osSemaphoreRelease(b->finished);
+  }
+  (void)osKernelUnlock();
+
+  __atomic_store_n(&item->done, 1U, __ATOMIC_RELEASE);
+}
+
+// Hand-rolled bottom half: handler thread reading item pointers from a message queue.
+static void Handler (void *argument) {
+  BENCH_t *b = (BENCH_t *)argument;
+  ITEM_t  *item;
+
+  for (;;) {
+    if (osMessageQueueGet(b->mq, &item, NULL, osWaitForever) != osOK) {
+      break;
+    }
+    do {
+      Work(item);
+    } while (osMessageQueueGet(b->mq, &item, NULL, 0U) == osOK);
+  }
+}
+
+// Emulated interrupt: submits bursts of work items.
+static void *Interrupt (void *arg) {
+  BENCH_t *b = (BENCH_t *)arg;
+  ITEM_t  *item;
+  uint32_t seq = 0U;
+  uint32_t idx = 0U;
+  uint32_t n;
+
+  while (seq < Items) {
+    for (n = 0U; (n < b->burst) && (seq < Items); n++) {
+      item = &b->item[idx];
+      while (__atomic_load_n(&item->done, __ATOMIC_ACQUIRE) == 0U) {
+        (void)sched_yield();            // Item still pending: let the handler run
+      }
+      item->done     = 0U;
+      item->urgent   = ((seq % URGENT_RATE) == 0U) ? 1U : 0U;
+      item->t_submit = GetTime_ns();
+      if (b->mode == MODE_MSGQ) {
+        (void)osMessageQueuePut(b->mq, &item, (uint8_t)item->urgent, 0U);
+      } else {
+        (void)osWorkSubmit(b->wq, item->work, item->urgent);
+      }
+      idx = (idx + 1U) % ITEM_COUNT;
+      seq++;
+    }
+    (void)sched_yield();
+  }
+  return NULL;
+}
+
+// Run one configuration.
+static void Run (uint32_t mode, uint32_t burst, uint32_t workers) {
+  static const char * const name[] = { "handler thread + msgq", "osWorkQueue" };
+  BENCH_t          *b = &Bench;
+  osWorkQueueAttr_t wq_attr;
+  osThreadId_t      handler = NULL;
+  pthread_t         irq;
+  uint64_t          t0, t1;
+  uint32_t          n;
+
+  (void)memset(b, 0, sizeof(BENCH_t));
+  b->mode     = mode;
+  b->burst    = burst;
+  b->workers  = workers;
+  b->finished = osSemaphoreNew(1U, 0U, NULL);
+
+  if (mode == MODE_MSGQ) {
+    b->mq   = osMessageQueueNew(ITEM_COUNT, sizeof(ITEM_t *), NULL);
+    handler = osThreadNew(Handler, b, &(osThreadAttr_t){ .priority = osPriorityHigh });
+  } else {
+    (void)memset(&wq_attr, 0, sizeof(wq_attr));
+    wq_attr.priority = osPriorityHigh;
+    wq_attr.workers  = workers;
+    wq_attr.lanes    = 2U;
+    b->wq = osWorkQueueNew(&wq_attr);
+  }
+  for (n = 0U; n < ITEM_COUNT; n++) {
+    b->item[n].work = osWorkNew(Work, &b->item[n], NULL);
+    b->item[n].done = 1U;
+  }
+  if ((b->finished == NULL) || ((b->mq == NULL) && (b->wq == NULL))) {
+    printf("object creation failed\n");
+    exit(1);
+  }
+
+  t0 = GetTime_ns();
+  (void)pthread_create(&irq, NULL, Interrupt, b);
+  (void)osSemaphoreAcquire(b->finished, osWaitForever);
+  t1 = GetTime_ns();
+  (void)pthread_join(irq, NULL);
+
+  if (mode == MODE_MSGQ) {
+    (void)osThreadTerminate(handler);
+    (void)osMessageQueueDelete(b->mq);
+  } else {
+    (void)osWorkQueueDelete(b->wq);
+  }
+  for (n = 0U; n < ITEM_COUNT; n++) {
+    (void)osWorkDelete(b->item[n].work);
+  }
+  (void)osSemaphoreDelete(b->finished);
+
+  printf("  %-22s %7u %5u %10.0f %10.1f %10.1f %10.1f\n",
+         name[mode], workers, burst, ((double)Items * 1e9) / (double)(t1 - t0),
+         (double)b->lat_sum[0] / (1e3 * (double)b->lat_cnt[0]),
+         (double)b->lat_sum[1] / (1e3 * (double)b->lat_cnt[1]),
+         (double)b->lat_max[1] / 1e3);
+}
+
+// Benchmark main thread.
+static void Main (void *argument) {
+  static const uint32_t burst[] = { 1U, 4U, 16U };
+  uint32_t n;
+  (void)argument;
+
+  printf("CMSIS-RTOS2 work queue benchmark: %u work items deferred from an emulated interrupt\n", Items);
+  printf("  scheduler: %s, every %u. item urgent (high lane / message priority)\n\n",
+         (osPosixKernelGetSchedMode() == osPosixSchedDeterministic) ? "deterministic" : "concurrent",
+         URGENT_RATE);
+  printf("  %-22s %7s %5s %10s %10s %10s %10s\n",
+         "bottom half", "workers", "burst", "items/s", "lat [us]", "urgent", "urgent max");
+
+  for (n = 0U; n < (sizeof(burst) / sizeof(burst[0])); n++) {
+    Run(MODE_MSGQ, burst[n], 1U);
+    Run(MODE_WQ,   burst[n], 1U);
+    Run(MODE_WQ,   burst[n], 4U);
+  }
+
+  exit(0);
+}
+
+int main (int argc, char *argv[]) {
+  int i;
+
+  (void)osKernelInitialize();
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "concurrent") == 0) {
+      (void)osPosixKernelSetSchedMode(osPosixSchedConcurrent);
+    } else {
+      Items = (uint32_t)strtoul(argv[i], NULL, 0);
+    }
+  }
+  if (Items == 0U) {
+    Items = 200000U;
+  }
+
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Revision:   V1.0.0
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       POSIX host configuration definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef OS_POSIX_CONFIG_H_
+#define OS_POSIX_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>System Configuration
+// =======================
+
+//   <o>Kernel Tick Frequency [Hz] <1-1000000>
+//   <i> Defines base time unit for delays and timeouts.
+//   <i> Default: 1000 (1ms tick)
+#ifndef OS_TICK_FREQ
+#define OS_TICK_FREQ                1000
+#endif
+
+//   <o>Scheduler Mode
+//     <0=> Concurrent
+//     <1=> Deterministic
+//   <i> Concurrent: every ready thread runs on its own host CPU at full speed.
+//   <i> Deterministic: only the highest priority ready thread runs (RTOS2 priority semantics).
+//   <i> Default: Deterministic
+#ifndef OS_SCHED_MODE
+#define OS_SCHED_MODE               1
+#endif
+
+//   <e>Round-Robin Thread switching
+//   <i> Enables Round-Robin Thread switching in Deterministic mode.
+#ifndef OS_ROBIN_ENABLE
+#define OS_ROBIN_ENABLE             1
+#endif
+
+//     <o>Round-Robin Timeout <1-1000>
+//     <i> Defines how many ticks a thread will execute before a thread switch.
+//     <i> Default: 5
+#ifndef OS_ROBIN_TIMEOUT
+#define OS_ROBIN_TIMEOUT            5
+#endif
+
+//   </e>
+
+//   <o>Dynamic Memory size [bytes] <0-1073741824:8>
+//   <i> Memory for control blocks and data of objects created without user memory.
+//   <i> 0: host heap (calloc/free).
+//   <i> Otherwise: TLSF memory region "RTOS" of this size (OS Memory API, link os_mem_tlsf.c).
+//   <i> A region "RTOS" added with OS_Mem_AddRegion before osKernelInitialize is used instead.
+//   <i> Default: 0
+#ifndef OS_DYNAMIC_MEM_SIZE
+#define OS_DYNAMIC_MEM_SIZE         0
+#endif
+
+//   <q>Event Trace
+//   <i> Records thread switches, waits and simulated interrupts with the OS Trace API (link os_trace.c).
+//   <i> The application provides the trace buffer with OS_Trace_Init and starts recording with OS_Trace_Start.
+//   <i> Default: 0 (disabled)
+#ifndef OS_TRACE_ENABLE
+#define OS_TRACE_ENABLE             0
+#endif
+
+// </h>
+
+// <h>Thread Configuration
+// =======================
+
+//   <o>Default Thread Stack size [bytes] <96-1073741824:8>
+//   <i> Defines stack size reported for threads created without a stack size.
+//   <i> Default: 3072
+#ifndef OS_STACK_SIZE
+#define OS_STACK_SIZE               3072
+#endif
+
+//   <o>Minimum Host Stack size [bytes] <16384-1073741824:4096>
+//   <i> Host threads are created with at least this stack size since
+//   <i> host code paths (libc, sanitizers) need far more stack than the target.
+//   <i> Default: 262144
+#ifndef OS_HOST_STACK_MIN
+#define OS_HOST_STACK_MIN           262144
+#endif
+
+// </h>
+
+// <h>Timer Configuration
+// ======================
+
+//   <o>Timer Thread Priority
+//      <8=> Low
+//     <16=> Below Normal  <24=> Normal  <32=> Above Normal
+//     <40=> High
+//     <48=> Realtime
+//   <i> Defines priority for timer thread
+//   <i> Default: High
+#ifndef OS_TIMER_THREAD_PRIO
+#define OS_TIMER_THREAD_PRIO        40
+#endif
+
+//   <o>Timer Wheel Slot Bits <2-8>
+//   <i> Each timer wheel level has 2^bits slots of equal duration.
+//   <i> Default: 6 (64 slots)
+#ifndef OS_TIMER_WHEEL_BITS
+#define OS_TIMER_WHEEL_BITS         6
+#endif
+
+//   <o>Timer Wheel Levels <1-8>
+//   <i> Level n covers timeouts up to 2^(bits*(n+1)) ticks.
+//   <i> Longer timeouts are re-inserted at the top level.
+//   <i> Default: 4 (2^24 ticks)
+#ifndef OS_TIMER_WHEEL_LEVELS
+#define OS_TIMER_WHEEL_LEVELS       4
+#endif
+
+// </h>
+
+//------------- <<< end of configuration section >>> ---------------------------
+
+#endif  // OS_POSIX_CONFIG_H_
@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Date:        17. October 2024
+ * $Revision:    V1.0.0
+ *
+ * Project:      CMSIS-RTOS2 POSIX Host Implementation
+ * Title:        POSIX host specific definitions
+ *
+ * Version 1.0.0
+ *    Initial Release
+ *---------------------------------------------------------------------------*/
+
+#ifndef OS_POSIX_H_
+#define OS_POSIX_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "cmsis_os2.h"
+#include "os_tick.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+
+/// Kernel Information
+#define osPosixVersionAPI      20040000   ///< API version (2.4.0)
+#define osPosixVersionKernel   10000000   ///< Kernel version (1.0.0)
+#define osPosixKernelId     "POSIX V1.0.0"  ///< Kernel identification string
+
+
+//  ==== Common definitions ====
+
+/// Object Identifier definitions
+#define osPosixIdInvalid            0x00U
+#define osPosixIdThread             0xF1U
+#define osPosixIdTimer              0xF2U
+#define osPosixIdEventFlags         0xF3U
+#define osPosixIdMutex              0xF4U
+#define osPosixIdSemaphore          0xF5U
+#define osPosixIdMemoryPool         0xF6U
+#define osPosixIdMessageQueue       0xF8U
+#define osPosixIdRwLock             0xF9U
+#define osPosixIdStreamBuffer       0xFAU
+#define osPosixIdWorkQueue          0xFBU
+#define osPosixIdWork               0xFCU
+
+/// Object Flags definitions
+#define osPosixFlagSystemObject     0x01U   ///< Control block allocated by the kernel
+#define osPosixFlagSystemMemory     0x02U   ///< Data storage allocated by the kernel
+
+/// Object Attribute definitions
+#define osPosixAttrClass_Pos        4U
+#define osPosixAttrClass_Msk        0xF0U
+
+
+//  ==== Kernel definitions ====
+
+/// Kernel State definitions
+#define osPosixKernelInactive       ((uint8_t)osKernelInactive)
+#define osPosixKernelReady          ((uint8_t)osKernelReady)
+#define osPosixKernelRunning        ((uint8_t)osKernelRunning)
+#define osPosixKernelLocked         ((uint8_t)osKernelLocked)
+#define osPosixKernelSuspended      ((uint8_t)osKernelSuspended)
+
+/// Scheduler Mode definitions
+#define osPosixSchedConcurrent      0U      ///< All ready threads execute in parallel on host CPUs
+#define osPosixSchedDeterministic   1U      ///< Only the highest priority ready thread executes
+
+
+//  ==== Thread definitions ====
+
+/// Thread State definitions (extending osThreadState)
+#define osPosixThreadStateMask      0x0FU
+
+#define osPosixThreadInactive       ((uint8_t)osThreadInactive)
+#define osPosixThreadReady          ((uint8_t)osThreadReady)
+#define osPosixThreadRunning        ((uint8_t)osThreadRunning)
+#define osPosixThreadBlocked        ((uint8_t)osThreadBlocked)
+#define osPosixThreadTerminated     ((uint8_t)osThreadTerminated)
+
+#define osPosixThreadWaitingDelay       ((uint8_t)(osPosixThreadBlocked | 0x10U))
+#define osPosixThreadWaitingJoin        ((uint8_t)(osPosixThreadBlocked | 0x20U))
+#define osPosixThreadWaitingThreadFlags ((uint8_t)(osPosixThreadBlocked | 0x30U))
+#define osPosixThreadWaitingEventFlags  ((uint8_t)(osPosixThreadBlocked | 0x40U))
+#define osPosixThreadWaitingMutex       ((uint8_t)(osPosixThreadBlocked | 0x50U))
+#define osPosixThreadWaitingSemaphore   ((uint8_t)(osPosixThreadBlocked | 0x60U))
+#define osPosixThreadWaitingMemoryPool  ((uint8_t)(osPosixThreadBlocked | 0x70U))
+#define osPosixThreadWaitingMessageGet  ((uint8_t)(osPosixThreadBlocked | 0x80U))
+#define osPosixThreadWaitingMessagePut  ((uint8_t)(osPosixThreadBlocked | 0x90U))
+#define osPosixThreadWaitingTimer       ((uint8_t)(osPosixThreadBlocked | 0xA0U))
+#define osPosixThreadWaitingMultiple    ((uint8_t)(osPosixThreadBlocked | 0xB0U))
+#define osPosixThreadWaitingRwLock      ((uint8_t)(osPosixThreadBlocked | 0xC0U))
+#define osPosixThreadWaitingStreamRead  ((uint8_t)(osPosixThreadBlocked | 0xD0U))
+#define osPosixThreadWaitingStreamWrite ((uint8_t)(osPosixThreadBlocked | 0xE0U))
+#define osPosixThreadWaitingWork        ((uint8_t)(osPosixThreadBlocked | 0xF0U))
+
+/// Thread Flags definitions
+#define osPosixThreadFlagTerminate  0x10U   ///< Termination requested by another thread
+#define osPosixThreadFlagExited     0x20U   ///< Host thread has left the kernel
+#define osPosixThreadFlagSuspended  0x40U   ///< Suspended by osThreadSuspend
+
+/// Common Object Control Block
+typedef struct os_object_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  struct os_object_s    *object_next;   ///< Link pointer to next Object in kernel object list
+  struct os_object_s    *object_prev;   ///< Link pointer to previous Object in kernel object list
+} os_object_t;
+
+/// Thread Control Block
+typedef struct os_thread_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  struct os_thread_s     *thread_next;  ///< Link pointer to next Thread in Object list (ready or waiting)
+  struct os_thread_s     *thread_prev;  ///< Link pointer to previous Thread in Object list
+  struct os_thread_s    **thread_list;  ///< Object list the Thread is linked into (NULL if none)
+  struct os_thread_s      *delay_next;  ///< Link pointer to next Thread in Delay list
+  struct os_thread_s      *delay_prev;  ///< Link pointer to previous Thread in Delay list
+  struct os_thread_s     *thread_join;  ///< Thread waiting to Join
+  uint32_t                      delay;  ///< Delay Time (relative to previous entry in Delay list)
+  uint32_t                delay_count;  ///< System Timer count to wake up (sub-tick Delay)
+  int8_t                     priority;  ///< Thread Priority
+  int8_t                priority_base;  ///< Base Priority
+  uint8_t                 wait_option;  ///< Wait Option (flags)
+  uint8_t                    reserved;
+  uint32_t                 wait_flags;  ///< Wait Flags
+  uint32_t               thread_flags;  ///< Thread Flags
+  uint32_t                   wait_ret;  ///< Wait result (status code or flags)
+  void                     *wait_info;  ///< Wait information (object or buffer pointer)
+  void                    *wait_extra;  ///< Wait information (message priority pointer)
+  struct os_mutex_s       *mutex_list;  ///< Link pointer to list of owned Mutexes
+  struct os_rwlock_s     *rwlock_list;  ///< Link pointer to list of exclusively owned Reader-Writer Locks
+  struct os_mp_cache_s      *mp_cache;  ///< Link pointer to list of Memory Pool caches of the Thread
+  uint32_t                 stack_size;  ///< Stack Size
+  uint32_t                       zone;  ///< Thread Zone
+  uint32_t              affinity_mask;  ///< Processor Affinity Mask
+  uint32_t                wdog_reload;  ///< Watchdog reload value (0 = inactive)
+  uint32_t                  wdog_tick;  ///< Watchdog remaining ticks
+  uint32_t                 robin_tick;  ///< Round Robin remaining ticks
+  uint64_t                    runtime;  ///< Execution time (runtime counter units)
+  osThreadFunc_t                 func;  ///< Thread Function
+  void                      *argument;  ///< Thread Function Argument
+  pthread_t                   pthread;  ///< Host Thread
+  pthread_cond_t                 cond;  ///< Host Condition (signaled when Thread may run)
+} os_thread_t;
+
+
+//  ==== Timer definitions ====
+
+/// Timer State definitions
+#define osPosixTimerInactive        0x00U   ///< Timer Inactive
+#define osPosixTimerStopped         0x01U   ///< Timer Stopped
+#define osPosixTimerRunning         0x02U   ///< Timer Running
+
+/// Timer Type definitions
+#define osPosixTimerPeriodic        ((uint8_t)osTimerPeriodic)
+
+/// Timer Flags definitions
+#define osPosixTimerFlagLocked      0x10U   ///< Callback executes with the kernel lock held (kernel internal Timer)
+
+/// Timer List Link (circular list: timer wheel slot or expired list)
+typedef struct os_timer_link_s {
+  struct os_timer_link_s        *next;  ///< Pointer to next Link
+  struct os_timer_link_s        *prev;  ///< Pointer to previous Link
+} os_timer_link_t;
+
+/// Timer Control Block
+typedef struct os_timer_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_timer_link_t                link;  ///< Link into timer wheel slot or expired list
+  uint32_t                    expires;  ///< Expiry time (timer wheel ticks)
+  uint32_t                       load;  ///< Timer Load value
+  uint8_t                        type;  ///< Timer Type
+  uint8_t                    reserved[3];
+  osTimerFunc_t                  func;  ///< Timer Function
+  void                           *arg;  ///< Timer Function Argument
+} os_timer_t;
+
+
+//  ==== Event Flags definitions ====
+
+/// Event Flags Control Block
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  uint32_t                event_flags;  ///< Event Flags
+} os_event_flags_t;
+
+
+//  ==== Mutex definitions ====
+
+/// Mutex Control Block
+typedef struct os_mutex_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  os_thread_t           *owner_thread;  ///< Owner Thread
+  struct os_mutex_s       *owner_prev;  ///< Pointer to previous Mutex in Owner Thread list
+  struct os_mutex_s       *owner_next;  ///< Pointer to next Mutex in Owner Thread list
+  uint8_t                    mutex_attr; ///< Mutex Attributes (osMutexRecursive, ...)
+  uint8_t                    reserved;
+  uint16_t                       lock;  ///< Lock counter
+} os_mutex_t;
+
+
+//  ==== Reader-Writer Lock definitions ====
+
+/// Reader-Writer Lock Control Block
+typedef struct os_rwlock_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List (readers and writers)
+  os_thread_t           *owner_thread;  ///< Exclusive Owner Thread
+  struct os_rwlock_s      *owner_prev;  ///< Pointer to previous Reader-Writer Lock in Owner Thread list
+  struct os_rwlock_s      *owner_next;  ///< Pointer to next Reader-Writer Lock in Owner Thread list
+  uint32_t                    readers;  ///< Number of shared owners
+} os_rwlock_t;
+
+
+//  ==== Semaphore definitions ====
+
+/// Semaphore Control Block
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  uint32_t                     tokens;  ///< Current number of tokens
+  uint32_t                 max_tokens;  ///< Maximum number of tokens
+} os_semaphore_t;
+
+
+//  ==== Memory Pool definitions ====
+
+/// Memory Pool Information
+typedef struct {
+  uint32_t                max_blocks;  ///< Maximum number of Blocks
+  uint32_t               used_blocks;  ///< Number of used Blocks
+  uint32_t                block_size;  ///< Block Size
+  void                    *block_base;  ///< Block Memory Base Address
+  void                     *block_lim;  ///< Block Memory Limit Address
+  void                    *block_free;  ///< First free Block Address
+} os_mp_info_t;
+
+/// Memory Pool Cache (magazine of free blocks for one Thread or processor)
+typedef struct os_mp_cache_s {
+  struct os_mp_cache_s     *pool_next;  ///< Link pointer to next Cache of the Memory Pool
+  struct os_mp_cache_s   *thread_next;  ///< Link pointer to next Cache of the owner Thread
+  struct os_memory_pool_s         *mp;  ///< Memory Pool (NULL when the Memory Pool was deleted)
+  os_thread_t                 *thread;  ///< Owner Thread (NULL for a per-processor Cache)
+  uint32_t                        cpu;  ///< Processor number (per-processor Cache)
+  uint32_t                      count;  ///< Number of cached Blocks
+  uint32_t                alloc_count;  ///< Number of allocations
+  uint32_t                 alloc_hits;  ///< Number of allocations served from the Cache
+  uint32_t                 free_count;  ///< Number of returned Blocks
+  uint32_t                  free_hits;  ///< Number of returned Blocks kept in the Cache
+  pthread_mutex_t                lock;  ///< Cache lock (uncontended except for reclaim by the kernel)
+  void                       *block[];  ///< Cached Blocks (cache_depth entries)
+} os_mp_cache_t;
+
+/// Memory Pool Control Block
+typedef struct os_memory_pool_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  os_mp_info_t                mp_info;  ///< Memory Pool Info
+  uint32_t                   max_used;  ///< High-water mark of used Blocks (including cached Blocks)
+  uint32_t                cache_depth;  ///< Cache depth in Blocks (0: no caching)
+  uint32_t                 cache_wait;  ///< Threads are waiting: Blocks bypass the Caches on free
+  uint32_t                *block_used;  ///< Bitmap of Blocks owned by the application (with caching)
+  os_mp_cache_t         *thread_cache;  ///< Per-thread Caches (modified with kernel lock held)
+  os_mp_cache_t            *cpu_cache;  ///< Per-processor Caches (only added until the Memory Pool is deleted)
+  uint32_t                alloc_count;  ///< Allocations counted by released Caches and the shared pool
+  uint32_t                 alloc_hits;  ///< Cache hits of released Caches
+  uint32_t                 free_count;  ///< Returned Blocks counted by released Caches and the shared pool
+  uint32_t                  free_hits;  ///< Cache hits of released Caches
+} os_memory_pool_t;
+
+
+//  ==== Message Queue definitions ====
+
+/// Message State definitions
+#define osPosixMessageQueued        0x00U   ///< Message free or queued
+#define osPosixMessageAcquired      0x01U   ///< Message slot reserved by osMessageQueueAcquire
+#define osPosixMessageBorrowed      0x02U   ///< Message lent by osMessageQueueBorrow
+
+/// Message Control Block
+typedef struct os_message_s {
+  struct os_message_s           *prev;  ///< Pointer to previous Message
+  struct os_message_s           *next;  ///< Pointer to next Message
+  uint8_t                    priority;  ///< Message Priority
+  uint8_t                       state;  ///< Message State
+  uint8_t                    reserved[6];
+} os_message_t;
+
+/// Message Queue Control Block
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List
+  os_mp_info_t                mp_info;  ///< Memory Pool Info
+  uint32_t                   msg_size;  ///< Message Size
+  uint32_t                  msg_count;  ///< Number of queued Messages
+  os_message_t             *msg_first;  ///< Pointer to first Message
+  os_message_t              *msg_last;  ///< Pointer to last Message
+} os_message_queue_t;
+
+
+//  ==== Stream Buffer definitions ====
+
+/// Stream Buffer Control Block
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List (reader and writer)
+  uint8_t                       *data;  ///< Data Storage
+  uint32_t                       size;  ///< Capacity in bytes
+  uint32_t                    trigger;  ///< Trigger Level
+  volatile uint32_t              head;  ///< Write index (0 .. 2*size-1, written by the writer only)
+  volatile uint32_t              tail;  ///< Read index (0 .. 2*size-1, written by the reader only)
+  volatile uint32_t         read_need;  ///< Bytes a blocked reader waits for (0: no reader waiting)
+  volatile uint32_t        write_need;  ///< Free bytes a blocked writer waits for (0: no writer waiting)
+} os_stream_buffer_t;
+
+
+//  ==== Work Queue definitions ====
+
+/// Work Queue State definitions
+#define osPosixWorkQueueInactive    0x00U   ///< Work Queue Inactive
+#define osPosixWorkQueueActive      0x01U   ///< Work Queue Active
+#define osPosixWorkQueueDeleting    0x02U   ///< Work Queue being deleted (workers exit)
+
+/// Work State definitions
+#define osPosixWorkIdle             0x00U   ///< Work not pending (may be executing)
+#define osPosixWorkQueued           0x01U   ///< Work queued in a priority lane
+#define osPosixWorkDelayed          0x02U   ///< Work waiting for its delay Timer
+
+/// Maximum number of priority lanes
+#define osPosixWorkQueueLanesMax    8U
+
+/// Work Control Block
+typedef struct os_work_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  struct os_work_s             *next;  ///< Link pointer to next Work in lane or delayed list
+  struct os_work_s             *prev;  ///< Link pointer to previous Work in lane or delayed list
+  struct os_work_queue_s         *wq;  ///< Work Queue the Work is pending on (NULL if idle)
+  uint8_t                        lane;  ///< Priority lane
+  uint8_t                    reserved[3];
+  osWorkFunc_t                   func;  ///< Work Function
+  void                           *arg;  ///< Work Function Argument
+  os_timer_t                    timer;  ///< Timer for delayed submission
+} os_work_t;
+
+/// Work Queue Control Block
+typedef struct os_work_queue_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  const char                    *name;  ///< Object Name
+  os_object_t            *object_next;  ///< Link pointer to next Object in kernel object list
+  os_object_t            *object_prev;  ///< Link pointer to previous Object in kernel object list
+  os_thread_t            *thread_list;  ///< Waiting Threads List (idle workers and deleting thread)
+  os_work_t   *first[osPosixWorkQueueLanesMax]; ///< Pointer to first Work in each lane
+  os_work_t    *last[osPosixWorkQueueLanesMax]; ///< Pointer to last Work in each lane
+  os_work_t                  *delayed;  ///< Delayed Work list
+  uint32_t                  lane_mask;  ///< Non-empty lanes (bit n: lane n)
+  uint32_t                      count;  ///< Number of queued Works
+  uint32_t                      lanes;  ///< Number of priority lanes
+  uint32_t                    workers;  ///< Number of worker Threads
+  uint32_t                       wake;  ///< Worker wakeup pending (signaled, not yet running)
+} os_work_queue_t;
+
+
+//  ==== Memory size helpers ====
+
+/// Control Block sizes
+#define osPosixThreadCbSize         sizeof(os_thread_t)
+#define osPosixTimerCbSize          sizeof(os_timer_t)
+#define osPosixEventFlagsCbSize     sizeof(os_event_flags_t)
+#define osPosixMutexCbSize          sizeof(os_mutex_t)
+#define osPosixRwLockCbSize         sizeof(os_rwlock_t)
+#define osPosixSemaphoreCbSize      sizeof(os_semaphore_t)
+#define osPosixMemoryPoolCbSize     sizeof(os_memory_pool_t)
+#define osPosixMessageQueueCbSize   sizeof(os_message_queue_t)
+#define osPosixStreamBufferCbSize   sizeof(os_stream_buffer_t)
+#define osPosixWorkQueueCbSize      sizeof(os_work_queue_t)
+#define osPosixWorkCbSize           sizeof(os_work_t)
+
+/// Memory size in bytes for Memory Pool storage.
+/// \param         block_count   maximum number of memory blocks in memory pool.
+/// \param         block_size    memory block size in bytes.
+#define osPosixMemoryPoolMemSize(block_count, block_size) \
+  ((block_count) * (((block_size) + 7U) & ~7UL))
+
+/// Memory size in bytes for Message Queue storage.
+/// \param         msg_count     maximum number of messages in queue.
+/// \param         msg_size      maximum message size in bytes.
+#define osPosixMessageQueueMemSize(msg_count, msg_size) \
+  ((msg_count) * ((((msg_size) + 7U) & ~7UL) + sizeof(os_message_t)))
+
+/// Memory size in bytes for Stream Buffer storage.
+/// \param         size          capacity of the stream buffer in bytes.
+#define osPosixStreamBufferMemSize(size) \
+  (size)
+
+
+//  ==== Host Extensions ====
+
+/// Select the scheduler mode (allowed only before \ref osKernelStart).
+/// \param[in]     mode          \ref osPosixSchedConcurrent or \ref osPosixSchedDeterministic.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osPosixKernelSetSchedMode (uint32_t mode);
+
+/// Get the active scheduler mode.
+/// \return \ref osPosixSchedConcurrent or \ref osPosixSchedDeterministic.
+uint32_t osPosixKernelGetSchedMode (void);
+
+/// Enter simulated interrupt context on the calling host thread.
+void osPosixIrqEnter (void);
+
+/// Leave simulated interrupt context on the calling host thread.
+void osPosixIrqExit (void);
+
+/// Kernel tick handler (installed through \ref OS_Tick_Setup).
+void osPosixTick_Handler (void);
+
+/// OS Error Callback (called by the kernel on run-time errors).
+/// \param[in]     code          error code.
+/// \param[in]     object_id     object that caused the error.
+/// \return value is ignored.
+uint32_t osPosixErrorNotify (uint32_t code, void *object_id);
+
+/// OS Error Codes (numbering compatible with RTX5 where applicable)
+#define osPosixErrorTimerQueueOverflow   3U ///< User Timer Callback Queue overflow detected for timer.
+#define osPosixErrorHostThread           7U ///< Host thread creation failed.
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // OS_POSIX_H_
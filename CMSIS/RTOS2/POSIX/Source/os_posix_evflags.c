@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Event Flags functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  ==== Helper functions ====
+
+/// Validate event flags ID.
+static inline bool IsEventFlagsValid (const os_event_flags_t *ef) {
+  return ((ef != NULL) && (ef->id == osPosixIdEventFlags));
+}
+
+/// Check Event Flags against the wait condition and clear them.
+static uint32_t EventFlagsCheck (os_event_flags_t *ef, uint32_t flags, uint32_t options) {
+  uint32_t event_flags = ef->event_flags;
+
+  if ((options & osFlagsWaitAll) != 0U) {
+    if ((event_flags & flags) != flags) {
+      return 0U;
+    }
+  } else {
+    if ((event_flags & flags) == 0U) {
+      return 0U;
+    }
+  }
+  if ((options & osFlagsNoClear) == 0U) {
+    ef->event_flags = event_flags & ~flags;
+  }
+  return event_flags;
+}
+
+/// Destroy an Event Flags object (kernel lock held).
+static void EventFlagsDestroy (os_event_flags_t *ef) {
+  os_thread_t *thread;
+
+  // Unblock waiting threads
+  while ((thread = osPosixThreadListGet(&ef->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, osFlagsErrorResource);
+  }
+  osPosixWaitDestroy(ef);
+
+  ef->id = osPosixIdInvalid;
+  osPosixObjectRemove(ef);
+
+  if ((ef->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(ef);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Destroy an Event Flags object (osKernelDestroyClass).
+/// \param[in]  ef              event flags object.
+void osPosixEventFlagsDestroy (os_event_flags_t *ef) {
+  EventFlagsDestroy(ef);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize an Event Flags object.
+osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
+  os_event_flags_t *ef;
+  const char       *name;
+  void             *cb_mem;
+  uint32_t          cb_size;
+  uint32_t          attr_bits;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_event_flags_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    ef = (os_event_flags_t *)cb_mem;
+    (void)memset(ef, 0, sizeof(os_event_flags_t));
+  } else {
+    ef = (os_event_flags_t *)osPosixMemAlloc(sizeof(os_event_flags_t));
+    if (ef == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    ef->flags = osPosixFlagSystemObject;
+  }
+
+  ef->id   = osPosixIdEventFlags;
+  ef->attr = osPosixObjectAttrClass(attr_bits);
+  ef->name = name;
+  osPosixObjectAdd(ef);
+
+  osPosixKernelExit();
+
+  return ef;
+}
+
+/// Get name of an Event Flags object.
+const char *osEventFlagsGetName (osEventFlagsId_t ef_id) {
+  const os_event_flags_t *ef = (const os_event_flags_t *)ef_id;
+
+  if (osPosixIsIrqMode() || !IsEventFlagsValid(ef)) {
+    return NULL;
+  }
+  return ef->name;
+}
+
+/// Set the specified Event Flags.
+uint32_t osEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  os_thread_t      *thread;
+  os_thread_t      *thread_next;
+  uint32_t          event_flags;
+  uint32_t          event_flags0;
+
+  if (!IsEventFlagsValid(ef) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(ef)) {
+    osPosixKernelExit();
+    return osFlagsErrorSafetyClass;
+  }
+
+  ef->event_flags |= flags;
+  event_flags = ef->event_flags;
+
+  // Check if Threads are waiting for Event Flags
+  thread = ef->thread_list;
+  while (thread != NULL) {
+    thread_next = thread->thread_next;
+    event_flags0 = EventFlagsCheck(ef, thread->wait_flags, thread->wait_option);
+    if (event_flags0 != 0U) {
+      if ((thread->wait_option & osFlagsNoClear) == 0U) {
+        event_flags = event_flags0 & ~thread->wait_flags;
+      } else {
+        event_flags = event_flags0;
+      }
+      osPosixThreadWaitExit(thread, event_flags0);
+    }
+    thread = thread_next;
+  }
+  if (ef->event_flags != 0U) {
+    osPosixWaitNotify(ef);
+  }
+
+  osPosixKernelExit();
+
+  return event_flags;
+}
+
+/// Clear the specified Event Flags.
+uint32_t osEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  uint32_t          event_flags;
+
+  if (!IsEventFlagsValid(ef) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(ef)) {
+    event_flags = osFlagsErrorSafetyClass;
+  } else {
+    event_flags = ef->event_flags;
+    ef->event_flags &= ~flags;
+  }
+
+  osPosixKernelExit();
+
+  return event_flags;
+}
+
+/// Get the current Event Flags.
+uint32_t osEventFlagsGet (osEventFlagsId_t ef_id) {
+  const os_event_flags_t *ef = (const os_event_flags_t *)ef_id;
+
+  if (!IsEventFlagsValid(ef)) {
+    return 0U;
+  }
+  return ef->event_flags;
+}
+
+/// Wait for one or more Event Flags to become signaled.
+uint32_t osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  os_thread_t      *thread;
+  uint32_t          event_flags;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  if (!IsEventFlagsValid(ef) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(ef)) {
+    osPosixKernelExit();
+    return osFlagsErrorSafetyClass;
+  }
+
+  event_flags = EventFlagsCheck(ef, flags, options);
+  if (event_flags == 0U) {
+    if (timeout != 0U) {
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingEventFlags, timeout)) {
+        thread = osPosixThreadSelf;
+        thread->wait_flags  = flags;
+        thread->wait_option = (uint8_t)options;
+        osPosixThreadListPut(&ef->thread_list, thread);
+        event_flags = osPosixThreadWaitBlock(osFlagsErrorTimeout);
+      } else {
+        event_flags = osFlagsErrorTimeout;
+      }
+    } else {
+      event_flags = osFlagsErrorResource;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return event_flags;
+}
+
+/// Delete an Event Flags object.
+osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id) {
+  os_event_flags_t *ef = (os_event_flags_t *)ef_id;
+  osStatus_t        status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsEventFlagsValid(ef)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(ef)) {
+    status = osErrorSafetyClass;
+  } else {
+    EventFlagsDestroy(ef);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
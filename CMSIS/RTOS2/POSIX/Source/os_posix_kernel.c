@@ -0,0 +1,736 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Kernel functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  OS Runtime Information
+os_info_t osPosixInfo = {
+  .lock        = PTHREAD_MUTEX_INITIALIZER,
+  .kernel.mode = OS_SCHED_MODE
+};
+
+//  Calling context of the host thread
+__thread os_thread_t *osPosixThreadSelf;
+__thread uint32_t     osPosixIrqNest;
+
+#if (OS_DYNAMIC_MEM_SIZE != 0)
+//  Kernel memory region (OS Memory API)
+static uint64_t          osPosixMemory[(OS_DYNAMIC_MEM_SIZE + 7) / 8];
+static OS_Mem_RegionId_t osPosixMemRegion;
+#endif
+
+
+//  ==== Library functions ====
+
+/// Enter the kernel (acquire kernel lock and honor pending thread switches).
+void osPosixKernelEnter (void) {
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+
+  if ((osPosixThreadSelf != NULL) && (osPosixIrqNest == 0U)) {
+    osPosixThreadSchedule();
+  }
+}
+
+/// Exit the kernel (dispatch threads made ready and release kernel lock).
+void osPosixKernelExit (void) {
+
+  osPosixThreadDispatch();
+
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+}
+
+/// Get the system timer count (kernel lock held).
+/// \return system timer count.
+uint32_t osPosixKernelSysTimerCount (void) {
+  uint32_t tick;
+  uint32_t count;
+
+  tick  = osPosixInfo.kernel.tick;
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  return (count + (tick * OS_Tick_GetInterval()));
+}
+
+/// Allocate zero-initialized memory for objects created without user memory (kernel lock held).
+/// \param[in]  size            size of the memory in bytes.
+/// \return pointer to the memory or NULL in case of no memory is available.
+void *osPosixMemAlloc (size_t size) {
+#if (OS_DYNAMIC_MEM_SIZE != 0)
+  void *mem;
+
+  if (size > __UINT32_MAX__) {
+    return NULL;
+  }
+  mem = OS_Mem_Alloc(osPosixMemRegion, (uint32_t)size);
+  if (mem != NULL) {
+    (void)memset(mem, 0, size);
+  }
+  return mem;
+#else
+  return calloc(1U, size);
+#endif
+}
+
+/// Free memory allocated by osPosixMemAlloc (kernel lock held).
+/// \param[in]  mem             pointer to the memory.
+void osPosixMemFree (void *mem) {
+#if (OS_DYNAMIC_MEM_SIZE != 0)
+  if (mem != NULL) {
+    (void)OS_Mem_Free(mem);
+  }
+#else
+  free(mem);
+#endif
+}
+
+/// Add object to the kernel object list.
+/// \param[in]  object          object control block.
+void osPosixObjectAdd (void *object) {
+  os_object_t *obj = (os_object_t *)object;
+
+  obj->object_prev = NULL;
+  obj->object_next = osPosixInfo.object_list;
+  if (obj->object_next != NULL) {
+    obj->object_next->object_prev = obj;
+  }
+  osPosixInfo.object_list = obj;
+}
+
+/// Remove object from the kernel object list.
+/// \param[in]  object          object control block.
+void osPosixObjectRemove (void *object) {
+  os_object_t *obj = (os_object_t *)object;
+
+  if (obj->object_next != NULL) {
+    obj->object_next->object_prev = obj->object_prev;
+  }
+  if (obj->object_prev != NULL) {
+    obj->object_prev->object_next = obj->object_next;
+  } else {
+    osPosixInfo.object_list = obj->object_next;
+  }
+  obj->object_next = NULL;
+  obj->object_prev = NULL;
+}
+
+/// Check if object safety class matches the specified class and mode.
+/// \param[in]  object          object control block.
+/// \param[in]  safety_class    safety class.
+/// \param[in]  mode            safety mode.
+/// \return true - match, false - no match.
+bool osPosixObjectClassMatch (const void *object, uint32_t safety_class, uint32_t mode) {
+  uint32_t object_class = osPosixObjectClass(object);
+
+  if (((mode & osSafetyWithSameClass)  != 0U) && (object_class == safety_class)) {
+    return true;
+  }
+  if (((mode & osSafetyWithLowerClass) != 0U) && (object_class <  safety_class)) {
+    return true;
+  }
+  return false;
+}
+
+/// Check kernel protection against the calling thread.
+static bool KernelProtectAllowed (void) {
+  uint32_t protect_class;
+
+  if ((osPosixInfo.kernel.protect & osPosixKernelProtectClass) == 0U) {
+    return true;
+  }
+  if (osPosixThreadSelf == NULL) {
+    return true;
+  }
+  protect_class = (uint32_t)osPosixInfo.kernel.protect >> osPosixKernelProtectClass_Pos;
+  return (osPosixObjectClass(osPosixThreadSelf) >= protect_class);
+}
+
+/// Release kernel lock state (shared by osKernelUnlock and osKernelRestoreLock).
+static void KernelUnlock (void) {
+  osPosixInfo.kernel.state      = osPosixKernelRunning;
+  osPosixInfo.kernel.lock_owner = NULL;
+  if (osPosixInfo.kernel.mode == osPosixSchedConcurrent) {
+    // Release threads held at kernel entry
+    osPosixThreadSignalAll();
+  }
+}
+
+
+//  ==== Host Extensions ====
+
+/// Select the scheduler mode.
+osStatus_t osPosixKernelSetSchedMode (uint32_t mode) {
+  osStatus_t status;
+
+  if ((mode != osPosixSchedConcurrent) && (mode != osPosixSchedDeterministic)) {
+    return osErrorParameter;
+  }
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+  if ((osPosixInfo.kernel.state == osPosixKernelInactive) ||
+      ((osPosixInfo.kernel.state == osPosixKernelReady) && (osPosixInfo.thread.count == 0U))) {
+    osPosixInfo.kernel.mode = (uint8_t)mode;
+    status = osOK;
+  } else {
+    status = osError;
+  }
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  return status;
+}
+
+/// Get the active scheduler mode.
+uint32_t osPosixKernelGetSchedMode (void) {
+  return osPosixInfo.kernel.mode;
+}
+
+/// Enter simulated interrupt context.
+void osPosixIrqEnter (void) {
+  osPosixIrqNest++;
+  osPosixTrace(OS_TRACE_ISR_ENTER, pthread_self(), 0U);
+}
+
+/// Leave simulated interrupt context.
+void osPosixIrqExit (void) {
+  if (osPosixIrqNest == 0U) {
+    return;
+  }
+  osPosixTrace(OS_TRACE_ISR_EXIT, pthread_self(), 0U);
+  osPosixIrqNest--;
+  if (osPosixIrqNest == 0U) {
+    // Perform thread switches requested by the interrupt
+    osPosixKernelEnter();
+    osPosixKernelExit();
+  }
+}
+
+/// Kernel tick handler.
+void osPosixTick_Handler (void) {
+  os_thread_t *expired[8];
+  uint32_t     count = 0U;
+  uint32_t     ticks;
+  uint32_t     n;
+
+  osPosixIrqEnter();
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+
+  // One-shot event (sub-tick Delay) without tick: the tick period continues
+  if (OS_Tick_GetOneShot() == 0U) {
+    OS_Tick_AcknowledgeIRQ();
+
+    if ((osPosixInfo.kernel.state == osPosixKernelRunning) ||
+        (osPosixInfo.kernel.state == osPosixKernelLocked)) {
+      osPosixInfo.kernel.tick++;
+      osPosixThreadDelayTick(1U);
+      osPosixTimerTick(1U);
+      count = osPosixThreadWatchdogTick(expired, 8U);
+      osPosixThreadRobinTick();
+    }
+  }
+
+  if ((osPosixInfo.kernel.state == osPosixKernelRunning) ||
+      (osPosixInfo.kernel.state == osPosixKernelLocked)) {
+    osPosixThreadDelaySysTimer();
+  }
+
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  // Watchdog alarm handler runs outside the kernel lock (may call ISR-safe functions)
+  for (n = 0U; n < count; n++) {
+    ticks = osWatchdogAlarm_Handler(expired[n]);
+    (void)pthread_mutex_lock(&osPosixInfo.lock);
+    osPosixThreadWatchdogReload(expired[n], ticks);
+    (void)pthread_mutex_unlock(&osPosixInfo.lock);
+  }
+
+  osPosixIrqExit();
+}
+
+/// OS Error Callback (default implementation).
+__attribute__((weak)) uint32_t osPosixErrorNotify (uint32_t code, void *object_id) {
+  (void)code;
+  (void)object_id;
+  return 0U;
+}
+
+
+//  ==== Public API ====
+
+/// Initialize the RTOS Kernel.
+osStatus_t osKernelInitialize (void) {
+  osStatus_t status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+
+  if (osPosixInfo.kernel.state == osPosixKernelReady) {
+    status = osOK;
+  } else if (osPosixInfo.kernel.state != osPosixKernelInactive) {
+    status = osError;
+  } else {
+    osPosixInfo.kernel.pendsv     = 0U;
+    osPosixInfo.kernel.protect    = 0U;
+    osPosixInfo.kernel.tick       = 0U;
+    osPosixInfo.kernel.lock_owner = NULL;
+    (void)memset(&osPosixInfo.thread, 0, sizeof(osPosixInfo.thread));
+    (void)memset(&osPosixInfo.timer,  0, sizeof(osPosixInfo.timer));
+    osPosixTimerInit();
+    osPosixInfo.object_list = NULL;
+#if (OS_DYNAMIC_MEM_SIZE != 0)
+    // Use the region "RTOS" when the application provides it
+    osPosixMemRegion = OS_Mem_GetRegion("RTOS");
+    if (osPosixMemRegion == NULL) {
+      osPosixMemRegion = OS_Mem_AddRegion("RTOS", osPosixMemory, sizeof(osPosixMemory));
+    }
+#endif
+
+    osPosixInfo.kernel.state = osPosixKernelReady;
+    status = osOK;
+  }
+
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  return status;
+}
+
+///  Get RTOS Kernel Information.
+osStatus_t osKernelGetInfo (osVersion_t *version, char *id_buf, uint32_t id_size) {
+  uint32_t size;
+
+  if (version != NULL) {
+    version->api    = osPosixVersionAPI;
+    version->kernel = osPosixVersionKernel;
+  }
+
+  if ((id_buf != NULL) && (id_size != 0U)) {
+    size = (uint32_t)sizeof(osPosixKernelId);
+    if (id_size < size) {
+      size = id_size;
+    }
+    (void)memcpy(id_buf, osPosixKernelId, size);
+    id_buf[size - 1U] = '\0';
+  }
+
+  return osOK;
+}
+
+/// Get the current RTOS Kernel state.
+osKernelState_t osKernelGetState (void) {
+  return ((osKernelState_t)osPosixInfo.kernel.state);
+}
+
+/// Start the RTOS Kernel scheduler.
+osStatus_t osKernelStart (void) {
+  pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+  osStatus_t     status;
+
+  if (osPosixIsIrqMode() || (osPosixThreadSelf != NULL)) {
+    return osErrorISR;
+  }
+
+  if (osPosixInfo.kernel.state != osPosixKernelReady) {
+    return osError;
+  }
+
+  // Create Timer Thread and Timer Queue
+  status = osPosixTimerSetup();
+  if (status != osOK) {
+    return status;
+  }
+
+  // Setup and enable the OS Tick
+  if (OS_Tick_Setup(OS_TICK_FREQ, osPosixTick_Handler) != 0) {
+    return osError;
+  }
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+
+  osPosixInfo.kernel.state = osPosixKernelRunning;
+  OS_Tick_Enable();
+
+  // Start threads created before kernel start
+  if (osPosixInfo.kernel.mode == osPosixSchedConcurrent) {
+    osPosixThreadSignalAll();
+  }
+  osPosixThreadDispatch();
+
+  // The calling host thread (typically main) is not an RTOS thread: park it
+  for (;;) {
+    (void)pthread_cond_wait(&cond, &osPosixInfo.lock);
+  }
+
+  return osError;
+}
+
+/// Lock the RTOS Kernel scheduler.
+int32_t osKernelLock (void) {
+  int32_t lock;
+
+  if (osPosixIsIrqMode()) {
+    return (int32_t)osErrorISR;
+  }
+
+  osPosixKernelEnter();
+
+  if (!KernelProtectAllowed()) {
+    lock = (int32_t)osErrorSafetyClass;
+  } else {
+    switch (osPosixInfo.kernel.state) {
+      case osPosixKernelRunning:
+        osPosixInfo.kernel.state      = osPosixKernelLocked;
+        osPosixInfo.kernel.lock_owner = osPosixThreadSelf;
+        lock = 0;
+        break;
+      case osPosixKernelLocked:
+        lock = 1;
+        break;
+      default:
+        lock = (int32_t)osError;
+        break;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return lock;
+}
+
+/// Unlock the RTOS Kernel scheduler.
+int32_t osKernelUnlock (void) {
+  int32_t lock;
+
+  if (osPosixIsIrqMode()) {
+    return (int32_t)osErrorISR;
+  }
+
+  osPosixKernelEnter();
+
+  if (!KernelProtectAllowed()) {
+    lock = (int32_t)osErrorSafetyClass;
+  } else {
+    switch (osPosixInfo.kernel.state) {
+      case osPosixKernelRunning:
+        lock = 0;
+        break;
+      case osPosixKernelLocked:
+        KernelUnlock();
+        lock = 1;
+        break;
+      default:
+        lock = (int32_t)osError;
+        break;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return lock;
+}
+
+/// Restore the RTOS Kernel scheduler lock state.
+int32_t osKernelRestoreLock (int32_t lock) {
+  int32_t lock_new;
+
+  if (osPosixIsIrqMode()) {
+    return (int32_t)osErrorISR;
+  }
+
+  osPosixKernelEnter();
+
+  if (!KernelProtectAllowed()) {
+    lock_new = (int32_t)osErrorSafetyClass;
+  } else {
+    switch (osPosixInfo.kernel.state) {
+      case osPosixKernelRunning:
+      case osPosixKernelLocked:
+        switch (lock) {
+          case 0:
+            if (osPosixInfo.kernel.state == osPosixKernelLocked) {
+              KernelUnlock();
+            }
+            lock_new = 0;
+            break;
+          case 1:
+            if (osPosixInfo.kernel.state == osPosixKernelRunning) {
+              osPosixInfo.kernel.state      = osPosixKernelLocked;
+              osPosixInfo.kernel.lock_owner = osPosixThreadSelf;
+            }
+            lock_new = 1;
+            break;
+          default:
+            lock_new = (int32_t)osError;
+            break;
+        }
+        break;
+      default:
+        lock_new = (int32_t)osError;
+        break;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return lock_new;
+}
+
+/// Suspend the RTOS Kernel scheduler.
+uint32_t osKernelSuspend (void) {
+  uint32_t delay;
+
+  if (osPosixIsIrqMode()) {
+    return 0U;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixInfo.kernel.state != osPosixKernelRunning) || !KernelProtectAllowed()) {
+    osPosixKernelExit();
+    return 0U;
+  }
+
+  OS_Tick_Disable();
+
+  delay = osWaitForever;
+
+  // Check Thread Delay list
+  if (osPosixInfo.thread.delay_list != NULL) {
+    delay = osPosixInfo.thread.delay_list->delay;
+  }
+
+  // Check Active Timer list
+  if (osPosixTimerNextTick() < delay) {
+    delay = osPosixTimerNextTick();
+  }
+
+  // Check Sub-tick Delay list
+  if (osPosixThreadDelaySysTicks() < delay) {
+    delay = osPosixThreadDelaySysTicks();
+  }
+
+  osPosixInfo.kernel.state = osPosixKernelSuspended;
+
+  osPosixKernelExit();
+
+  return delay;
+}
+
+/// Resume the RTOS Kernel scheduler.
+void osKernelResume (uint32_t sleep_ticks) {
+
+  if (osPosixIsIrqMode()) {
+    return;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixInfo.kernel.state != osPosixKernelSuspended) || !KernelProtectAllowed()) {
+    osPosixKernelExit();
+    return;
+  }
+
+  osPosixInfo.kernel.tick += sleep_ticks;
+
+  // Process Thread Delay list and Timers for the time spent sleeping
+  osPosixThreadDelayTick(sleep_ticks);
+  osPosixTimerTick(sleep_ticks);
+
+  osPosixInfo.kernel.state = osPosixKernelRunning;
+
+  OS_Tick_Enable();
+
+  osPosixThreadDelaySysTimer();
+
+  osPosixKernelExit();
+}
+
+/// Protect the RTOS Kernel scheduler access.
+osStatus_t osKernelProtect (uint32_t safety_class) {
+  osStatus_t status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+
+  if (safety_class > 0x0FU) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!KernelProtectAllowed()) {
+    status = osErrorSafetyClass;
+  } else if ((osPosixInfo.kernel.state == osPosixKernelInactive) ||
+             (osPosixInfo.kernel.state == osPosixKernelSuspended)) {
+    status = osError;
+  } else {
+    osPosixInfo.kernel.protect &= (uint8_t)~(osPosixKernelProtectClass | (0x0FU << osPosixKernelProtectClass_Pos));
+    osPosixInfo.kernel.protect |= (uint8_t)(osPosixKernelProtectClass | (safety_class << osPosixKernelProtectClass_Pos));
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Destroy objects for specified safety classes.
+osStatus_t osKernelDestroyClass (uint32_t safety_class, uint32_t mode) {
+  os_object_t *object;
+  os_object_t *object_next;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+
+  if (safety_class > 0x0FU) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixThreadSelf != NULL) && (osPosixObjectClass(osPosixThreadSelf) < safety_class)) {
+    osPosixKernelExit();
+    return osErrorSafetyClass;
+  }
+
+  object = osPosixInfo.object_list;
+  while (object != NULL) {
+    object_next = object->object_next;
+    if (osPosixObjectClassMatch(object, safety_class, mode)) {
+      switch (object->id) {
+        case osPosixIdThread:
+          if (((os_thread_t *)object != osPosixThreadSelf) &&
+              ((os_thread_t *)object != osPosixInfo.timer.thread)) {
+            osPosixThreadTerminate((os_thread_t *)object);
+          }
+          break;
+        case osPosixIdTimer:
+          osPosixTimerDestroy((os_timer_t *)object);
+          break;
+        case osPosixIdEventFlags:
+          osPosixEventFlagsDestroy((os_event_flags_t *)object);
+          break;
+        case osPosixIdMutex:
+          osPosixMutexDestroy((os_mutex_t *)object);
+          break;
+        case osPosixIdRwLock:
+          osPosixRwLockDestroy((os_rwlock_t *)object);
+          break;
+        case osPosixIdSemaphore:
+          osPosixSemaphoreDestroy((os_semaphore_t *)object);
+          break;
+        case osPosixIdMemoryPool:
+          osPosixMemoryPoolDestroy((os_memory_pool_t *)object);
+          break;
+        case osPosixIdMessageQueue:
+          osPosixMessageQueueDestroy((os_message_queue_t *)object);
+          break;
+        case osPosixIdStreamBuffer:
+          osPosixStreamBufferDestroy((os_stream_buffer_t *)object);
+          break;
+        case osPosixIdWorkQueue:
+          osPosixWorkQueueDestroy((os_work_queue_t *)object);
+          break;
+        case osPosixIdWork:
+          osPosixWorkDestroy((os_work_t *)object);
+          break;
+        default:
+          break;
+      }
+    }
+    object = object_next;
+  }
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Get the RTOS kernel tick count.
+uint32_t osKernelGetTickCount (void) {
+  return osPosixInfo.kernel.tick;
+}
+
+/// Get the RTOS kernel tick frequency.
+uint32_t osKernelGetTickFreq (void) {
+  return OS_TICK_FREQ;
+}
+
+/// Get the RTOS kernel system timer count.
+uint32_t osKernelGetSysTimerCount (void) {
+  uint32_t count;
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+  count = osPosixKernelSysTimerCount();
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  return count;
+}
+
+/// Get the RTOS kernel system timer frequency.
+uint32_t osKernelGetSysTimerFreq (void) {
+  return OS_Tick_GetClock();
+}
+
+/// Get the accumulated idle time of the RTOS kernel (deterministic mode).
+uint64_t osKernelGetIdleRuntime (void) {
+  uint64_t runtime;
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+
+  if (osPosixInfo.thread.curr == NULL) {
+    osPosixThreadRuntimeUpdate();
+  }
+  runtime = osPosixInfo.thread.runtime_idle;
+
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  return runtime;
+}
+
+
+//  ==== Handler and Callback default implementations ====
+
+/// Handler for expired thread watchdogs (default: stop the watchdog).
+__attribute__((weak)) uint32_t osWatchdogAlarm_Handler (osThreadId_t thread_id) {
+  (void)thread_id;
+  return 0U;
+}
+
+/// Setup MPU protected zone (default: no MPU on host).
+__attribute__((weak)) void osZoneSetup_Callback (uint32_t zone) {
+  (void)zone;
+}
+
+/// Resume normal operation when exiting exception faults (no faults on host).
+void osFaultResume (void) {
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       POSIX Library definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef OS_POSIX_LIB_H_
+#define OS_POSIX_LIB_H_
+
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include "os_posix.h"
+#include "os_posix_config.h"
+#if (OS_DYNAMIC_MEM_SIZE != 0)
+#include "os_mem.h"
+#endif
+#if (OS_TRACE_ENABLE != 0)
+#include "os_trace.h"
+#endif
+
+
+//  ==== Kernel Information ====
+
+/// Kernel Information
+typedef struct {
+  pthread_mutex_t                lock;  ///< Kernel lock (protects all kernel data)
+  struct {                              ///< Kernel Info
+    uint8_t                     state;  ///< State
+    uint8_t                      mode;  ///< Scheduler Mode
+    uint8_t                    pendsv;  ///< Pending thread switch (deterministic mode)
+    uint8_t                   protect;  ///< Protect options
+    uint32_t                     tick;  ///< Tick counter
+    os_thread_t           *lock_owner;  ///< Thread that locked the kernel (concurrent mode)
+  } kernel;
+  struct {                              ///< Thread Info
+    os_thread_t                 *curr;  ///< Running Thread (deterministic mode)
+    os_thread_t                *ready;  ///< Ready List (sorted by priority)
+    os_thread_t           *delay_list;  ///< Delay List (sorted by delay)
+    os_thread_t       *delay_sys_list;  ///< Sub-tick Delay List (System Timer count)
+    os_thread_t            *wait_list;  ///< Threads waiting for multiple Objects
+    uint32_t                    count;  ///< Number of active Threads
+    uint32_t               wdog_count;  ///< Number of Threads with active watchdog
+    uint64_t             runtime_time;  ///< Runtime counter at last thread switch (deterministic mode)
+    uint64_t             runtime_idle;  ///< Idle execution time (deterministic mode)
+  } thread;
+  struct {                              ///< Timer Info
+    os_timer_link_t wheel[OS_TIMER_WHEEL_LEVELS][1U << OS_TIMER_WHEEL_BITS];  ///< Timer Wheel slots
+    os_timer_link_t           expired;  ///< Expired Timers (callbacks pending)
+    uint32_t                     time;  ///< Timer Wheel time (processed ticks)
+    uint32_t                    count;  ///< Number of running Timers
+    os_thread_t               *thread;  ///< Timer Thread
+    os_thread_t                 *wait;  ///< Timer Thread waiting for expired Timers
+  } timer;
+  os_object_t            *object_list;  ///< List of all kernel Objects
+} os_info_t;
+
+extern os_info_t osPosixInfo;
+
+/// Kernel Protect definitions
+#define osPosixKernelProtectPrivileged  0x01U
+#define osPosixKernelProtectClass       0x02U
+#define osPosixKernelProtectClass_Pos   4U
+
+/// Thread running the calling host thread (NULL for non-RTOS host threads)
+extern __thread os_thread_t *osPosixThreadSelf;
+
+/// Simulated interrupt nesting level of the calling host thread
+extern __thread uint32_t osPosixIrqNest;
+
+
+//  ==== Inline functions ====
+
+/// Record a kernel trace event (OS Trace API, arguments are objects or values).
+#if (OS_TRACE_ENABLE != 0)
+#define osPosixTrace(event, arg0, arg1) \
+  OS_Trace_Record((event), (uint32_t)(uintptr_t)(arg0), (uint32_t)(uintptr_t)(arg1))
+#else
+#define osPosixTrace(event, arg0, arg1)
+#endif
+
+/// Check if called from (simulated) interrupt context.
+static inline bool osPosixIsIrqMode (void) {
+  if (osPosixIrqNest != 0U) {
+    return true;
+  }
+  // Host threads that are not RTOS threads behave like interrupts once the kernel runs
+  return ((osPosixThreadSelf == NULL) &&
+          (osPosixInfo.kernel.state != osPosixKernelInactive) &&
+          (osPosixInfo.kernel.state != osPosixKernelReady));
+}
+
+/// Get safety class from object attributes.
+static inline uint32_t osPosixObjectClass (const void *object) {
+  return ((((const os_object_t *)object)->attr & osPosixAttrClass_Msk) >> osPosixAttrClass_Pos);
+}
+
+/// Check if the running thread has sufficient safety class to access an object.
+static inline bool osPosixClassAllowed (const void *object) {
+  const os_thread_t *thread = osPosixThreadSelf;
+
+  if ((thread == NULL) || (osPosixIrqNest != 0U)) {
+    return true;
+  }
+  return (osPosixObjectClass(thread) >= osPosixObjectClass(object));
+}
+
+/// Get safety class for a new object from its attributes or the creating thread.
+static inline uint8_t osPosixObjectAttrClass (uint32_t attr_bits) {
+  if ((attr_bits & osSafetyClass_Valid) != 0U) {
+    return ((uint8_t)(((attr_bits & osSafetyClass_Msk) >> osSafetyClass_Pos) << osPosixAttrClass_Pos));
+  }
+  if (osPosixThreadSelf != NULL) {
+    return ((uint8_t)(osPosixThreadSelf->attr & osPosixAttrClass_Msk));
+  }
+  return (0U);
+}
+
+
+//  ==== Library functions ====
+
+// Kernel Library functions
+extern void     osPosixKernelEnter       (void);
+extern void     osPosixKernelExit        (void);
+extern uint32_t osPosixKernelSysTimerCount (void);
+extern void     osPosixObjectAdd         (void *object);
+extern void     osPosixObjectRemove      (void *object);
+extern bool     osPosixObjectClassMatch  (const void *object, uint32_t safety_class, uint32_t mode);
+extern void    *osPosixMemAlloc          (size_t size);
+extern void     osPosixMemFree           (void *mem);
+
+// Thread Library functions
+extern void     osPosixThreadListPut     (os_thread_t **list, os_thread_t *thread);
+extern os_thread_t *osPosixThreadListGet (os_thread_t **list);
+extern void     osPosixThreadListUnlink  (os_thread_t *thread);
+extern void     osPosixThreadListSort    (os_thread_t *thread);
+extern void     osPosixThreadDelayTick   (uint32_t ticks);
+extern void     osPosixThreadDelaySysTimer (void);
+extern uint32_t osPosixThreadDelaySysTicks (void);
+extern void     osPosixThreadReadyPut    (os_thread_t *thread);
+extern void     osPosixThreadDispatch    (void);
+extern void     osPosixThreadSchedule    (void);
+extern void     osPosixThreadSignalAll   (void);
+extern bool     osPosixThreadWaitEnter   (uint8_t state, uint32_t timeout);
+extern uint32_t osPosixThreadWaitBlock   (uint32_t timeout_ret);
+extern void     osPosixThreadWaitExit    (os_thread_t *thread, uint32_t ret_val);
+extern void     osPosixThreadPriorityUpdate (os_thread_t *thread);
+extern void     osPosixThreadTerminate   (os_thread_t *thread);
+extern void     osPosixThreadRobinTick   (void);
+extern uint32_t osPosixThreadWatchdogTick   (os_thread_t **expired, uint32_t max);
+extern void     osPosixThreadWatchdogReload (os_thread_t *thread, uint32_t ticks);
+extern uint64_t osPosixThreadRuntimeCount   (void);
+extern void     osPosixThreadRuntimeUpdate  (void);
+
+// Timer Library functions
+extern void     osPosixTimerInit         (void);
+extern void     osPosixTimerTick         (uint32_t ticks);
+extern uint32_t osPosixTimerNextTick     (void);
+extern osStatus_t osPosixTimerSetup      (void);
+extern void     osPosixTimerDestroy      (os_timer_t *timer);
+extern void     osPosixTimerStartInternal (os_timer_t *timer, uint32_t ticks);
+extern void     osPosixTimerStopInternal (os_timer_t *timer);
+
+// Event Flags Library functions
+extern void     osPosixEventFlagsDestroy (os_event_flags_t *ef);
+
+// Mutex Library functions
+extern void     osPosixMutexOwnerRelease (os_mutex_t *mutex_list);
+extern void     osPosixMutexOwnerRestore (const os_mutex_t *mutex, const os_thread_t *thread_wakeup);
+extern void     osPosixMutexDestroy      (os_mutex_t *mutex);
+
+// Reader-Writer Lock Library functions
+extern void     osPosixRwLockOwnerRelease (os_rwlock_t *rwlock_list);
+extern void     osPosixRwLockWaitAbort   (os_rwlock_t *rwlock, const os_thread_t *thread);
+extern void     osPosixRwLockDestroy     (os_rwlock_t *rwlock);
+
+// Semaphore Library functions
+extern void     osPosixSemaphoreDestroy  (os_semaphore_t *semaphore);
+
+// Memory Pool Library functions
+extern uint32_t osPosixMemoryPoolInit    (os_mp_info_t *mp_info, uint32_t block_count, uint32_t block_size, void *block_mem);
+extern void    *osPosixMemoryPoolAllocBlock (os_mp_info_t *mp_info);
+extern osStatus_t osPosixMemoryPoolFreeBlock (os_mp_info_t *mp_info, void *block);
+extern void     osPosixMemoryPoolDestroy (os_memory_pool_t *mp);
+extern void     osPosixMemoryPoolCacheRelease (os_thread_t *thread);
+extern void     osPosixMemoryPoolWaitPrepare (os_memory_pool_t *mp, bool wait);
+
+// Multiple Object Wait Library functions
+extern void     osPosixWaitNotify        (const void *object);
+extern bool     osPosixWaitPending       (const void *object);
+extern void     osPosixWaitDestroy       (const void *object);
+
+// Message Queue Library functions
+extern osStatus_t osPosixMessageQueuePutInternal (os_message_queue_t *mq, const void *msg_ptr, uint8_t msg_prio);
+extern void     osPosixMessageQueueDestroy (os_message_queue_t *mq);
+
+// Stream Buffer Library functions
+extern void     osPosixStreamBufferDestroy (os_stream_buffer_t *sb);
+
+// Work Queue Library functions
+extern void     osPosixWorkQueueDestroy  (os_work_queue_t *wq);
+extern void     osPosixWorkDestroy       (os_work_t *work);
+
+#endif  // OS_POSIX_LIB_H_
@@ -0,0 +1,815 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Memory Pool functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  ==== Helper functions ====
+
+/// Validate memory pool ID.
+static inline bool IsMemoryPoolValid (const os_memory_pool_t *mp) {
+  return ((mp != NULL) && (mp->id == osPosixIdMemoryPool));
+}
+
+/// Mark a block as owned by the application (caching enabled).
+static void BlockSetUsed (os_memory_pool_t *mp, void *block) {
+  uint32_t index = (uint32_t)(((uint8_t *)block - (uint8_t *)mp->mp_info.block_base) / mp->mp_info.block_size);
+
+  (void)__atomic_fetch_or(&mp->block_used[index >> 5], 1UL << (index & 31U), __ATOMIC_RELAXED);
+}
+
+/// Mark a block as returned by the application (caching enabled).
+/// \return true when the block was owned by the application (false: block freed twice).
+static bool BlockClearUsed (os_memory_pool_t *mp, void *block) {
+  uint32_t index = (uint32_t)(((uint8_t *)block - (uint8_t *)mp->mp_info.block_base) / mp->mp_info.block_size);
+  uint32_t mask  = 1UL << (index & 31U);
+
+  return ((__atomic_fetch_and(&mp->block_used[index >> 5], ~mask, __ATOMIC_RELAXED) & mask) != 0U);
+}
+
+/// Allocate a block from the shared pool (kernel lock held).
+static void *SharedAlloc (os_memory_pool_t *mp) {
+  void *block;
+
+  block = osPosixMemoryPoolAllocBlock(&mp->mp_info);
+  if ((block != NULL) && (mp->mp_info.used_blocks > mp->max_used)) {
+    mp->max_used = mp->mp_info.used_blocks;
+  }
+  return block;
+}
+
+/// Return a block to the shared pool or pass it to a waiting Thread (kernel lock held).
+/// \return true when the block was put into the shared pool.
+static bool SharedFree (os_memory_pool_t *mp, void *block) {
+  os_thread_t *thread;
+
+  thread = osPosixThreadListGet(&mp->thread_list);
+  if (thread != NULL) {
+    // Pass the block to the waiting Thread with highest Priority
+    thread->wait_info = block;
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    return false;
+  }
+  (void)osPosixMemoryPoolFreeBlock(&mp->mp_info, block);
+  return true;
+}
+
+/// Flush blocks from a Cache to the shared pool (kernel and cache lock held).
+static void CacheFlush (os_memory_pool_t *mp, os_mp_cache_t *cache, uint32_t count) {
+  bool notify = false;
+
+  while ((count != 0U) && (cache->count != 0U)) {
+    cache->count--;
+    if (SharedFree(mp, cache->block[cache->count])) {
+      notify = true;
+    }
+    count--;
+  }
+  if (notify) {
+    osPosixWaitNotify(mp);
+  }
+}
+
+/// Move all cached blocks back to the shared pool (kernel lock held).
+static void CacheReclaim (os_memory_pool_t *mp) {
+  os_mp_cache_t *cache;
+
+  for (cache = mp->thread_cache; cache != NULL; cache = cache->pool_next) {
+    (void)pthread_mutex_lock(&cache->lock);
+    CacheFlush(mp, cache, cache->count);
+    (void)pthread_mutex_unlock(&cache->lock);
+  }
+  for (cache = mp->cpu_cache; cache != NULL; cache = cache->pool_next) {
+    (void)pthread_mutex_lock(&cache->lock);
+    CacheFlush(mp, cache, cache->count);
+    (void)pthread_mutex_unlock(&cache->lock);
+  }
+}
+
+/// Add the counters of a Cache to statistics (kernel lock held).
+static void CacheStats (os_mp_cache_t *cache, osMemoryPoolStats_t *stats) {
+
+  for (; cache != NULL; cache = cache->pool_next) {
+    (void)pthread_mutex_lock(&cache->lock);
+    stats->alloc_count += cache->alloc_count;
+    stats->alloc_hits  += cache->alloc_hits;
+    stats->free_count  += cache->free_count;
+    stats->free_hits   += cache->free_hits;
+    stats->cached      += cache->count;
+    (void)pthread_mutex_unlock(&cache->lock);
+  }
+}
+
+/// Get number of cached blocks (kernel lock held).
+static uint32_t CacheCount (const os_memory_pool_t *mp) {
+  osMemoryPoolStats_t stats = { 0U };
+
+  CacheStats(mp->thread_cache, &stats);
+  CacheStats(mp->cpu_cache, &stats);
+  return stats.cached;
+}
+
+/// Delete a Cache (kernel lock held).
+static void CacheDelete (os_mp_cache_t *cache) {
+  (void)pthread_mutex_destroy(&cache->lock);
+  osPosixMemFree(cache);
+}
+
+/// Get the Cache of the calling Thread for a Memory Pool (created on first use).
+/// Threads with a single processor in the affinity mask share a per-processor Cache.
+/// \return cache or NULL when the calling context does not use caching.
+static os_mp_cache_t *CacheGet (os_memory_pool_t *mp) {
+  os_thread_t    *thread = osPosixThreadSelf;
+  os_mp_cache_t  *cache;
+  os_mp_cache_t **link;
+  uint32_t        mask;
+  uint32_t        cpu = 0U;
+
+  if ((mp->cache_depth == 0U) || (thread == NULL) || (osPosixIrqNest != 0U)) {
+    return NULL;
+  }
+
+  mask = thread->affinity_mask;
+  if ((mask != 0U) && ((mask & (mask - 1U)) == 0U)) {
+    cpu = (uint32_t)__builtin_ctz(mask);
+    for (cache = __atomic_load_n(&mp->cpu_cache, __ATOMIC_ACQUIRE); cache != NULL; cache = cache->pool_next) {
+      if (cache->cpu == cpu) {
+        return cache;
+      }
+    }
+  } else {
+    mask = 0U;
+    for (cache = thread->mp_cache; cache != NULL; cache = cache->thread_next) {
+      if (__atomic_load_n(&cache->mp, __ATOMIC_RELAXED) == mp) {
+        return cache;
+      }
+    }
+  }
+
+  osPosixKernelEnter();
+
+  if (mp->id != osPosixIdMemoryPool) {
+    osPosixKernelExit();
+    return NULL;
+  }
+
+  if (mask == 0U) {
+    // Release Caches of deleted Memory Pools
+    link = &thread->mp_cache;
+    while ((cache = *link) != NULL) {
+      if (cache->mp == NULL) {
+        *link = cache->thread_next;
+        CacheDelete(cache);
+      } else {
+        link = &cache->thread_next;
+      }
+    }
+  } else {
+    // Another Thread on the same processor may have created the Cache meanwhile
+    for (cache = mp->cpu_cache; cache != NULL; cache = cache->pool_next) {
+      if (cache->cpu == cpu) {
+        osPosixKernelExit();
+        return cache;
+      }
+    }
+  }
+
+  cache = (os_mp_cache_t *)osPosixMemAlloc(sizeof(os_mp_cache_t) + (mp->cache_depth * sizeof(void *)));
+  if (cache != NULL) {
+    (void)pthread_mutex_init(&cache->lock, NULL);
+    cache->mp  = mp;
+    cache->cpu = cpu;
+    if (mask == 0U) {
+      cache->thread      = thread;
+      cache->pool_next   = mp->thread_cache;
+      mp->thread_cache   = cache;
+      cache->thread_next = thread->mp_cache;
+      thread->mp_cache   = cache;
+    } else {
+      cache->pool_next = mp->cpu_cache;
+      __atomic_store_n(&mp->cpu_cache, cache, __ATOMIC_RELEASE);
+    }
+  }
+
+  osPosixKernelExit();
+
+  return cache;
+}
+
+/// Allocate a block from a Cache, refill the Cache from the shared pool when empty.
+/// \return address of the allocated memory block or NULL when the shared pool is empty.
+static void *CacheAllocBlock (os_memory_pool_t *mp, os_mp_cache_t *cache) {
+  void    *block = NULL;
+  uint32_t count;
+
+  (void)pthread_mutex_lock(&cache->lock);
+  if (cache->count != 0U) {
+    cache->count--;
+    block = cache->block[cache->count];
+    cache->alloc_count++;
+    cache->alloc_hits++;
+    (void)pthread_mutex_unlock(&cache->lock);
+    return block;
+  }
+  (void)pthread_mutex_unlock(&cache->lock);
+
+  // Refill half of the Cache from the shared pool (lock order: kernel, cache)
+  osPosixKernelEnter();
+  (void)pthread_mutex_lock(&cache->lock);
+  if (cache->mp == mp) {
+    count = (mp->cache_depth + 1U) / 2U;
+    while ((cache->count < count) && ((block = SharedAlloc(mp)) != NULL)) {
+      cache->block[cache->count] = block;
+      cache->count++;
+    }
+    block = NULL;
+    if (cache->count != 0U) {
+      cache->count--;
+      block = cache->block[cache->count];
+      cache->alloc_count++;
+    }
+  }
+  (void)pthread_mutex_unlock(&cache->lock);
+  osPosixKernelExit();
+
+  return block;
+}
+
+/// Return a block to a Cache, flush half of the Cache to the shared pool when full.
+/// \return true when the block was put into the Cache.
+static bool CacheFreeBlock (os_memory_pool_t *mp, os_mp_cache_t *cache, void *block) {
+
+  (void)pthread_mutex_lock(&cache->lock);
+  if (__atomic_load_n(&mp->cache_wait, __ATOMIC_RELAXED) != 0U) {
+    // Threads are waiting for a block: use the shared pool
+    (void)pthread_mutex_unlock(&cache->lock);
+    return false;
+  }
+  if (cache->count < mp->cache_depth) {
+    cache->block[cache->count] = block;
+    cache->count++;
+    cache->free_count++;
+    cache->free_hits++;
+    (void)pthread_mutex_unlock(&cache->lock);
+    return true;
+  }
+  (void)pthread_mutex_unlock(&cache->lock);
+
+  osPosixKernelEnter();
+  (void)pthread_mutex_lock(&cache->lock);
+  if (cache->mp == mp) {
+    CacheFlush(mp, cache, (mp->cache_depth + 1U) / 2U);
+    cache->block[cache->count] = block;
+    cache->count++;
+    cache->free_count++;
+  }
+  (void)pthread_mutex_unlock(&cache->lock);
+  osPosixKernelExit();
+
+  return true;
+}
+
+/// Destroy a Memory Pool object (kernel lock held).
+static void MemoryPoolDestroy (os_memory_pool_t *mp) {
+  os_thread_t   *thread;
+  os_mp_cache_t *cache;
+
+  // Unblock waiting threads (allocation returns NULL)
+  while ((thread = osPosixThreadListGet(&mp->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+  }
+  osPosixWaitDestroy(mp);
+
+  // Detach per-thread Caches (released by their owner) and free per-processor Caches
+  while ((cache = mp->thread_cache) != NULL) {
+    mp->thread_cache = cache->pool_next;
+    (void)pthread_mutex_lock(&cache->lock);
+    cache->count = 0U;
+    __atomic_store_n(&cache->mp, NULL, __ATOMIC_RELAXED);
+    (void)pthread_mutex_unlock(&cache->lock);
+  }
+  while ((cache = mp->cpu_cache) != NULL) {
+    mp->cpu_cache = cache->pool_next;
+    CacheDelete(cache);
+  }
+
+  mp->id = osPosixIdInvalid;
+  osPosixObjectRemove(mp);
+
+  if (mp->block_used != NULL) {
+    osPosixMemFree(mp->block_used);
+  }
+  if ((mp->flags & osPosixFlagSystemMemory) != 0U) {
+    osPosixMemFree(mp->mp_info.block_base);
+  }
+  if ((mp->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(mp);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Initialize Memory Pool.
+/// \param[in]  mp_info         memory pool info.
+/// \param[in]  block_count     maximum number of memory blocks in memory pool.
+/// \param[in]  block_size      size of a memory block in bytes.
+/// \param[in]  block_mem       pointer to memory for block storage.
+/// \return 1 - success, 0 - failure.
+uint32_t osPosixMemoryPoolInit (os_mp_info_t *mp_info, uint32_t block_count, uint32_t block_size, void *block_mem) {
+  uint8_t *mem;
+  uint8_t *block;
+  uint32_t n;
+
+  if ((mp_info == NULL) || (block_count == 0U) || (block_size == 0U) || (block_mem == NULL)) {
+    return 0U;
+  }
+
+  // Initialize information structure
+  mp_info->max_blocks  = block_count;
+  mp_info->used_blocks = 0U;
+  mp_info->block_size  = block_size;
+  mp_info->block_base  = block_mem;
+  mp_info->block_free  = block_mem;
+  mp_info->block_lim   = &((uint8_t *)block_mem)[(size_t)block_count * block_size];
+
+  // Link all free blocks
+  mem = (uint8_t *)block_mem;
+  for (n = 1U; n < block_count; n++) {
+    block = mem + block_size;
+    *((void **)mem) = block;
+    mem = block;
+  }
+  *((void **)mem) = NULL;
+
+  return 1U;
+}
+
+/// Allocate a memory block from a Memory Pool.
+/// \param[in]  mp_info         memory pool info.
+/// \return address of the allocated memory block or NULL in case of no memory is available.
+void *osPosixMemoryPoolAllocBlock (os_mp_info_t *mp_info) {
+  void *block;
+
+  if (mp_info == NULL) {
+    return NULL;
+  }
+
+  block = mp_info->block_free;
+  if (block != NULL) {
+    mp_info->block_free = *((void **)block);
+    mp_info->used_blocks++;
+  }
+
+  return block;
+}
+
+/// Return an allocated memory block back to a Memory Pool.
+/// \param[in]  mp_info         memory pool info.
+/// \param[in]  block           address of the allocated memory block to be returned to the memory pool.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osPosixMemoryPoolFreeBlock (os_mp_info_t *mp_info, void *block) {
+
+  if ((mp_info == NULL) || (block < mp_info->block_base) || (block >= mp_info->block_lim) ||
+      ((((uint8_t *)block - (uint8_t *)mp_info->block_base) % mp_info->block_size) != 0)) {
+    return osErrorParameter;
+  }
+  if (mp_info->used_blocks == 0U) {
+    return osErrorResource;
+  }
+
+  *((void **)block) = mp_info->block_free;
+  mp_info->block_free = block;
+  mp_info->used_blocks--;
+
+  return osOK;
+}
+
+/// Release the Memory Pool Caches of a terminating Thread (kernel lock held).
+/// \param[in]  thread          thread object.
+void osPosixMemoryPoolCacheRelease (os_thread_t *thread) {
+  os_memory_pool_t *mp;
+  os_mp_cache_t    *cache;
+  os_mp_cache_t   **link;
+
+  while ((cache = thread->mp_cache) != NULL) {
+    thread->mp_cache = cache->thread_next;
+    mp = cache->mp;
+    if (mp != NULL) {
+      // Return cached blocks and keep the statistics
+      CacheFlush(mp, cache, cache->count);
+      mp->alloc_count += cache->alloc_count;
+      mp->alloc_hits  += cache->alloc_hits;
+      mp->free_count  += cache->free_count;
+      mp->free_hits   += cache->free_hits;
+      for (link = &mp->thread_cache; *link != NULL; link = &(*link)->pool_next) {
+        if (*link == cache) {
+          *link = cache->pool_next;
+          break;
+        }
+      }
+    }
+    CacheDelete(cache);
+  }
+}
+
+/// Prepare a Memory Pool for a multiple object wait (kernel lock held).
+/// \param[in]  mp              memory pool object.
+/// \param[in]  wait            Thread may wait: freed blocks bypass the Caches.
+void osPosixMemoryPoolWaitPrepare (os_memory_pool_t *mp, bool wait) {
+
+  if ((mp->cache_depth == 0U) || (mp->mp_info.block_free != NULL)) {
+    return;
+  }
+  if (wait) {
+    mp->cache_wait = 1U;
+  }
+  CacheReclaim(mp);
+}
+
+/// Destroy a Memory Pool object (osKernelDestroyClass).
+/// \param[in]  mp              memory pool object.
+void osPosixMemoryPoolDestroy (os_memory_pool_t *mp) {
+  MemoryPoolDestroy(mp);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Memory Pool object.
+osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr) {
+  os_memory_pool_t *mp;
+  const char       *name;
+  void             *cb_mem;
+  uint32_t          cb_size;
+  void             *mp_mem;
+  uint32_t          mp_size;
+  uint32_t          attr_bits;
+  uint32_t          cache_depth;
+  uint32_t         *block_used;
+  uint8_t           flags = 0U;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+  if ((block_count == 0U) || (block_size == 0U) ||
+      ((__UINT32_MAX__ - sizeof(void *) + 1U) < block_size)) {
+    return NULL;
+  }
+  block_size = (block_size + 7U) & ~7UL;
+  if ((__UINT32_MAX__ / block_count) < block_size) {
+    return NULL;
+  }
+  mp_size = block_count * block_size;
+
+  if (attr != NULL) {
+    name        = attr->name;
+    attr_bits   = attr->attr_bits;
+    cb_mem      = attr->cb_mem;
+    cb_size     = attr->cb_size;
+    mp_mem      = attr->mp_mem;
+    cache_depth = attr->cache_depth;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_memory_pool_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+    if (mp_mem != NULL) {
+      if ((((uintptr_t)mp_mem & 7U) != 0U) || (attr->mp_size < mp_size)) {
+        return NULL;
+      }
+    } else if (attr->mp_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name        = NULL;
+    attr_bits   = 0U;
+    cb_mem      = NULL;
+    mp_mem      = NULL;
+    cache_depth = 0U;
+  }
+  if (cache_depth > block_count) {
+    cache_depth = block_count;
+  }
+
+  osPosixKernelEnter();
+
+  // Bitmap of Blocks owned by the application (detects blocks freed twice into a Cache)
+  block_used = NULL;
+  if (cache_depth != 0U) {
+    block_used = (uint32_t *)osPosixMemAlloc(((block_count + 31U) / 32U) * sizeof(uint32_t));
+    if (block_used == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    (void)memset(block_used, 0, ((block_count + 31U) / 32U) * sizeof(uint32_t));
+  }
+
+  if (mp_mem == NULL) {
+    mp_mem = osPosixMemAlloc(mp_size);
+    if (mp_mem == NULL) {
+      if (block_used != NULL) {
+        osPosixMemFree(block_used);
+      }
+      osPosixKernelExit();
+      return NULL;
+    }
+    flags |= osPosixFlagSystemMemory;
+  }
+
+  if (cb_mem != NULL) {
+    mp = (os_memory_pool_t *)cb_mem;
+    (void)memset(mp, 0, sizeof(os_memory_pool_t));
+  } else {
+    mp = (os_memory_pool_t *)osPosixMemAlloc(sizeof(os_memory_pool_t));
+    if (mp == NULL) {
+      if ((flags & osPosixFlagSystemMemory) != 0U) {
+        osPosixMemFree(mp_mem);
+      }
+      if (block_used != NULL) {
+        osPosixMemFree(block_used);
+      }
+      osPosixKernelExit();
+      return NULL;
+    }
+    flags |= osPosixFlagSystemObject;
+  }
+
+  mp->id    = osPosixIdMemoryPool;
+  mp->flags = flags;
+  mp->attr  = osPosixObjectAttrClass(attr_bits);
+  mp->name  = name;
+  mp->cache_depth = cache_depth;
+  mp->block_used  = block_used;
+  (void)osPosixMemoryPoolInit(&mp->mp_info, block_count, block_size, mp_mem);
+  osPosixObjectAdd(mp);
+
+  osPosixKernelExit();
+
+  return mp;
+}
+
+/// Get name of a Memory Pool object.
+const char *osMemoryPoolGetName (osMemoryPoolId_t mp_id) {
+  const os_memory_pool_t *mp = (const os_memory_pool_t *)mp_id;
+
+  if (osPosixIsIrqMode() || !IsMemoryPoolValid(mp)) {
+    return NULL;
+  }
+  return mp->name;
+}
+
+/// Allocate a memory block from a Memory Pool.
+void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+  os_thread_t      *thread;
+  os_mp_cache_t    *cache;
+  void             *block;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return NULL;
+  }
+  if (!IsMemoryPoolValid(mp)) {
+    return NULL;
+  }
+  if (!osPosixClassAllowed(mp)) {
+    return NULL;
+  }
+
+  cache = CacheGet(mp);
+  if (cache != NULL) {
+    block = CacheAllocBlock(mp, cache);
+    if (block != NULL) {
+      BlockSetUsed(mp, block);
+      return block;
+    }
+  }
+
+  osPosixKernelEnter();
+
+  block = SharedAlloc(mp);
+  if ((block == NULL) && (mp->cache_depth != 0U)) {
+    // Blocks bypass the Caches while Threads wait, then collect all cached blocks
+    if (timeout != 0U) {
+      mp->cache_wait = 1U;
+    }
+    CacheReclaim(mp);
+    block = SharedAlloc(mp);
+  }
+  if ((block == NULL) && (timeout != 0U)) {
+    // Suspend current Thread
+    if (osPosixThreadWaitEnter(osPosixThreadWaitingMemoryPool, timeout)) {
+      thread = osPosixThreadSelf;
+      thread->wait_info = NULL;
+      osPosixThreadListPut(&mp->thread_list, thread);
+      if (osPosixThreadWaitBlock((uint32_t)osErrorTimeout) == (uint32_t)osOK) {
+        // Block was passed by osMemoryPoolFree
+        block = thread->wait_info;
+      }
+    }
+  }
+  if (block != NULL) {
+    mp->alloc_count++;
+    if (mp->block_used != NULL) {
+      BlockSetUsed(mp, block);
+    }
+  }
+
+  osPosixKernelExit();
+
+  return block;
+}
+
+/// Return an allocated memory block back to a Memory Pool.
+osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+  os_thread_t      *thread;
+  os_mp_cache_t    *cache;
+  osStatus_t        status;
+
+  if (!IsMemoryPoolValid(mp) || (block == NULL)) {
+    return osErrorParameter;
+  }
+
+  if (mp->cache_depth != 0U) {
+    if (!osPosixClassAllowed(mp)) {
+      return osErrorSafetyClass;
+    }
+    if ((block < mp->mp_info.block_base) || (block >= mp->mp_info.block_lim) ||
+        ((((uint8_t *)block - (uint8_t *)mp->mp_info.block_base) % mp->mp_info.block_size) != 0)) {
+      return osErrorParameter;
+    }
+    if (!BlockClearUsed(mp, block)) {
+      return osErrorResource;           // Block is not allocated (freed twice)
+    }
+    cache = CacheGet(mp);
+    if ((cache != NULL) && CacheFreeBlock(mp, cache, block)) {
+      return osOK;
+    }
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mp)) {
+    status = osErrorSafetyClass;
+  } else {
+    status = osPosixMemoryPoolFreeBlock(&mp->mp_info, block);
+    if ((status == osOK) && (mp->thread_list != NULL)) {
+      // Pass the block to the waiting Thread with highest Priority
+      block  = osPosixMemoryPoolAllocBlock(&mp->mp_info);
+      thread = osPosixThreadListGet(&mp->thread_list);
+      thread->wait_info = block;
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    } else if (status == osOK) {
+      osPosixWaitNotify(mp);
+    }
+    if (status == osOK) {
+      mp->free_count++;
+    }
+    if ((mp->thread_list == NULL) && !osPosixWaitPending(mp)) {
+      mp->cache_wait = 0U;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get maximum number of memory blocks in a Memory Pool.
+uint32_t osMemoryPoolGetCapacity (osMemoryPoolId_t mp_id) {
+  const os_memory_pool_t *mp = (const os_memory_pool_t *)mp_id;
+
+  if (!IsMemoryPoolValid(mp)) {
+    return 0U;
+  }
+  return mp->mp_info.max_blocks;
+}
+
+/// Get memory block size in a Memory Pool.
+uint32_t osMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id) {
+  const os_memory_pool_t *mp = (const os_memory_pool_t *)mp_id;
+
+  if (!IsMemoryPoolValid(mp)) {
+    return 0U;
+  }
+  return mp->mp_info.block_size;
+}
+
+/// Get number of memory blocks used in a Memory Pool (cached blocks are not counted).
+uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id) {
+  const os_memory_pool_t *mp = (const os_memory_pool_t *)mp_id;
+  uint32_t                count;
+  uint32_t                cached;
+
+  if (!IsMemoryPoolValid(mp)) {
+    return 0U;
+  }
+  if (mp->cache_depth == 0U) {
+    return mp->mp_info.used_blocks;
+  }
+
+  osPosixKernelEnter();
+  count  = mp->mp_info.used_blocks;
+  cached = CacheCount(mp);
+  count  = (count > cached) ? (count - cached) : 0U;
+  osPosixKernelExit();
+
+  return count;
+}
+
+/// Get number of memory blocks available in a Memory Pool (cached blocks are counted).
+uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id) {
+  const os_memory_pool_t *mp = (const os_memory_pool_t *)mp_id;
+  uint32_t                space;
+
+  if (!IsMemoryPoolValid(mp)) {
+    return 0U;
+  }
+  if (mp->cache_depth == 0U) {
+    return (mp->mp_info.max_blocks - mp->mp_info.used_blocks);
+  }
+
+  osPosixKernelEnter();
+  space = mp->mp_info.max_blocks - mp->mp_info.used_blocks + CacheCount(mp);
+  if (space > mp->mp_info.max_blocks) {
+    space = mp->mp_info.max_blocks;
+  }
+  osPosixKernelExit();
+
+  return space;
+}
+
+/// Get statistics of a Memory Pool.
+osStatus_t osMemoryPoolGetStats (osMemoryPoolId_t mp_id, osMemoryPoolStats_t *stats) {
+  const os_memory_pool_t *mp = (const os_memory_pool_t *)mp_id;
+
+  if (!IsMemoryPoolValid(mp) || (stats == NULL)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  stats->alloc_count = mp->alloc_count;
+  stats->alloc_hits  = mp->alloc_hits;
+  stats->free_count  = mp->free_count;
+  stats->free_hits   = mp->free_hits;
+  stats->cached      = 0U;
+  stats->max_used    = mp->max_used;
+  CacheStats(mp->thread_cache, stats);
+  CacheStats(mp->cpu_cache, stats);
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Delete a Memory Pool object.
+osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
+  os_memory_pool_t *mp = (os_memory_pool_t *)mp_id;
+  osStatus_t        status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsMemoryPoolValid(mp)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mp)) {
+    status = osErrorSafetyClass;
+  } else {
+    MemoryPoolDestroy(mp);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
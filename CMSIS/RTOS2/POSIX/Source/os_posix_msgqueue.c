@@ -0,0 +1,806 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Message Queue functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  Wait mode of message queue threads (wait_option)
+#define MQ_WAIT_COPY        0x00U       ///< Message is copied from/to a thread buffer
+#define MQ_WAIT_ZERO_COPY   0x01U       ///< Thread receives a message slot
+
+
+//  ==== Helper functions ====
+
+/// Validate message queue ID.
+static inline bool IsMessageQueueValid (const os_message_queue_t *mq) {
+  return ((mq != NULL) && (mq->id == osPosixIdMessageQueue));
+}
+
+/// Put a Message into Queue sorted by Priority (Highest at Head).
+static void MessageQueuePut (os_message_queue_t *mq, os_message_t *msg) {
+  os_message_t *prev;
+  os_message_t *next;
+
+  if (mq->msg_last != NULL) {
+    prev = mq->msg_last;
+    next = NULL;
+    while ((prev != NULL) && (prev->priority < msg->priority)) {
+      next = prev;
+      prev = prev->prev;
+    }
+    msg->prev = prev;
+    msg->next = next;
+    if (prev != NULL) {
+      prev->next = msg;
+    } else {
+      mq->msg_first = msg;
+    }
+    if (next != NULL) {
+      next->prev = msg;
+    } else {
+      mq->msg_last = msg;
+    }
+  } else {
+    msg->prev     = NULL;
+    msg->next     = NULL;
+    mq->msg_first = msg;
+    mq->msg_last  = msg;
+  }
+
+  mq->msg_count++;
+
+  osPosixWaitNotify(mq);
+}
+
+/// Get a Message from Queue with Highest Priority.
+static os_message_t *MessageQueueGet (os_message_queue_t *mq) {
+  os_message_t *msg;
+
+  msg = mq->msg_first;
+  if (msg != NULL) {
+    mq->msg_first = msg->next;
+    if (msg->next != NULL) {
+      msg->next->prev = NULL;
+    } else {
+      mq->msg_last = NULL;
+    }
+    mq->msg_count--;
+  }
+
+  return msg;
+}
+
+/// Get the highest priority Thread waiting in the specified state.
+static os_thread_t *MessageQueueWaiter (const os_message_queue_t *mq, uint8_t state) {
+  os_thread_t *thread;
+
+  // Senders and receivers wait at the same time only when all slots are lent out
+  for (thread = mq->thread_list; thread != NULL; thread = thread->thread_next) {
+    if (thread->state == state) {
+      break;
+    }
+  }
+  return thread;
+}
+
+/// Publish a filled Message slot: pass it to a waiting receiver or put it into the Queue.
+/// \return true - slot was released (message copied to a receiver), false - slot is in use.
+static bool MessageQueueSubmit (os_message_queue_t *mq, os_message_t *msg) {
+  os_thread_t *thread;
+
+  thread = MessageQueueWaiter(mq, osPosixThreadWaitingMessageGet);
+  if (thread == NULL) {
+    msg->state = osPosixMessageQueued;
+    MessageQueuePut(mq, msg);
+    return false;
+  }
+
+  osPosixThreadListUnlink(thread);
+  if (thread->wait_extra != NULL) {
+    *((uint8_t *)thread->wait_extra) = msg->priority;
+  }
+  if (thread->wait_option == MQ_WAIT_ZERO_COPY) {
+    msg->state = osPosixMessageBorrowed;
+    thread->wait_info = &msg[1];
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    return false;
+  }
+  (void)memcpy(thread->wait_info, &msg[1], mq->msg_size);
+  osPosixThreadWaitExit(thread, (uint32_t)osOK);
+  msg->state = osPosixMessageQueued;
+  (void)osPosixMemoryPoolFreeBlock(&mq->mp_info, msg);
+  return true;
+}
+
+/// Pass free Message slots to Threads waiting to send.
+static void MessageQueueAcceptPut (os_message_queue_t *mq) {
+  os_message_t *msg;
+  os_thread_t  *thread;
+
+  while ((thread = MessageQueueWaiter(mq, osPosixThreadWaitingMessagePut)) != NULL) {
+    msg = (os_message_t *)osPosixMemoryPoolAllocBlock(&mq->mp_info);
+    if (msg == NULL) {
+      break;
+    }
+    osPosixThreadListUnlink(thread);
+    if (thread->wait_option == MQ_WAIT_ZERO_COPY) {
+      // Pass the slot to osMessageQueueAcquire
+      msg->state = osPosixMessageAcquired;
+      thread->wait_info = &msg[1];
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    } else {
+      (void)memcpy(&msg[1], thread->wait_info, mq->msg_size);
+      msg->priority = (uint8_t)thread->wait_flags;
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+      (void)MessageQueueSubmit(mq, msg);
+    }
+  }
+}
+
+/// Get a Message from Queue into a buffer and accept a waiting sender.
+static bool MessageQueueRead (os_message_queue_t *mq, void *msg_ptr, uint8_t *msg_prio) {
+  os_message_t *msg;
+
+  msg = MessageQueueGet(mq);
+  if (msg == NULL) {
+    return false;
+  }
+  (void)memcpy(msg_ptr, &msg[1], mq->msg_size);
+  if (msg_prio != NULL) {
+    *msg_prio = msg->priority;
+  }
+  (void)osPosixMemoryPoolFreeBlock(&mq->mp_info, msg);
+
+  // Check if Thread is waiting to send a Message
+  MessageQueueAcceptPut(mq);
+
+  return true;
+}
+
+/// Get Message control block from a message data pointer (NULL if invalid).
+static os_message_t *MessageQueueSlot (const os_message_queue_t *mq, void *msg_ptr) {
+  uint8_t *block;
+
+  if (msg_ptr == NULL) {
+    return NULL;
+  }
+  block = (uint8_t *)msg_ptr - sizeof(os_message_t);
+  if ((block < (uint8_t *)mq->mp_info.block_base) || (block >= (uint8_t *)mq->mp_info.block_lim) ||
+      (((size_t)(block - (uint8_t *)mq->mp_info.block_base) % mq->mp_info.block_size) != 0U)) {
+    return NULL;
+  }
+  return ((os_message_t *)block);
+}
+
+/// Get remaining timeout of a wait started at tick_start.
+static uint32_t MessageQueueTimeout (uint32_t timeout, uint32_t tick_start) {
+  uint32_t elapsed;
+
+  if (timeout == osWaitForever) {
+    return osWaitForever;
+  }
+  elapsed = osPosixInfo.kernel.tick - tick_start;
+  if (elapsed >= timeout) {
+    return 0U;
+  }
+  return (timeout - elapsed);
+}
+
+/// Destroy a Message Queue object (kernel lock held).
+static void MessageQueueDestroy (os_message_queue_t *mq) {
+  os_thread_t *thread;
+
+  // Unblock waiting threads
+  while ((thread = osPosixThreadListGet(&mq->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+  }
+  osPosixWaitDestroy(mq);
+
+  mq->id = osPosixIdInvalid;
+  osPosixObjectRemove(mq);
+
+  if ((mq->flags & osPosixFlagSystemMemory) != 0U) {
+    osPosixMemFree(mq->mp_info.block_base);
+  }
+  if ((mq->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(mq);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Put a Message into a Queue without waiting (kernel lock held).
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to buffer with message to put into a queue.
+/// \param[in]  msg_prio        message priority.
+/// \return status code that indicates the execution status of the function.
+osStatus_t osPosixMessageQueuePutInternal (os_message_queue_t *mq, const void *msg_ptr, uint8_t msg_prio) {
+  os_message_t *msg;
+  os_thread_t  *thread;
+
+  // Check if Thread is waiting to receive a Message into its buffer
+  thread = MessageQueueWaiter(mq, osPosixThreadWaitingMessageGet);
+  if ((thread != NULL) && (thread->wait_option == MQ_WAIT_COPY)) {
+    osPosixThreadListUnlink(thread);
+    (void)memcpy(thread->wait_info, msg_ptr, mq->msg_size);
+    if (thread->wait_extra != NULL) {
+      *((uint8_t *)thread->wait_extra) = msg_prio;
+    }
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    return osOK;
+  }
+
+  // Try to allocate memory
+  msg = (os_message_t *)osPosixMemoryPoolAllocBlock(&mq->mp_info);
+  if (msg == NULL) {
+    return osErrorResource;
+  }
+  (void)memcpy(&msg[1], msg_ptr, mq->msg_size);
+  msg->priority = msg_prio;
+  (void)MessageQueueSubmit(mq, msg);
+
+  return osOK;
+}
+
+/// Destroy a Message Queue object (osKernelDestroyClass).
+/// \param[in]  mq              message queue object.
+void osPosixMessageQueueDestroy (os_message_queue_t *mq) {
+  MessageQueueDestroy(mq);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Message Queue object.
+osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+  os_message_queue_t *mq;
+  const char         *name;
+  void               *cb_mem;
+  uint32_t            cb_size;
+  void               *mq_mem;
+  uint32_t            mq_size;
+  uint32_t            block_size;
+  uint32_t            attr_bits;
+  uint8_t             flags = 0U;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+  if ((msg_count == 0U) || (msg_size == 0U) ||
+      ((__UINT32_MAX__ - sizeof(os_message_t) - 7U) < msg_size)) {
+    return NULL;
+  }
+  block_size = ((msg_size + 7U) & ~7UL) + (uint32_t)sizeof(os_message_t);
+  if ((__UINT32_MAX__ / msg_count) < block_size) {
+    return NULL;
+  }
+  mq_size = msg_count * block_size;
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    mq_mem    = attr->mq_mem;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_message_queue_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+    if (mq_mem != NULL) {
+      if ((((uintptr_t)mq_mem & 7U) != 0U) || (attr->mq_size < mq_size)) {
+        return NULL;
+      }
+    } else if (attr->mq_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+    mq_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (mq_mem == NULL) {
+    mq_mem = osPosixMemAlloc(mq_size);
+    if (mq_mem == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    flags |= osPosixFlagSystemMemory;
+  }
+
+  if (cb_mem != NULL) {
+    mq = (os_message_queue_t *)cb_mem;
+    (void)memset(mq, 0, sizeof(os_message_queue_t));
+  } else {
+    mq = (os_message_queue_t *)osPosixMemAlloc(sizeof(os_message_queue_t));
+    if (mq == NULL) {
+      if ((flags & osPosixFlagSystemMemory) != 0U) {
+        osPosixMemFree(mq_mem);
+      }
+      osPosixKernelExit();
+      return NULL;
+    }
+    flags |= osPosixFlagSystemObject;
+  }
+
+  mq->id       = osPosixIdMessageQueue;
+  mq->flags    = flags;
+  mq->attr     = osPosixObjectAttrClass(attr_bits);
+  mq->name     = name;
+  mq->msg_size = msg_size;
+  (void)osPosixMemoryPoolInit(&mq->mp_info, msg_count, block_size, mq_mem);
+  osPosixObjectAdd(mq);
+
+  osPosixKernelExit();
+
+  return mq;
+}
+
+/// Get name of a Message Queue object.
+const char *osMessageQueueGetName (osMessageQueueId_t mq_id) {
+  const os_message_queue_t *mq = (const os_message_queue_t *)mq_id;
+
+  if (osPosixIsIrqMode() || !IsMessageQueueValid(mq)) {
+    return NULL;
+  }
+  return mq->name;
+}
+
+/// Put a Message into a Queue or timeout if Queue is full.
+osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_thread_t        *thread;
+  osStatus_t          status;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return osErrorParameter;
+  }
+  if (!IsMessageQueueValid(mq) || (msg_ptr == NULL)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mq)) {
+    status = osErrorSafetyClass;
+  } else {
+    status = osPosixMessageQueuePutInternal(mq, msg_ptr, msg_prio);
+    if (status != osOK) {
+      if (timeout != 0U) {
+        // Suspend current Thread
+        if (osPosixThreadWaitEnter(osPosixThreadWaitingMessagePut, timeout)) {
+          thread = osPosixThreadSelf;
+          thread->wait_option = MQ_WAIT_COPY;
+          thread->wait_info   = (void *)(uintptr_t)msg_ptr;
+          thread->wait_flags  = msg_prio;
+          osPosixThreadListPut(&mq->thread_list, thread);
+          status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout);
+        } else {
+          status = osErrorTimeout;
+        }
+      } else {
+        status = osErrorResource;
+      }
+    }
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get a Message from a Queue or timeout if Queue is empty.
+osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_thread_t        *thread;
+  osStatus_t          status;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return osErrorParameter;
+  }
+  if (!IsMessageQueueValid(mq) || (msg_ptr == NULL)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mq)) {
+    status = osErrorSafetyClass;
+  } else {
+    if (MessageQueueRead(mq, msg_ptr, msg_prio)) {
+      status = osOK;
+    } else if (timeout != 0U) {
+      // Suspend current Thread
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingMessageGet, timeout)) {
+        thread = osPosixThreadSelf;
+        thread->wait_option = MQ_WAIT_COPY;
+        thread->wait_info   = msg_ptr;
+        thread->wait_extra  = msg_prio;
+        osPosixThreadListPut(&mq->thread_list, thread);
+        status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout);
+      } else {
+        status = osErrorTimeout;
+      }
+    } else {
+      status = osErrorResource;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Put multiple Messages into a Queue or timeout if Queue is full.
+uint32_t osMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq  = (os_message_queue_t *)mq_id;
+  const uint8_t      *msg = (const uint8_t *)msg_ptr;
+  os_thread_t        *thread;
+  uint32_t            count = 0U;
+  uint32_t            tick_start;
+  uint32_t            wait;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return 0U;
+  }
+  if (!IsMessageQueueValid(mq) || (msg_ptr == NULL)) {
+    return 0U;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mq)) {
+    osPosixKernelExit();
+    return 0U;
+  }
+
+  tick_start = osPosixInfo.kernel.tick;
+
+  while (count < msg_count) {
+    if (osPosixMessageQueuePutInternal(mq, &msg[(size_t)count * mq->msg_size], msg_prio) == osOK) {
+      count++;
+      continue;
+    }
+    // Queue full: wait for space for the next message
+    wait = MessageQueueTimeout(timeout, tick_start);
+    if ((wait == 0U) || !osPosixThreadWaitEnter(osPosixThreadWaitingMessagePut, wait)) {
+      break;
+    }
+    thread = osPosixThreadSelf;
+    thread->wait_option = MQ_WAIT_COPY;
+    thread->wait_info   = (void *)(uintptr_t)&msg[(size_t)count * mq->msg_size];
+    thread->wait_flags  = msg_prio;
+    osPosixThreadListPut(&mq->thread_list, thread);
+    if (osPosixThreadWaitBlock((uint32_t)osErrorTimeout) != (uint32_t)osOK) {
+      break;
+    }
+    count++;
+  }
+
+  osPosixKernelExit();
+
+  return count;
+}
+
+/// Get multiple Messages from a Queue or timeout if Queue is empty.
+uint32_t osMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq  = (os_message_queue_t *)mq_id;
+  uint8_t            *msg = (uint8_t *)msg_ptr;
+  os_thread_t        *thread;
+  uint32_t            count = 0U;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return 0U;
+  }
+  if (!IsMessageQueueValid(mq) || (msg_ptr == NULL)) {
+    return 0U;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mq)) {
+    osPosixKernelExit();
+    return 0U;
+  }
+
+  while (count < msg_count) {
+    if (MessageQueueRead(mq, &msg[(size_t)count * mq->msg_size], (msg_prio != NULL) ? &msg_prio[count] : NULL)) {
+      count++;
+      continue;
+    }
+    // Queue empty: return available messages or wait for the first one
+    if ((count != 0U) || (timeout == 0U) ||
+        !osPosixThreadWaitEnter(osPosixThreadWaitingMessageGet, timeout)) {
+      break;
+    }
+    thread = osPosixThreadSelf;
+    thread->wait_option = MQ_WAIT_COPY;
+    thread->wait_info   = msg;
+    thread->wait_extra  = msg_prio;
+    osPosixThreadListPut(&mq->thread_list, thread);
+    if (osPosixThreadWaitBlock((uint32_t)osErrorTimeout) != (uint32_t)osOK) {
+      break;
+    }
+    count = 1U;
+  }
+
+  osPosixKernelExit();
+
+  return count;
+}
+
+/// Acquire a free Message slot in a Queue or timeout if Queue is full.
+void *osMessageQueueAcquire (osMessageQueueId_t mq_id, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_t       *msg;
+  os_thread_t        *thread;
+  void               *msg_ptr = NULL;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return NULL;
+  }
+  if (!IsMessageQueueValid(mq)) {
+    return NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (osPosixClassAllowed(mq)) {
+    msg = (os_message_t *)osPosixMemoryPoolAllocBlock(&mq->mp_info);
+    if (msg != NULL) {
+      msg->state = osPosixMessageAcquired;
+      msg_ptr = &msg[1];
+    } else if (timeout != 0U) {
+      // Suspend current Thread
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingMessagePut, timeout)) {
+        thread = osPosixThreadSelf;
+        thread->wait_option = MQ_WAIT_ZERO_COPY;
+        thread->wait_info   = NULL;
+        osPosixThreadListPut(&mq->thread_list, thread);
+        if (osPosixThreadWaitBlock((uint32_t)osErrorTimeout) == (uint32_t)osOK) {
+          // Slot was passed by osMessageQueueGet/osMessageQueueRelease
+          msg_ptr = thread->wait_info;
+        }
+      }
+    }
+  }
+
+  osPosixKernelExit();
+
+  return msg_ptr;
+}
+
+/// Commit an acquired Message slot to a Queue.
+osStatus_t osMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_t       *msg;
+  osStatus_t          status;
+
+  if (!IsMessageQueueValid(mq)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  msg = MessageQueueSlot(mq, msg_ptr);
+  if (!osPosixClassAllowed(mq)) {
+    status = osErrorSafetyClass;
+  } else if ((msg == NULL) || (msg->state != osPosixMessageAcquired)) {
+    status = osErrorParameter;
+  } else {
+    msg->priority = msg_prio;
+    if (MessageQueueSubmit(mq, msg)) {
+      // Message was copied to a waiting receiver
+      MessageQueueAcceptPut(mq);
+    }
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Borrow a Message from a Queue for in-place reading or timeout if Queue is empty.
+void *osMessageQueueBorrow (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_t       *msg;
+  os_thread_t        *thread;
+  void               *msg_ptr = NULL;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return NULL;
+  }
+  if (!IsMessageQueueValid(mq)) {
+    return NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (osPosixClassAllowed(mq)) {
+    msg = MessageQueueGet(mq);
+    if (msg != NULL) {
+      msg->state = osPosixMessageBorrowed;
+      if (msg_prio != NULL) {
+        *msg_prio = msg->priority;
+      }
+      msg_ptr = &msg[1];
+    } else if (timeout != 0U) {
+      // Suspend current Thread
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingMessageGet, timeout)) {
+        thread = osPosixThreadSelf;
+        thread->wait_option = MQ_WAIT_ZERO_COPY;
+        thread->wait_info   = NULL;
+        thread->wait_extra  = msg_prio;
+        osPosixThreadListPut(&mq->thread_list, thread);
+        if (osPosixThreadWaitBlock((uint32_t)osErrorTimeout) == (uint32_t)osOK) {
+          // Message was passed by osMessageQueuePut/osMessageQueueCommit
+          msg_ptr = thread->wait_info;
+        }
+      }
+    }
+  }
+
+  osPosixKernelExit();
+
+  return msg_ptr;
+}
+
+/// Release a borrowed or an unused acquired Message slot back to a Queue.
+osStatus_t osMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_t       *msg;
+  osStatus_t          status;
+
+  if (!IsMessageQueueValid(mq)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  msg = MessageQueueSlot(mq, msg_ptr);
+  if (!osPosixClassAllowed(mq)) {
+    status = osErrorSafetyClass;
+  } else if ((msg == NULL) ||
+             ((msg->state != osPosixMessageAcquired) && (msg->state != osPosixMessageBorrowed))) {
+    status = osErrorParameter;
+  } else {
+    msg->state = osPosixMessageQueued;
+    (void)osPosixMemoryPoolFreeBlock(&mq->mp_info, msg);
+
+    // Check if Thread is waiting to send a Message
+    MessageQueueAcceptPut(mq);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get maximum number of messages in a Message Queue.
+uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
+  const os_message_queue_t *mq = (const os_message_queue_t *)mq_id;
+
+  if (!IsMessageQueueValid(mq)) {
+    return 0U;
+  }
+  return mq->mp_info.max_blocks;
+}
+
+/// Get maximum message size in a Message Queue.
+uint32_t osMessageQueueGetMsgSize (osMessageQueueId_t mq_id) {
+  const os_message_queue_t *mq = (const os_message_queue_t *)mq_id;
+
+  if (!IsMessageQueueValid(mq)) {
+    return 0U;
+  }
+  return mq->msg_size;
+}
+
+/// Get number of queued messages in a Message Queue.
+uint32_t osMessageQueueGetCount (osMessageQueueId_t mq_id) {
+  const os_message_queue_t *mq = (const os_message_queue_t *)mq_id;
+
+  if (!IsMessageQueueValid(mq)) {
+    return 0U;
+  }
+  return mq->msg_count;
+}
+
+/// Get number of available slots for messages in a Message Queue.
+uint32_t osMessageQueueGetSpace (osMessageQueueId_t mq_id) {
+  const os_message_queue_t *mq = (const os_message_queue_t *)mq_id;
+
+  if (!IsMessageQueueValid(mq)) {
+    return 0U;
+  }
+  return (mq->mp_info.max_blocks - mq->mp_info.used_blocks);
+}
+
+/// Reset a Message Queue to initial empty state.
+osStatus_t osMessageQueueReset (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  os_message_t       *msg;
+  osStatus_t          status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsMessageQueueValid(mq)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mq)) {
+    status = osErrorSafetyClass;
+  } else {
+    // Remove Messages from Queue
+    while ((msg = MessageQueueGet(mq)) != NULL) {
+      (void)osPosixMemoryPoolFreeBlock(&mq->mp_info, msg);
+    }
+    // Accept Messages from Threads waiting to send
+    MessageQueueAcceptPut(mq);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Delete a Message Queue object.
+osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = (os_message_queue_t *)mq_id;
+  osStatus_t          status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsMessageQueueValid(mq)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mq)) {
+    status = osErrorSafetyClass;
+  } else {
+    MessageQueueDestroy(mq);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Mutex functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  ==== Helper functions ====
+
+/// Validate mutex ID.
+static inline bool IsMutexValid (const os_mutex_t *mutex) {
+  return ((mutex != NULL) && (mutex->id == osPosixIdMutex));
+}
+
+/// Add Mutex to the list of mutexes owned by Thread.
+static void MutexOwnerPut (os_mutex_t *mutex, os_thread_t *thread) {
+
+  mutex->owner_thread = thread;
+  mutex->owner_prev   = NULL;
+  mutex->owner_next   = thread->mutex_list;
+  if (mutex->owner_next != NULL) {
+    mutex->owner_next->owner_prev = mutex;
+  }
+  thread->mutex_list = mutex;
+  mutex->lock = 1U;
+}
+
+/// Remove Mutex from the list of mutexes owned by its owner Thread.
+static void MutexOwnerRemove (os_mutex_t *mutex) {
+
+  if (mutex->owner_next != NULL) {
+    mutex->owner_next->owner_prev = mutex->owner_prev;
+  }
+  if (mutex->owner_prev != NULL) {
+    mutex->owner_prev->owner_next = mutex->owner_next;
+  } else {
+    mutex->owner_thread->mutex_list = mutex->owner_next;
+  }
+  mutex->owner_thread = NULL;
+  mutex->owner_prev   = NULL;
+  mutex->owner_next   = NULL;
+  mutex->lock = 0U;
+}
+
+/// Pass Mutex ownership to the highest priority waiting Thread.
+static void MutexHandOver (os_mutex_t *mutex) {
+  os_thread_t *thread;
+
+  thread = osPosixThreadListGet(&mutex->thread_list);
+  if (thread != NULL) {
+    MutexOwnerPut(mutex, thread);
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    osPosixThreadPriorityUpdate(thread);
+  } else {
+    osPosixWaitNotify(mutex);
+  }
+}
+
+/// Destroy a Mutex object (kernel lock held).
+static void MutexDestroy (os_mutex_t *mutex) {
+  os_thread_t *owner;
+  os_thread_t *thread;
+
+  // Unblock waiting threads
+  while ((thread = osPosixThreadListGet(&mutex->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+  }
+  osPosixWaitDestroy(mutex);
+
+  // Release mutex and restore owner priority
+  if (mutex->lock != 0U) {
+    owner = mutex->owner_thread;
+    MutexOwnerRemove(mutex);
+    osPosixThreadPriorityUpdate(owner);
+  }
+
+  mutex->id = osPosixIdInvalid;
+  osPosixObjectRemove(mutex);
+
+  if ((mutex->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(mutex);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Release robust Mutexes owned by a terminating Thread.
+/// \param[in]  mutex_list      mutex list of the terminating thread.
+void osPosixMutexOwnerRelease (os_mutex_t *mutex_list) {
+  os_mutex_t *mutex;
+  os_mutex_t *mutex_next;
+
+  mutex = mutex_list;
+  while (mutex != NULL) {
+    mutex_next = mutex->owner_next;
+    if ((mutex->mutex_attr & osMutexRobust) != 0U) {
+      MutexOwnerRemove(mutex);
+      MutexHandOver(mutex);
+    }
+    mutex = mutex_next;
+  }
+}
+
+/// Restore Mutex owner priority after a waiting Thread left the wait.
+/// \param[in]  mutex           mutex object.
+/// \param[in]  thread_wakeup   thread that left the wait.
+void osPosixMutexOwnerRestore (const os_mutex_t *mutex, const os_thread_t *thread_wakeup) {
+  (void)thread_wakeup;
+
+  if (((mutex->mutex_attr & osMutexPrioInherit) != 0U) && (mutex->owner_thread != NULL)) {
+    osPosixThreadPriorityUpdate(mutex->owner_thread);
+  }
+}
+
+/// Destroy a Mutex object (osKernelDestroyClass).
+/// \param[in]  mutex           mutex object.
+void osPosixMutexDestroy (os_mutex_t *mutex) {
+  MutexDestroy(mutex);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Mutex object.
+osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
+  os_mutex_t *mutex;
+  const char *name;
+  void       *cb_mem;
+  uint32_t    cb_size;
+  uint32_t    attr_bits;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_mutex_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    mutex = (os_mutex_t *)cb_mem;
+    (void)memset(mutex, 0, sizeof(os_mutex_t));
+  } else {
+    mutex = (os_mutex_t *)osPosixMemAlloc(sizeof(os_mutex_t));
+    if (mutex == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    mutex->flags = osPosixFlagSystemObject;
+  }
+
+  mutex->id         = osPosixIdMutex;
+  mutex->attr       = osPosixObjectAttrClass(attr_bits);
+  mutex->name       = name;
+  mutex->mutex_attr = (uint8_t)(attr_bits & (osMutexRecursive | osMutexPrioInherit | osMutexRobust));
+  osPosixObjectAdd(mutex);
+
+  osPosixKernelExit();
+
+  return mutex;
+}
+
+/// Get name of a Mutex object.
+const char *osMutexGetName (osMutexId_t mutex_id) {
+  const os_mutex_t *mutex = (const os_mutex_t *)mutex_id;
+
+  if (osPosixIsIrqMode() || !IsMutexValid(mutex)) {
+    return NULL;
+  }
+  return mutex->name;
+}
+
+/// Acquire a Mutex or timeout if it is locked.
+osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
+  os_mutex_t  *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t *thread;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsMutexValid(mutex)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  thread = osPosixThreadSelf;
+
+  if (!osPosixClassAllowed(mutex)) {
+    status = osErrorSafetyClass;
+  } else if (thread == NULL) {
+    status = osError;
+  } else if (mutex->lock == 0U) {
+    // Acquire Mutex
+    MutexOwnerPut(mutex, thread);
+    status = osOK;
+  } else if (((mutex->mutex_attr & osMutexRecursive) != 0U) && (mutex->owner_thread == thread)) {
+    // Try to increment lock counter
+    if (mutex->lock == 0xFFFFU) {
+      status = osErrorResource;
+    } else {
+      mutex->lock++;
+      status = osOK;
+    }
+  } else if (timeout != 0U) {
+    // Suspend current Thread
+    if (osPosixThreadWaitEnter(osPosixThreadWaitingMutex, timeout)) {
+      thread->wait_info = mutex;
+      osPosixThreadListPut(&mutex->thread_list, thread);
+      // Priority inheritance
+      if ((mutex->mutex_attr & osMutexPrioInherit) != 0U) {
+        osPosixThreadPriorityUpdate(mutex->owner_thread);
+      }
+      status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout);
+    } else {
+      status = osErrorTimeout;
+    }
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Release a Mutex that was acquired by osMutexAcquire.
+osStatus_t osMutexRelease (osMutexId_t mutex_id) {
+  os_mutex_t  *mutex = (os_mutex_t *)mutex_id;
+  os_thread_t *thread;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsMutexValid(mutex)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  thread = osPosixThreadSelf;
+
+  if (!osPosixClassAllowed(mutex)) {
+    status = osErrorSafetyClass;
+  } else if ((mutex->lock == 0U) || (mutex->owner_thread != thread)) {
+    status = osErrorResource;
+  } else {
+    mutex->lock--;
+    if (mutex->lock == 0U) {
+      MutexOwnerRemove(mutex);
+      // Restore running Thread priority
+      osPosixThreadPriorityUpdate(thread);
+      // Check if Thread is waiting for a Mutex
+      MutexHandOver(mutex);
+    }
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get Thread which owns a Mutex object.
+osThreadId_t osMutexGetOwner (osMutexId_t mutex_id) {
+  const os_mutex_t *mutex = (const os_mutex_t *)mutex_id;
+
+  if (osPosixIsIrqMode() || !IsMutexValid(mutex) || (mutex->lock == 0U)) {
+    return NULL;
+  }
+  return mutex->owner_thread;
+}
+
+/// Delete a Mutex object.
+osStatus_t osMutexDelete (osMutexId_t mutex_id) {
+  os_mutex_t *mutex = (os_mutex_t *)mutex_id;
+  osStatus_t  status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsMutexValid(mutex)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(mutex)) {
+    status = osErrorSafetyClass;
+  } else {
+    MutexDestroy(mutex);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
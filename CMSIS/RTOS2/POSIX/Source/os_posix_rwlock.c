@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Reader-Writer Lock functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+#define RWLOCK_SHARED       0x00U       ///< Thread waits for shared access
+#define RWLOCK_EXCLUSIVE    0x01U       ///< Thread waits for exclusive access
+
+
+//  ==== Helper functions ====
+
+/// Validate reader-writer lock ID.
+static inline bool IsRwLockValid (const os_rwlock_t *rwlock) {
+  return ((rwlock != NULL) && (rwlock->id == osPosixIdRwLock));
+}
+
+/// Add Reader-Writer Lock to the list of locks owned exclusively by Thread.
+static void RwLockOwnerPut (os_rwlock_t *rwlock, os_thread_t *thread) {
+
+  rwlock->owner_thread = thread;
+  rwlock->owner_prev   = NULL;
+  rwlock->owner_next   = thread->rwlock_list;
+  if (rwlock->owner_next != NULL) {
+    rwlock->owner_next->owner_prev = rwlock;
+  }
+  thread->rwlock_list = rwlock;
+}
+
+/// Remove Reader-Writer Lock from the list of locks owned by its owner Thread.
+static void RwLockOwnerRemove (os_rwlock_t *rwlock) {
+
+  if (rwlock->owner_next != NULL) {
+    rwlock->owner_next->owner_prev = rwlock->owner_prev;
+  }
+  if (rwlock->owner_prev != NULL) {
+    rwlock->owner_prev->owner_next = rwlock->owner_next;
+  } else {
+    rwlock->owner_thread->rwlock_list = rwlock->owner_next;
+  }
+  rwlock->owner_thread = NULL;
+  rwlock->owner_prev   = NULL;
+  rwlock->owner_next   = NULL;
+}
+
+/// Get the highest priority Thread waiting for exclusive access.
+static os_thread_t *RwLockWriter (const os_rwlock_t *rwlock) {
+  os_thread_t *thread;
+
+  for (thread = rwlock->thread_list; thread != NULL; thread = thread->thread_next) {
+    if (thread->wait_option == RWLOCK_EXCLUSIVE) {
+      break;
+    }
+  }
+  return thread;
+}
+
+/// Pass the Reader-Writer Lock to waiting Threads (writer preference).
+static void RwLockHandOver (os_rwlock_t *rwlock) {
+  os_thread_t *thread;
+
+  if (rwlock->owner_thread != NULL) {
+    return;
+  }
+
+  thread = RwLockWriter(rwlock);
+  if (thread != NULL) {
+    // Waiting writer: readers keep waiting until it has released the lock
+    if (rwlock->readers == 0U) {
+      osPosixThreadListUnlink(thread);
+      RwLockOwnerPut(rwlock, thread);
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+      osPosixThreadPriorityUpdate(thread);
+    }
+    return;
+  }
+
+  // No writer waiting: admit all waiting readers
+  while ((thread = osPosixThreadListGet(&rwlock->thread_list)) != NULL) {
+    rwlock->readers++;
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+  }
+}
+
+/// Suspend the running Thread until the Reader-Writer Lock is passed to it.
+static osStatus_t RwLockWait (os_rwlock_t *rwlock, os_thread_t *thread, uint8_t mode, uint32_t timeout) {
+
+  if (!osPosixThreadWaitEnter(osPosixThreadWaitingRwLock, timeout)) {
+    return osErrorTimeout;
+  }
+  thread->wait_info   = rwlock;
+  thread->wait_option = mode;
+  osPosixThreadListPut(&rwlock->thread_list, thread);
+  // Priority inheritance (exclusive owner only)
+  osPosixThreadPriorityUpdate(rwlock->owner_thread);
+
+  return ((osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout));
+}
+
+/// Destroy a Reader-Writer Lock object (kernel lock held).
+static void RwLockDestroy (os_rwlock_t *rwlock) {
+  os_thread_t *owner;
+  os_thread_t *thread;
+
+  // Unblock waiting threads
+  while ((thread = osPosixThreadListGet(&rwlock->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+  }
+
+  // Release exclusive access and restore owner priority
+  if (rwlock->owner_thread != NULL) {
+    owner = rwlock->owner_thread;
+    RwLockOwnerRemove(rwlock);
+    osPosixThreadPriorityUpdate(owner);
+  }
+
+  rwlock->id = osPosixIdInvalid;
+  osPosixObjectRemove(rwlock);
+
+  if ((rwlock->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(rwlock);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Release Reader-Writer Locks owned exclusively by a terminating Thread.
+/// \param[in]  rwlock_list     reader-writer lock list of the terminating thread.
+void osPosixRwLockOwnerRelease (os_rwlock_t *rwlock_list) {
+  os_rwlock_t *rwlock;
+  os_rwlock_t *rwlock_next;
+
+  rwlock = rwlock_list;
+  while (rwlock != NULL) {
+    rwlock_next = rwlock->owner_next;
+    RwLockOwnerRemove(rwlock);
+    RwLockHandOver(rwlock);
+    rwlock = rwlock_next;
+  }
+}
+
+/// Update Reader-Writer Lock after a waiting Thread left the wait (timeout, suspend, terminate).
+/// \param[in]  rwlock          reader-writer lock object.
+/// \param[in]  thread          thread that left the wait.
+void osPosixRwLockWaitAbort (os_rwlock_t *rwlock, const os_thread_t *thread) {
+
+  if (rwlock->owner_thread != NULL) {
+    osPosixThreadPriorityUpdate(rwlock->owner_thread);
+  } else if (thread->wait_option == RWLOCK_EXCLUSIVE) {
+    // Readers blocked by writer preference may proceed
+    RwLockHandOver(rwlock);
+  }
+}
+
+/// Destroy a Reader-Writer Lock object (osKernelDestroyClass).
+/// \param[in]  rwlock          reader-writer lock object.
+void osPosixRwLockDestroy (os_rwlock_t *rwlock) {
+  RwLockDestroy(rwlock);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Reader-Writer Lock object.
+osRwLockId_t osRwLockNew (const osRwLockAttr_t *attr) {
+  os_rwlock_t *rwlock;
+  const char  *name;
+  void        *cb_mem;
+  uint32_t     cb_size;
+  uint32_t     attr_bits;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_rwlock_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    rwlock = (os_rwlock_t *)cb_mem;
+    (void)memset(rwlock, 0, sizeof(os_rwlock_t));
+  } else {
+    rwlock = (os_rwlock_t *)osPosixMemAlloc(sizeof(os_rwlock_t));
+    if (rwlock == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    rwlock->flags = osPosixFlagSystemObject;
+  }
+
+  rwlock->id   = osPosixIdRwLock;
+  rwlock->attr = osPosixObjectAttrClass(attr_bits);
+  rwlock->name = name;
+  osPosixObjectAdd(rwlock);
+
+  osPosixKernelExit();
+
+  return rwlock;
+}
+
+/// Get name of a Reader-Writer Lock object.
+const char *osRwLockGetName (osRwLockId_t rwlock_id) {
+  const os_rwlock_t *rwlock = (const os_rwlock_t *)rwlock_id;
+
+  if (!IsRwLockValid(rwlock)) {
+    return NULL;
+  }
+  return rwlock->name;
+}
+
+/// Acquire a Reader-Writer Lock for shared access or timeout if it is locked for exclusive access.
+osStatus_t osRwLockAcquireShared (osRwLockId_t rwlock_id, uint32_t timeout) {
+  os_rwlock_t *rwlock = (os_rwlock_t *)rwlock_id;
+  os_thread_t *thread;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsRwLockValid(rwlock)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  thread = osPosixThreadSelf;
+
+  if (!osPosixClassAllowed(rwlock)) {
+    status = osErrorSafetyClass;
+  } else if (thread == NULL) {
+    status = osError;
+  } else if (rwlock->owner_thread == thread) {
+    // Shared access while owning exclusive access would deadlock
+    status = osErrorResource;
+  } else if ((rwlock->owner_thread == NULL) && (RwLockWriter(rwlock) == NULL)) {
+    rwlock->readers++;
+    status = osOK;
+  } else if (timeout != 0U) {
+    status = RwLockWait(rwlock, thread, RWLOCK_SHARED, timeout);
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Acquire a Reader-Writer Lock for exclusive access or timeout if it is locked.
+osStatus_t osRwLockAcquireExclusive (osRwLockId_t rwlock_id, uint32_t timeout) {
+  os_rwlock_t *rwlock = (os_rwlock_t *)rwlock_id;
+  os_thread_t *thread;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsRwLockValid(rwlock)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  thread = osPosixThreadSelf;
+
+  if (!osPosixClassAllowed(rwlock)) {
+    status = osErrorSafetyClass;
+  } else if (thread == NULL) {
+    status = osError;
+  } else if (rwlock->owner_thread == thread) {
+    status = osErrorResource;
+  } else if ((rwlock->owner_thread == NULL) && (rwlock->readers == 0U)) {
+    RwLockOwnerPut(rwlock, thread);
+    status = osOK;
+  } else if (timeout != 0U) {
+    status = RwLockWait(rwlock, thread, RWLOCK_EXCLUSIVE, timeout);
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Release a Reader-Writer Lock that was acquired by osRwLockAcquireShared or osRwLockAcquireExclusive.
+osStatus_t osRwLockRelease (osRwLockId_t rwlock_id) {
+  os_rwlock_t *rwlock = (os_rwlock_t *)rwlock_id;
+  os_thread_t *thread;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsRwLockValid(rwlock)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  thread = osPosixThreadSelf;
+
+  if (!osPosixClassAllowed(rwlock)) {
+    status = osErrorSafetyClass;
+  } else if ((rwlock->owner_thread != NULL) && (rwlock->owner_thread == thread)) {
+    // Release exclusive access and restore running Thread priority
+    RwLockOwnerRemove(rwlock);
+    osPosixThreadPriorityUpdate(thread);
+    RwLockHandOver(rwlock);
+    status = osOK;
+  } else if ((rwlock->owner_thread == NULL) && (rwlock->readers != 0U)) {
+    // Release shared access
+    rwlock->readers--;
+    if (rwlock->readers == 0U) {
+      RwLockHandOver(rwlock);
+    }
+    status = osOK;
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get Thread which owns a Reader-Writer Lock for exclusive access.
+osThreadId_t osRwLockGetOwner (osRwLockId_t rwlock_id) {
+  const os_rwlock_t *rwlock = (const os_rwlock_t *)rwlock_id;
+
+  if (osPosixIsIrqMode() || !IsRwLockValid(rwlock)) {
+    return NULL;
+  }
+  return rwlock->owner_thread;
+}
+
+/// Delete a Reader-Writer Lock object.
+osStatus_t osRwLockDelete (osRwLockId_t rwlock_id) {
+  os_rwlock_t *rwlock = (os_rwlock_t *)rwlock_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsRwLockValid(rwlock)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(rwlock)) {
+    status = osErrorSafetyClass;
+  } else {
+    RwLockDestroy(rwlock);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
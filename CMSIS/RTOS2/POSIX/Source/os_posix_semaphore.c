@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Semaphore functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  ==== Helper functions ====
+
+/// Validate semaphore ID.
+static inline bool IsSemaphoreValid (const os_semaphore_t *semaphore) {
+  return ((semaphore != NULL) && (semaphore->id == osPosixIdSemaphore));
+}
+
+/// Destroy a Semaphore object (kernel lock held).
+static void SemaphoreDestroy (os_semaphore_t *semaphore) {
+  os_thread_t *thread;
+
+  // Unblock waiting threads
+  while ((thread = osPosixThreadListGet(&semaphore->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+  }
+  osPosixWaitDestroy(semaphore);
+
+  semaphore->id = osPosixIdInvalid;
+  osPosixObjectRemove(semaphore);
+
+  if ((semaphore->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(semaphore);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Destroy a Semaphore object (osKernelDestroyClass).
+/// \param[in]  semaphore       semaphore object.
+void osPosixSemaphoreDestroy (os_semaphore_t *semaphore) {
+  SemaphoreDestroy(semaphore);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Semaphore object.
+osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
+  os_semaphore_t *semaphore;
+  const char     *name;
+  void           *cb_mem;
+  uint32_t        cb_size;
+  uint32_t        attr_bits;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+  if ((max_count == 0U) || (initial_count > max_count)) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_semaphore_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    semaphore = (os_semaphore_t *)cb_mem;
+    (void)memset(semaphore, 0, sizeof(os_semaphore_t));
+  } else {
+    semaphore = (os_semaphore_t *)osPosixMemAlloc(sizeof(os_semaphore_t));
+    if (semaphore == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    semaphore->flags = osPosixFlagSystemObject;
+  }
+
+  semaphore->id         = osPosixIdSemaphore;
+  semaphore->attr       = osPosixObjectAttrClass(attr_bits);
+  semaphore->name       = name;
+  semaphore->tokens     = initial_count;
+  semaphore->max_tokens = max_count;
+  osPosixObjectAdd(semaphore);
+
+  osPosixKernelExit();
+
+  return semaphore;
+}
+
+/// Get name of a Semaphore object.
+const char *osSemaphoreGetName (osSemaphoreId_t semaphore_id) {
+  const os_semaphore_t *semaphore = (const os_semaphore_t *)semaphore_id;
+
+  if (osPosixIsIrqMode() || !IsSemaphoreValid(semaphore)) {
+    return NULL;
+  }
+  return semaphore->name;
+}
+
+/// Acquire a Semaphore token or timeout if no tokens are available.
+osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+  osStatus_t      status;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return osErrorParameter;
+  }
+  if (!IsSemaphoreValid(semaphore)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(semaphore)) {
+    status = osErrorSafetyClass;
+  } else if (semaphore->tokens != 0U) {
+    semaphore->tokens--;
+    status = osOK;
+  } else if (timeout != 0U) {
+    // Suspend current Thread
+    if (osPosixThreadWaitEnter(osPosixThreadWaitingSemaphore, timeout)) {
+      osPosixThreadListPut(&semaphore->thread_list, osPosixThreadSelf);
+      status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout);
+    } else {
+      status = osErrorTimeout;
+    }
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Release a Semaphore token up to the initial maximum count.
+osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+  os_thread_t    *thread;
+  osStatus_t      status;
+
+  if (!IsSemaphoreValid(semaphore)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(semaphore)) {
+    status = osErrorSafetyClass;
+  } else if (semaphore->thread_list != NULL) {
+    // Wakeup waiting Thread with highest Priority (token is passed directly)
+    thread = osPosixThreadListGet(&semaphore->thread_list);
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    status = osOK;
+  } else if (semaphore->tokens < semaphore->max_tokens) {
+    semaphore->tokens++;
+    osPosixWaitNotify(semaphore);
+    status = osOK;
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get current Semaphore token count.
+uint32_t osSemaphoreGetCount (osSemaphoreId_t semaphore_id) {
+  const os_semaphore_t *semaphore = (const os_semaphore_t *)semaphore_id;
+
+  if (!IsSemaphoreValid(semaphore)) {
+    return 0U;
+  }
+  return semaphore->tokens;
+}
+
+/// Delete a Semaphore object.
+osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = (os_semaphore_t *)semaphore_id;
+  osStatus_t      status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsSemaphoreValid(semaphore)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(semaphore)) {
+    status = osErrorSafetyClass;
+  } else {
+    SemaphoreDestroy(semaphore);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
@@ -0,0 +1,625 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Stream Buffer functions
+ *
+ * The writer owns the head index and the reader owns the tail index; data is
+ * copied without the kernel lock. Both indices run from 0 to 2*size-1 so that
+ * a full buffer can be told apart from an empty one without a spare byte.
+ * A side that has to block publishes the number of bytes it waits for before
+ * it re-checks the indices under the kernel lock; the other side enters the
+ * kernel only when that number is available after moving its index.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  ==== Helper functions ====
+
+/// Validate stream buffer ID.
+static inline bool IsStreamBufferValid (const os_stream_buffer_t *sb) {
+  return ((sb != NULL) && (sb->id == osPosixIdStreamBuffer));
+}
+
+/// Get number of bytes between the read and the write index.
+static inline uint32_t StreamBufferCount (const os_stream_buffer_t *sb, uint32_t head, uint32_t tail) {
+  return ((head >= tail) ? (head - tail) : ((2U * sb->size) - (tail - head)));
+}
+
+/// Advance a read or write index.
+static inline uint32_t StreamBufferAdvance (const os_stream_buffer_t *sb, uint32_t index, uint32_t count) {
+  index += count;
+  if (index >= (2U * sb->size)) {
+    index -= 2U * sb->size;
+  }
+  return index;
+}
+
+/// Get data offset of a read or write index.
+static inline uint32_t StreamBufferOffset (const os_stream_buffer_t *sb, uint32_t index) {
+  return ((index >= sb->size) ? (index - sb->size) : index);
+}
+
+/// Get number of bytes available for reading.
+static inline uint32_t StreamBufferAvailRead (const os_stream_buffer_t *sb) {
+  return StreamBufferCount(sb, __atomic_load_n(&sb->head, __ATOMIC_ACQUIRE),
+                               __atomic_load_n(&sb->tail, __ATOMIC_ACQUIRE));
+}
+
+/// Get number of bytes available for writing.
+static inline uint32_t StreamBufferAvailWrite (const os_stream_buffer_t *sb) {
+  return (sb->size - StreamBufferAvailRead(sb));
+}
+
+/// Copy data into the Stream Buffer (writer side, no kernel lock).
+/// \return number of bytes copied.
+static uint32_t StreamBufferCopyIn (os_stream_buffer_t *sb, const uint8_t *data, uint32_t size) {
+  uint32_t head;
+  uint32_t offset;
+  uint32_t count;
+  uint32_t first;
+
+  head  = sb->head;
+  count = sb->size - StreamBufferCount(sb, head, __atomic_load_n(&sb->tail, __ATOMIC_ACQUIRE));
+  if (count > size) {
+    count = size;
+  }
+  if (count == 0U) {
+    return 0U;
+  }
+
+  offset = StreamBufferOffset(sb, head);
+  first  = sb->size - offset;
+  if (first > count) {
+    first = count;
+  }
+  (void)memcpy(&sb->data[offset], data, first);
+  (void)memcpy(sb->data, &data[first], count - first);
+
+  __atomic_store_n(&sb->head, StreamBufferAdvance(sb, head, count), __ATOMIC_RELEASE);
+
+  return count;
+}
+
+/// Copy data out of the Stream Buffer (reader side, no kernel lock).
+/// \return number of bytes copied.
+static uint32_t StreamBufferCopyOut (os_stream_buffer_t *sb, uint8_t *data, uint32_t size) {
+  uint32_t tail;
+  uint32_t offset;
+  uint32_t count;
+  uint32_t first;
+
+  tail  = sb->tail;
+  count = StreamBufferCount(sb, __atomic_load_n(&sb->head, __ATOMIC_ACQUIRE), tail);
+  if (count > size) {
+    count = size;
+  }
+  if (count == 0U) {
+    return 0U;
+  }
+
+  offset = StreamBufferOffset(sb, tail);
+  first  = sb->size - offset;
+  if (first > count) {
+    first = count;
+  }
+  (void)memcpy(data, &sb->data[offset], first);
+  (void)memcpy(&data[first], sb->data, count - first);
+
+  __atomic_store_n(&sb->tail, StreamBufferAdvance(sb, tail, count), __ATOMIC_RELEASE);
+
+  return count;
+}
+
+/// Release waiting Threads whose wait condition is met (kernel lock held).
+static void StreamBufferWakeup (os_stream_buffer_t *sb) {
+  os_thread_t *thread;
+  os_thread_t *thread_next;
+  uint32_t     avail;
+
+  thread = sb->thread_list;
+  while (thread != NULL) {
+    thread_next = thread->thread_next;
+    if (thread->state == osPosixThreadWaitingStreamRead) {
+      avail = StreamBufferAvailRead(sb);
+    } else {
+      avail = StreamBufferAvailWrite(sb);
+    }
+    if (avail >= thread->wait_flags) {
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    }
+    thread = thread_next;
+  }
+}
+
+/// Release the blocked reader after data was written (writer side).
+static void StreamBufferNotifyReader (os_stream_buffer_t *sb) {
+  uint32_t need;
+
+  // Order the index update before the check of the waiting reader (pairs with StreamBufferWait)
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  need = __atomic_load_n(&sb->read_need, __ATOMIC_RELAXED);
+  if ((need != 0U) && (StreamBufferAvailRead(sb) >= need)) {
+    osPosixKernelEnter();
+    StreamBufferWakeup(sb);
+    osPosixKernelExit();
+  }
+}
+
+/// Release the blocked writer after data was removed (reader side).
+static void StreamBufferNotifyWriter (os_stream_buffer_t *sb) {
+  uint32_t need;
+
+  // Order the index update before the check of the waiting writer (pairs with StreamBufferWait)
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  need = __atomic_load_n(&sb->write_need, __ATOMIC_RELAXED);
+  if ((need != 0U) && (StreamBufferAvailWrite(sb) >= need)) {
+    osPosixKernelEnter();
+    StreamBufferWakeup(sb);
+    osPosixKernelExit();
+  }
+}
+
+/// Wait until the Stream Buffer has 'need' bytes available for reading or writing.
+/// \param[in]  state           osPosixThreadWaitingStreamRead or osPosixThreadWaitingStreamWrite.
+/// \return osOK - condition met, osErrorTimeout - timeout, osErrorResource - object deleted.
+static osStatus_t StreamBufferWait (os_stream_buffer_t *sb, uint8_t state, uint32_t need, uint32_t timeout, uint32_t tick_start) {
+  os_thread_t       *thread;
+  volatile uint32_t *wait_need;
+  osStatus_t         status;
+  uint32_t           avail;
+  uint32_t           elapsed;
+
+  wait_need = (state == osPosixThreadWaitingStreamRead) ? &sb->read_need : &sb->write_need;
+
+  osPosixKernelEnter();
+
+  // Publish the requirement before the indices are checked again (pairs with StreamBufferNotify*)
+  __atomic_store_n(wait_need, need, __ATOMIC_SEQ_CST);
+
+  if (state == osPosixThreadWaitingStreamRead) {
+    avail = StreamBufferAvailRead(sb);
+  } else {
+    avail = StreamBufferAvailWrite(sb);
+  }
+
+  if (timeout != osWaitForever) {
+    elapsed = osPosixInfo.kernel.tick - tick_start;
+    timeout = (elapsed < timeout) ? (timeout - elapsed) : 0U;
+  }
+
+  if (avail >= need) {
+    status = osOK;
+  } else if ((timeout != 0U) && osPosixThreadWaitEnter(state, timeout)) {
+    thread = osPosixThreadSelf;
+    thread->wait_info  = sb;
+    thread->wait_flags = need;
+    osPosixThreadListPut(&sb->thread_list, thread);
+    status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout);
+  } else {
+    status = osErrorTimeout;
+  }
+
+  if (status != osErrorResource) {
+    __atomic_store_n(wait_need, 0U, __ATOMIC_SEQ_CST);
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get number of bytes a reader waits for.
+static uint32_t StreamBufferReadNeed (const os_stream_buffer_t *sb, uint32_t size) {
+  uint32_t need = sb->trigger;
+
+  if (need > size) {
+    need = size;
+  }
+  return ((need != 0U) ? need : 1U);
+}
+
+/// Destroy a Stream Buffer object (kernel lock held).
+static void StreamBufferDestroy (os_stream_buffer_t *sb) {
+  os_thread_t *thread;
+
+  // Unblock waiting threads
+  while ((thread = osPosixThreadListGet(&sb->thread_list)) != NULL) {
+    osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+  }
+
+  sb->id = osPosixIdInvalid;
+  osPosixObjectRemove(sb);
+
+  if ((sb->flags & osPosixFlagSystemMemory) != 0U) {
+    osPosixMemFree(sb->data);
+  }
+  if ((sb->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(sb);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Destroy a Stream Buffer object (osKernelDestroyClass).
+/// \param[in]  sb              stream buffer object.
+void osPosixStreamBufferDestroy (os_stream_buffer_t *sb) {
+  StreamBufferDestroy(sb);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Stream Buffer object.
+osStreamBufferId_t osStreamBufferNew (uint32_t size, uint32_t trigger_level, const osStreamBufferAttr_t *attr) {
+  os_stream_buffer_t *sb;
+  const char         *name;
+  void               *cb_mem;
+  uint32_t            cb_size;
+  void               *sb_mem;
+  uint32_t            attr_bits;
+  uint8_t             flags = 0U;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+  if ((size == 0U) || (size > (__UINT32_MAX__ / 2U)) || (trigger_level > size)) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    sb_mem    = attr->sb_mem;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_stream_buffer_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+    if (sb_mem != NULL) {
+      if (attr->sb_size < size) {
+        return NULL;
+      }
+    } else if (attr->sb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+    sb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (sb_mem == NULL) {
+    sb_mem = osPosixMemAlloc(size);
+    if (sb_mem == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    flags |= osPosixFlagSystemMemory;
+  }
+
+  if (cb_mem != NULL) {
+    sb = (os_stream_buffer_t *)cb_mem;
+    (void)memset(sb, 0, sizeof(os_stream_buffer_t));
+  } else {
+    sb = (os_stream_buffer_t *)osPosixMemAlloc(sizeof(os_stream_buffer_t));
+    if (sb == NULL) {
+      if ((flags & osPosixFlagSystemMemory) != 0U) {
+        osPosixMemFree(sb_mem);
+      }
+      osPosixKernelExit();
+      return NULL;
+    }
+    flags |= osPosixFlagSystemObject;
+  }
+
+  sb->id      = osPosixIdStreamBuffer;
+  sb->flags   = flags;
+  sb->attr    = osPosixObjectAttrClass(attr_bits);
+  sb->name    = name;
+  sb->data    = (uint8_t *)sb_mem;
+  sb->size    = size;
+  sb->trigger = trigger_level;
+  osPosixObjectAdd(sb);
+
+  osPosixKernelExit();
+
+  return sb;
+}
+
+/// Get name of a Stream Buffer object.
+const char *osStreamBufferGetName (osStreamBufferId_t sb_id) {
+  const os_stream_buffer_t *sb = (const os_stream_buffer_t *)sb_id;
+
+  if (!IsStreamBufferValid(sb)) {
+    return NULL;
+  }
+  return sb->name;
+}
+
+/// Write data into a Stream Buffer or timeout if the Stream Buffer is full.
+uint32_t osStreamBufferWrite (osStreamBufferId_t sb_id, const void *data, uint32_t size, uint32_t timeout) {
+  os_stream_buffer_t *sb  = (os_stream_buffer_t *)sb_id;
+  const uint8_t      *buf = (const uint8_t *)data;
+  osStatus_t          status;
+  uint32_t            tick_start;
+  uint32_t            need;
+  uint32_t            count;
+  uint32_t            n;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return 0U;
+  }
+  if (!IsStreamBufferValid(sb) || (data == NULL) || !osPosixClassAllowed(sb)) {
+    return 0U;
+  }
+
+  tick_start = osKernelGetTickCount();
+
+  count = StreamBufferCopyIn(sb, buf, size);
+  if (count != 0U) {
+    StreamBufferNotifyReader(sb);
+  }
+
+  while ((count < size) && (timeout != 0U)) {
+    // Wait until the remaining data fits (or the buffer is empty)
+    need = size - count;
+    if (need > sb->size) {
+      need = sb->size;
+    }
+    status = StreamBufferWait(sb, osPosixThreadWaitingStreamWrite, need, timeout, tick_start);
+    if (status == osErrorResource) {
+      break;
+    }
+    n = StreamBufferCopyIn(sb, &buf[count], size - count);
+    if (n != 0U) {
+      count += n;
+      StreamBufferNotifyReader(sb);
+    }
+    if (status != osOK) {
+      break;
+    }
+  }
+
+  return count;
+}
+
+/// Read data from a Stream Buffer or timeout if less than the trigger level is available.
+uint32_t osStreamBufferRead (osStreamBufferId_t sb_id, void *data, uint32_t size, uint32_t timeout) {
+  os_stream_buffer_t *sb = (os_stream_buffer_t *)sb_id;
+  uint32_t            tick_start;
+  uint32_t            count;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return 0U;
+  }
+  if (!IsStreamBufferValid(sb) || (data == NULL) || (size == 0U) || !osPosixClassAllowed(sb)) {
+    return 0U;
+  }
+
+  tick_start = osKernelGetTickCount();
+
+  if ((timeout != 0U) && (StreamBufferAvailRead(sb) < StreamBufferReadNeed(sb, size))) {
+    if (StreamBufferWait(sb, osPosixThreadWaitingStreamRead, StreamBufferReadNeed(sb, size),
+                         timeout, tick_start) == osErrorResource) {
+      return 0U;
+    }
+  }
+
+  // Return the available data, also when the trigger level was not reached in time
+  count = StreamBufferCopyOut(sb, (uint8_t *)data, size);
+  if (count != 0U) {
+    StreamBufferNotifyWriter(sb);
+  }
+
+  return count;
+}
+
+/// Get the contiguous span of readable data in a Stream Buffer or timeout if less than the trigger level is available.
+void *osStreamBufferGetSpan (osStreamBufferId_t sb_id, uint32_t *size, uint32_t timeout) {
+  os_stream_buffer_t *sb = (os_stream_buffer_t *)sb_id;
+  uint32_t            tick_start;
+  uint32_t            tail;
+  uint32_t            offset;
+  uint32_t            count;
+
+  if (size != NULL) {
+    *size = 0U;
+  }
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return NULL;
+  }
+  if (!IsStreamBufferValid(sb) || (size == NULL) || !osPosixClassAllowed(sb)) {
+    return NULL;
+  }
+
+  tick_start = osKernelGetTickCount();
+
+  if ((timeout != 0U) && (StreamBufferAvailRead(sb) < StreamBufferReadNeed(sb, sb->size))) {
+    if (StreamBufferWait(sb, osPosixThreadWaitingStreamRead, StreamBufferReadNeed(sb, sb->size),
+                         timeout, tick_start) == osErrorResource) {
+      return NULL;
+    }
+  }
+
+  tail  = sb->tail;
+  count = StreamBufferCount(sb, __atomic_load_n(&sb->head, __ATOMIC_ACQUIRE), tail);
+  if (count == 0U) {
+    return NULL;
+  }
+  offset = StreamBufferOffset(sb, tail);
+  if (count > (sb->size - offset)) {
+    // Data wraps around: return the part up to the end of the storage
+    count = sb->size - offset;
+  }
+  *size = count;
+
+  return &sb->data[offset];
+}
+
+/// Consume data from a Stream Buffer that was obtained by osStreamBufferGetSpan.
+osStatus_t osStreamBufferConsume (osStreamBufferId_t sb_id, uint32_t size) {
+  os_stream_buffer_t *sb = (os_stream_buffer_t *)sb_id;
+  uint32_t            tail;
+
+  if (!IsStreamBufferValid(sb)) {
+    return osErrorParameter;
+  }
+  if (!osPosixClassAllowed(sb)) {
+    return osErrorSafetyClass;
+  }
+
+  tail = sb->tail;
+  if (size > StreamBufferCount(sb, __atomic_load_n(&sb->head, __ATOMIC_ACQUIRE), tail)) {
+    return osErrorParameter;
+  }
+  if (size != 0U) {
+    __atomic_store_n(&sb->tail, StreamBufferAdvance(sb, tail, size), __ATOMIC_RELEASE);
+    StreamBufferNotifyWriter(sb);
+  }
+
+  return osOK;
+}
+
+/// Set the trigger level of a Stream Buffer.
+osStatus_t osStreamBufferSetTriggerLevel (osStreamBufferId_t sb_id, uint32_t trigger_level) {
+  os_stream_buffer_t *sb = (os_stream_buffer_t *)sb_id;
+  os_thread_t        *thread;
+  osStatus_t          status;
+
+  if (!IsStreamBufferValid(sb) || (trigger_level > sb->size)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(sb)) {
+    status = osErrorSafetyClass;
+  } else {
+    sb->trigger = trigger_level;
+    // A lower trigger level applies to a reader that is already waiting
+    for (thread = sb->thread_list; thread != NULL; thread = thread->thread_next) {
+      if ((thread->state == osPosixThreadWaitingStreamRead) && (thread->wait_flags > trigger_level)) {
+        thread->wait_flags = (trigger_level != 0U) ? trigger_level : 1U;
+        __atomic_store_n(&sb->read_need, thread->wait_flags, __ATOMIC_SEQ_CST);
+      }
+    }
+    StreamBufferWakeup(sb);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get capacity of a Stream Buffer.
+uint32_t osStreamBufferGetCapacity (osStreamBufferId_t sb_id) {
+  const os_stream_buffer_t *sb = (const os_stream_buffer_t *)sb_id;
+
+  if (!IsStreamBufferValid(sb)) {
+    return 0U;
+  }
+  return sb->size;
+}
+
+/// Get number of bytes stored in a Stream Buffer.
+uint32_t osStreamBufferGetCount (osStreamBufferId_t sb_id) {
+  const os_stream_buffer_t *sb = (const os_stream_buffer_t *)sb_id;
+
+  if (!IsStreamBufferValid(sb)) {
+    return 0U;
+  }
+  return StreamBufferAvailRead(sb);
+}
+
+/// Get number of free bytes in a Stream Buffer.
+uint32_t osStreamBufferGetSpace (osStreamBufferId_t sb_id) {
+  const os_stream_buffer_t *sb = (const os_stream_buffer_t *)sb_id;
+
+  if (!IsStreamBufferValid(sb)) {
+    return 0U;
+  }
+  return StreamBufferAvailWrite(sb);
+}
+
+/// Reset a Stream Buffer to initial empty state.
+osStatus_t osStreamBufferReset (osStreamBufferId_t sb_id) {
+  os_stream_buffer_t *sb = (os_stream_buffer_t *)sb_id;
+  osStatus_t          status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsStreamBufferValid(sb)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(sb)) {
+    status = osErrorSafetyClass;
+  } else {
+    // Discard stored data and release a writer waiting for space
+    __atomic_store_n(&sb->tail, __atomic_load_n(&sb->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    StreamBufferWakeup(sb);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Delete a Stream Buffer object.
+osStatus_t osStreamBufferDelete (osStreamBufferId_t sb_id) {
+  os_stream_buffer_t *sb = (os_stream_buffer_t *)sb_id;
+  osStatus_t          status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsStreamBufferValid(sb)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(sb)) {
+    status = osErrorSafetyClass;
+  } else {
+    StreamBufferDestroy(sb);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
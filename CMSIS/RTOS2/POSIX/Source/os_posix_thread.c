@@ -0,0 +1,1719 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Thread functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#include <time.h>
+
+#include "os_posix_lib.h"
+
+
+//  pendsv values (deterministic mode)
+#define PENDSV_PREEMPT      1U          ///< Switch to a higher priority thread
+#define PENDSV_ROBIN        2U          ///< Switch to a thread with the same priority
+
+
+//  ==== Helper functions ====
+
+/// Validate thread ID.
+static inline bool IsThreadValid (const os_thread_t *thread) {
+  return ((thread != NULL) && (thread->id == osPosixIdThread));
+}
+
+/// Put Thread into a sorted list in front of threads with the same priority.
+static void ThreadListPutFront (os_thread_t **list, os_thread_t *thread) {
+  os_thread_t *prev = NULL;
+  os_thread_t *next = *list;
+
+  while ((next != NULL) && (next->priority > thread->priority)) {
+    prev = next;
+    next = next->thread_next;
+  }
+  thread->thread_prev = prev;
+  thread->thread_next = next;
+  thread->thread_list = list;
+  if (prev != NULL) {
+    prev->thread_next = thread;
+  } else {
+    *list = thread;
+  }
+  if (next != NULL) {
+    next->thread_prev = thread;
+  }
+}
+
+/// Insert Thread into the Delay list.
+static void ThreadDelayInsert (os_thread_t *thread, uint32_t delay) {
+  os_thread_t *prev = NULL;
+  os_thread_t *next = osPosixInfo.thread.delay_list;
+
+  while ((next != NULL) && (next->delay <= delay)) {
+    delay -= next->delay;
+    prev   = next;
+    next   = next->delay_next;
+  }
+  thread->delay      = delay;
+  thread->delay_prev = prev;
+  thread->delay_next = next;
+  if (prev != NULL) {
+    prev->delay_next = thread;
+  } else {
+    osPosixInfo.thread.delay_list = thread;
+  }
+  if (next != NULL) {
+    next->delay -= delay;
+    next->delay_prev = thread;
+  }
+}
+
+/// Remove Thread from the Delay list.
+static void ThreadDelayRemove (os_thread_t *thread) {
+
+  if (thread->delay == osWaitForever) {
+    return;
+  }
+  if (thread->delay_next != NULL) {
+    thread->delay_next->delay     += thread->delay;
+    thread->delay_next->delay_prev = thread->delay_prev;
+  }
+  if (thread->delay_prev != NULL) {
+    thread->delay_prev->delay_next = thread->delay_next;
+  } else {
+    osPosixInfo.thread.delay_list  = thread->delay_next;
+  }
+  thread->delay      = osWaitForever;
+  thread->delay_next = NULL;
+  thread->delay_prev = NULL;
+}
+
+/// Delay the running Thread until the specified system timer count (kernel lock held).
+static osStatus_t ThreadDelaySysTimer (uint32_t count) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  if (!osPosixThreadWaitEnter(osPosixThreadWaitingDelay, osWaitForever)) {
+    return osError;
+  }
+  thread->delay_count = count;
+  osPosixThreadListPut(&osPosixInfo.thread.delay_sys_list, thread);
+  osPosixThreadDelaySysTimer();
+
+  return (osStatus_t)osPosixThreadWaitBlock((uint32_t)osOK);
+}
+
+/// Make Thread the running thread (deterministic mode).
+static void ThreadSwitch (os_thread_t *thread) {
+  const os_thread_t *prev = osPosixInfo.thread.curr;
+
+  osPosixThreadRuntimeUpdate();
+  osPosixTrace(OS_TRACE_THREAD_SWITCH, thread, prev);
+  thread->state      = osPosixThreadRunning;
+  thread->robin_tick = OS_ROBIN_TIMEOUT;
+  osPosixInfo.thread.curr = thread;
+  osPosixInfo.kernel.pendsv = 0U;
+
+  if (((thread->zone & osThreadZone_Valid) != 0U) &&
+      ((prev == NULL) || (prev->zone != thread->zone))) {
+    osZoneSetup_Callback((thread->zone & osThreadZone_Msk) >> osThreadZone_Pos);
+  }
+
+  (void)pthread_cond_signal(&thread->cond);
+}
+
+/// Check if Thread may execute.
+static bool ThreadMayRun (const os_thread_t *thread) {
+  uint8_t state;
+
+  if ((thread->flags & osPosixThreadFlagTerminate) != 0U) {
+    return true;
+  }
+  state = thread->state & osPosixThreadStateMask;
+  if ((state != osPosixThreadReady) && (state != osPosixThreadRunning)) {
+    return false;
+  }
+  if ((osPosixInfo.kernel.state == osPosixKernelInactive) ||
+      (osPosixInfo.kernel.state == osPosixKernelReady)) {
+    return false;
+  }
+  if (osPosixInfo.kernel.mode == osPosixSchedDeterministic) {
+    return (osPosixInfo.thread.curr == thread);
+  }
+  return ((osPosixInfo.kernel.lock_owner == NULL) || (osPosixInfo.kernel.lock_owner == thread));
+}
+
+/// Free Thread Control Block.
+static void ThreadFree (os_thread_t *thread) {
+
+  thread->id = osPosixIdInvalid;
+  (void)pthread_cond_destroy(&thread->cond);
+  if ((thread->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(thread);
+  }
+}
+
+/// Exit the calling host thread (kernel lock held, does not return).
+static void ThreadExitSelf (os_thread_t *thread) __attribute__((noreturn));
+static void ThreadExitSelf (os_thread_t *thread) {
+
+  if ((thread->state & osPosixThreadStateMask) != osPosixThreadTerminated) {
+    osPosixThreadTerminate(thread);
+  }
+
+  thread->flags |= osPosixThreadFlagExited;
+
+  // Return blocks held in Memory Pool Caches
+  osPosixMemoryPoolCacheRelease(thread);
+
+  if ((thread->attr & osThreadJoinable) != 0U) {
+    // Wakeup joining Thread (it releases the control block)
+    if (thread->thread_join != NULL) {
+      osPosixThreadWaitExit(thread->thread_join, (uint32_t)osOK);
+    }
+  } else {
+    ThreadFree(thread);
+  }
+
+  osPosixThreadSelf = NULL;
+  osPosixThreadDispatch();
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  pthread_exit(NULL);
+}
+
+/// Wait until the calling Thread may execute (kernel lock held).
+static void ThreadWaitRun (os_thread_t *thread) {
+
+  while (!ThreadMayRun(thread)) {
+    (void)pthread_cond_wait(&thread->cond, &osPosixInfo.lock);
+  }
+  if ((thread->flags & osPosixThreadFlagTerminate) != 0U) {
+    ThreadExitSelf(thread);
+  }
+}
+
+/// Host thread entry.
+static void *ThreadStart (void *arg) {
+  os_thread_t *thread = (os_thread_t *)arg;
+
+  osPosixThreadSelf = thread;
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+  ThreadWaitRun(thread);
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  thread->func(thread->argument);
+
+  osThreadExit();
+
+  return (NULL);
+}
+
+/// Apply processor affinity to the host thread.
+static void ThreadSetAffinity (os_thread_t *thread) {
+#if defined(__linux__)
+  cpu_set_t cpuset;
+  uint32_t  n;
+
+  if (thread->affinity_mask == 0U) {
+    return;
+  }
+  CPU_ZERO(&cpuset);
+  for (n = 0U; n < 32U; n++) {
+    if ((thread->affinity_mask & (1UL << n)) != 0U) {
+      CPU_SET(n, &cpuset);
+    }
+  }
+  (void)pthread_setaffinity_np(thread->pthread, sizeof(cpuset), &cpuset);
+#else
+  (void)thread;
+#endif
+}
+
+/// Suspend Thread (kernel lock held).
+static osStatus_t ThreadSuspend (os_thread_t *thread) {
+  const os_mutex_t *mutex;
+
+  switch (thread->state & osPosixThreadStateMask) {
+    case osPosixThreadRunning:
+    case osPosixThreadReady:
+      if ((thread == osPosixThreadSelf) && (osPosixInfo.kernel.state != osPosixKernelRunning)) {
+        return osErrorResource;
+      }
+      osPosixThreadListUnlink(thread);
+      if (osPosixInfo.thread.curr == thread) {
+        osPosixThreadRuntimeUpdate();
+        osPosixTrace(OS_TRACE_THREAD_SWITCH, NULL, thread);
+        osPosixInfo.thread.curr = NULL;
+      }
+      break;
+    case osPosixThreadBlocked:
+      if (thread->state == osPosixThreadBlocked) {
+        // Already suspended
+        return osErrorResource;
+      }
+      // Abort the wait: the waiting function returns its timeout result
+      osPosixThreadListUnlink(thread);
+      ThreadDelayRemove(thread);
+      if (thread->state == osPosixThreadWaitingMutex) {
+        mutex = (const os_mutex_t *)thread->wait_info;
+        osPosixMutexOwnerRestore(mutex, thread);
+      } else if (thread->state == osPosixThreadWaitingRwLock) {
+        osPosixRwLockWaitAbort((os_rwlock_t *)thread->wait_info, thread);
+      }
+      break;
+    default:
+      return osErrorResource;
+  }
+
+  thread->state  = osPosixThreadBlocked;
+  thread->flags |= osPosixThreadFlagSuspended;
+
+  return osOK;
+}
+
+/// Resume Thread (kernel lock held).
+static osStatus_t ThreadResume (os_thread_t *thread) {
+
+  if ((thread->state != osPosixThreadBlocked) ||
+      ((thread->flags & osPosixThreadFlagSuspended) == 0U)) {
+    return osErrorResource;
+  }
+  thread->flags &= (uint8_t)~osPosixThreadFlagSuspended;
+  osPosixThreadReadyPut(thread);
+
+  return osOK;
+}
+
+/// Check Thread Flags against the wait condition and clear them.
+static uint32_t ThreadFlagsCheck (os_thread_t *thread, uint32_t flags, uint32_t options) {
+  uint32_t thread_flags = thread->thread_flags;
+
+  if ((options & osFlagsWaitAll) != 0U) {
+    if ((thread_flags & flags) != flags) {
+      return 0U;
+    }
+  } else {
+    if ((thread_flags & flags) == 0U) {
+      return 0U;
+    }
+  }
+  if ((options & osFlagsNoClear) == 0U) {
+    thread->thread_flags = thread_flags & ~flags;
+  }
+  return thread_flags;
+}
+
+
+//  ==== Library functions ====
+
+/// Put Thread into a sorted list (highest priority first, FIFO for equal priority).
+/// \param[in]  list            pointer to list head.
+/// \param[in]  thread          thread object.
+void osPosixThreadListPut (os_thread_t **list, os_thread_t *thread) {
+  os_thread_t *prev = NULL;
+  os_thread_t *next = *list;
+
+  while ((next != NULL) && (next->priority >= thread->priority)) {
+    prev = next;
+    next = next->thread_next;
+  }
+  thread->thread_prev = prev;
+  thread->thread_next = next;
+  thread->thread_list = list;
+  if (prev != NULL) {
+    prev->thread_next = thread;
+  } else {
+    *list = thread;
+  }
+  if (next != NULL) {
+    next->thread_prev = thread;
+  }
+}
+
+/// Get Thread with highest priority from a list.
+/// \param[in]  list            pointer to list head.
+/// \return thread object or NULL.
+os_thread_t *osPosixThreadListGet (os_thread_t **list) {
+  os_thread_t *thread = *list;
+
+  if (thread != NULL) {
+    osPosixThreadListUnlink(thread);
+  }
+  return thread;
+}
+
+/// Unlink Thread from the list it is linked into.
+/// \param[in]  thread          thread object.
+void osPosixThreadListUnlink (os_thread_t *thread) {
+
+  if (thread->thread_list == NULL) {
+    return;
+  }
+  if (thread->thread_next != NULL) {
+    thread->thread_next->thread_prev = thread->thread_prev;
+  }
+  if (thread->thread_prev != NULL) {
+    thread->thread_prev->thread_next = thread->thread_next;
+  } else {
+    *thread->thread_list = thread->thread_next;
+  }
+  thread->thread_list = NULL;
+  thread->thread_next = NULL;
+  thread->thread_prev = NULL;
+}
+
+/// Re-sort Thread in its list after a priority change.
+/// \param[in]  thread          thread object.
+void osPosixThreadListSort (os_thread_t *thread) {
+  os_thread_t **list = thread->thread_list;
+
+  if (list != NULL) {
+    osPosixThreadListUnlink(thread);
+    osPosixThreadListPut(list, thread);
+  }
+}
+
+/// Process Thread Delay list for elapsed ticks.
+/// \param[in]  ticks           number of elapsed ticks.
+void osPosixThreadDelayTick (uint32_t ticks) {
+  os_thread_t *thread;
+  const os_mutex_t *mutex;
+
+  while ((thread = osPosixInfo.thread.delay_list) != NULL) {
+    if (thread->delay > ticks) {
+      thread->delay -= ticks;
+      break;
+    }
+    ticks -= thread->delay;
+    thread->delay = 0U;                 // Expired: nothing to pass on to the next entry
+    ThreadDelayRemove(thread);
+    osPosixThreadListUnlink(thread);
+    if (thread->state == osPosixThreadWaitingMutex) {
+      mutex = (const os_mutex_t *)thread->wait_info;
+      osPosixMutexOwnerRestore(mutex, thread);
+    } else if (thread->state == osPosixThreadWaitingRwLock) {
+      osPosixRwLockWaitAbort((os_rwlock_t *)thread->wait_info, thread);
+    }
+    // Timeout: wait result was preset by osPosixThreadWait
+    osPosixThreadWaitExit(thread, thread->wait_ret);
+  }
+}
+
+/// Process Thread Sub-tick Delay list and program the one-shot OS Tick event for the next wake-up.
+void osPosixThreadDelaySysTimer (void) {
+  os_thread_t *thread;
+  os_thread_t *next;
+  uint32_t     count;
+  uint32_t     delta;
+  uint32_t     delay;
+
+  if (osPosixInfo.thread.delay_sys_list == NULL) {
+    return;
+  }
+
+  count = osPosixKernelSysTimerCount();
+  delay = osWaitForever;
+
+  for (thread = osPosixInfo.thread.delay_sys_list; thread != NULL; thread = next) {
+    next  = thread->thread_next;
+    delta = thread->delay_count - count;
+    if ((delta == 0U) || (delta > 0x7FFFFFFFU)) {
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    } else if (delta < delay) {
+      delay = delta;
+    }
+  }
+
+  // Wake-up beyond the current tick period is handled by a later tick
+  if (delay != osWaitForever) {
+    (void)OS_Tick_SetOneShot(delay);
+  }
+}
+
+/// Get number of ticks until the first wake-up in the Thread Sub-tick Delay list.
+/// \return number of ticks or osWaitForever when the list is empty.
+uint32_t osPosixThreadDelaySysTicks (void) {
+  const os_thread_t *thread;
+  uint32_t           count;
+  uint32_t           delta;
+  uint32_t           delay = osWaitForever;
+
+  if (osPosixInfo.thread.delay_sys_list == NULL) {
+    return osWaitForever;
+  }
+
+  count = osPosixKernelSysTimerCount();
+
+  for (thread = osPosixInfo.thread.delay_sys_list; thread != NULL; thread = thread->thread_next) {
+    delta = thread->delay_count - count;
+    if (delta > 0x7FFFFFFFU) {
+      delta = 0U;
+    }
+    if (delta < delay) {
+      delay = delta;
+    }
+  }
+
+  return (delay / OS_Tick_GetInterval());
+}
+
+/// Put Thread into Ready state.
+/// \param[in]  thread          thread object.
+void osPosixThreadReadyPut (os_thread_t *thread) {
+
+  thread->state = osPosixThreadReady;
+  if (osPosixInfo.kernel.mode == osPosixSchedDeterministic) {
+    osPosixThreadListPut(&osPosixInfo.thread.ready, thread);
+  } else {
+    (void)pthread_cond_signal(&thread->cond);
+  }
+}
+
+/// Dispatch the highest priority ready Thread (deterministic mode).
+void osPosixThreadDispatch (void) {
+  os_thread_t *curr;
+  os_thread_t *next;
+  bool         robin;
+
+  if ((osPosixInfo.kernel.mode  != osPosixSchedDeterministic) ||
+      (osPosixInfo.kernel.state != osPosixKernelRunning)) {
+    return;
+  }
+
+  next = osPosixInfo.thread.ready;
+  if (next == NULL) {
+    osPosixInfo.kernel.pendsv = 0U;
+    return;
+  }
+
+  curr = osPosixInfo.thread.curr;
+  if (curr == NULL) {
+    // Processor idle: start the highest priority ready thread
+    (void)osPosixThreadListGet(&osPosixInfo.thread.ready);
+    ThreadSwitch(next);
+    return;
+  }
+
+  robin = (osPosixInfo.kernel.pendsv == PENDSV_ROBIN) && (next->priority == curr->priority);
+  if ((next->priority <= curr->priority) && !robin) {
+    osPosixInfo.kernel.pendsv = 0U;
+    return;
+  }
+
+  if ((curr != osPosixThreadSelf) || (osPosixIrqNest != 0U)) {
+    // Running thread is executing application code: switch at its next kernel entry
+    if (osPosixInfo.kernel.pendsv == 0U) {
+      osPosixInfo.kernel.pendsv = PENDSV_PREEMPT;
+    }
+    return;
+  }
+
+  // Preempt the calling thread
+  curr->state = osPosixThreadReady;
+  if (robin) {
+    osPosixThreadListPut(&osPosixInfo.thread.ready, curr);
+  } else {
+    ThreadListPutFront(&osPosixInfo.thread.ready, curr);
+  }
+  ThreadSwitch(osPosixThreadListGet(&osPosixInfo.thread.ready));
+
+  ThreadWaitRun(curr);
+}
+
+/// Honor pending thread switches and kernel lock at kernel entry (kernel lock held).
+void osPosixThreadSchedule (void) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  if ((osPosixInfo.kernel.pendsv != 0U) && (osPosixInfo.thread.curr == thread)) {
+    osPosixThreadDispatch();
+  }
+  ThreadWaitRun(thread);
+}
+
+/// Signal all Threads to re-evaluate their run condition.
+void osPosixThreadSignalAll (void) {
+  os_object_t *object;
+
+  for (object = osPosixInfo.object_list; object != NULL; object = object->object_next) {
+    if (object->id == osPosixIdThread) {
+      (void)pthread_cond_signal(&((os_thread_t *)object)->cond);
+    }
+  }
+}
+
+/// Prepare the running Thread for a blocking wait.
+/// \param[in]  state           new thread state.
+/// \param[in]  timeout         timeout value.
+/// \return true - thread may wait, false - waiting not possible (kernel locked or suspended).
+bool osPosixThreadWaitEnter (uint8_t state, uint32_t timeout) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  if ((thread == NULL) || (osPosixInfo.kernel.state != osPosixKernelRunning)) {
+    return false;
+  }
+
+  thread->state = state;
+  if (timeout != osWaitForever) {
+    ThreadDelayInsert(thread, timeout);
+  }
+  osPosixTrace(OS_TRACE_WAIT_ENTER | ((uint32_t)state >> 4), thread, timeout);
+
+  return true;
+}
+
+/// Block the running Thread until released by osPosixThreadWaitExit or timeout.
+/// \param[in]  timeout_ret     result returned on timeout.
+/// \return wait result.
+uint32_t osPosixThreadWaitBlock (uint32_t timeout_ret) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  thread->wait_ret = timeout_ret;
+
+  if (osPosixInfo.thread.curr == thread) {
+    osPosixThreadRuntimeUpdate();
+    osPosixTrace(OS_TRACE_THREAD_SWITCH, NULL, thread);
+    osPosixInfo.thread.curr = NULL;
+    osPosixThreadDispatch();
+  }
+
+  ThreadWaitRun(thread);
+  osPosixTrace(OS_TRACE_WAIT_EXIT, thread, thread->wait_ret);
+
+  return thread->wait_ret;
+}
+
+/// Release a waiting Thread.
+/// \param[in]  thread          thread object.
+/// \param[in]  ret_val         wait result.
+void osPosixThreadWaitExit (os_thread_t *thread, uint32_t ret_val) {
+
+  thread->wait_ret = ret_val;
+  osPosixThreadListUnlink(thread);
+  ThreadDelayRemove(thread);
+  osPosixThreadReadyPut(thread);
+}
+
+/// Update effective Thread priority (base priority and priority inheritance).
+/// \param[in]  thread          thread object.
+void osPosixThreadPriorityUpdate (os_thread_t *thread) {
+  const os_mutex_t  *mutex;
+  const os_rwlock_t *rwlock;
+  int8_t             priority;
+
+  while (thread != NULL) {
+    priority = thread->priority_base;
+    for (mutex = thread->mutex_list; mutex != NULL; mutex = mutex->owner_next) {
+      if (((mutex->mutex_attr & osMutexPrioInherit) != 0U) &&
+           (mutex->thread_list != NULL) && (mutex->thread_list->priority > priority)) {
+        priority = mutex->thread_list->priority;
+      }
+    }
+    for (rwlock = thread->rwlock_list; rwlock != NULL; rwlock = rwlock->owner_next) {
+      if ((rwlock->thread_list != NULL) && (rwlock->thread_list->priority > priority)) {
+        priority = rwlock->thread_list->priority;
+      }
+    }
+    if (priority == thread->priority) {
+      break;
+    }
+    thread->priority = priority;
+    osPosixThreadListSort(thread);
+
+    // Propagate along a chain of mutex and reader-writer lock owners
+    if (thread->state == osPosixThreadWaitingMutex) {
+      mutex = (const os_mutex_t *)thread->wait_info;
+      if ((mutex->mutex_attr & osMutexPrioInherit) == 0U) {
+        break;
+      }
+      thread = mutex->owner_thread;
+    } else if (thread->state == osPosixThreadWaitingRwLock) {
+      rwlock = (const os_rwlock_t *)thread->wait_info;
+      thread = rwlock->owner_thread;
+    } else {
+      break;
+    }
+  }
+}
+
+/// Terminate Thread and release its resources (kernel lock held).
+/// \param[in]  thread          thread object.
+void osPosixThreadTerminate (os_thread_t *thread) {
+  const os_mutex_t *mutex;
+
+  osPosixThreadListUnlink(thread);
+  ThreadDelayRemove(thread);
+  if (thread->state == osPosixThreadWaitingMutex) {
+    mutex = (const os_mutex_t *)thread->wait_info;
+    osPosixMutexOwnerRestore(mutex, thread);
+  } else if (thread->state == osPosixThreadWaitingRwLock) {
+    osPosixRwLockWaitAbort((os_rwlock_t *)thread->wait_info, thread);
+  }
+
+  // Release owned robust mutexes and exclusively owned reader-writer locks
+  osPosixMutexOwnerRelease(thread->mutex_list);
+  osPosixRwLockOwnerRelease(thread->rwlock_list);
+
+  if (thread->wdog_reload != 0U) {
+    thread->wdog_reload = 0U;
+    osPosixInfo.thread.wdog_count--;
+  }
+
+  thread->state = osPosixThreadTerminated;
+  osPosixTrace(OS_TRACE_THREAD_EXIT, thread, 0U);
+  osPosixObjectRemove(thread);
+  osPosixInfo.thread.count--;
+
+  if (osPosixInfo.thread.curr == thread) {
+    osPosixThreadRuntimeUpdate();
+    osPosixTrace(OS_TRACE_THREAD_SWITCH, NULL, thread);
+    osPosixInfo.thread.curr = NULL;
+  }
+
+  if (thread != osPosixThreadSelf) {
+    // Host thread leaves at its next kernel entry
+    thread->flags |= osPosixThreadFlagTerminate;
+    (void)pthread_cond_signal(&thread->cond);
+  }
+}
+
+/// Process Round-Robin for the running Thread (tick handler).
+void osPosixThreadRobinTick (void) {
+#if (OS_ROBIN_ENABLE != 0)
+  os_thread_t *curr = osPosixInfo.thread.curr;
+
+  if ((osPosixInfo.kernel.mode != osPosixSchedDeterministic) || (curr == NULL)) {
+    return;
+  }
+  if (curr->robin_tick != 0U) {
+    curr->robin_tick--;
+  }
+  if ((curr->robin_tick == 0U) && (osPosixInfo.thread.ready != NULL) &&
+      (osPosixInfo.thread.ready->priority == curr->priority)) {
+    osPosixInfo.kernel.pendsv = PENDSV_ROBIN;
+  }
+#endif
+}
+
+/// Process Thread Watchdogs (tick handler).
+/// \param[out] expired         array for retrieving threads with expired watchdog.
+/// \param[in]  max             maximum number of items in array.
+/// \return number of threads with expired watchdog.
+uint32_t osPosixThreadWatchdogTick (os_thread_t **expired, uint32_t max) {
+  os_object_t *object;
+  os_thread_t *thread;
+  uint32_t     n = 0U;
+
+  if (osPosixInfo.thread.wdog_count == 0U) {
+    return 0U;
+  }
+  for (object = osPosixInfo.object_list; object != NULL; object = object->object_next) {
+    if (object->id != osPosixIdThread) {
+      continue;
+    }
+    thread = (os_thread_t *)object;
+    if ((thread->wdog_reload == 0U) || (thread->wdog_tick == 0U)) {
+      continue;
+    }
+    thread->wdog_tick--;
+    if (thread->wdog_tick == 0U) {
+      if (n < max) {
+        expired[n++] = thread;
+      } else {
+        // Report on the next tick
+        thread->wdog_tick = 1U;
+      }
+    }
+  }
+  return n;
+}
+
+/// Apply watchdog reload value returned by the alarm handler.
+/// \param[in]  thread          thread object.
+/// \param[in]  ticks           reload value (0 - stop watchdog).
+void osPosixThreadWatchdogReload (os_thread_t *thread, uint32_t ticks) {
+
+  if (!IsThreadValid(thread) || (thread->wdog_reload == 0U) || (thread->wdog_tick != 0U)) {
+    return;
+  }
+  if (ticks == 0U) {
+    thread->wdog_reload = 0U;
+    osPosixInfo.thread.wdog_count--;
+  } else {
+    thread->wdog_reload = ticks;
+    thread->wdog_tick   = ticks;
+  }
+}
+
+/// Get the runtime counter (nanoseconds).
+uint64_t osPosixThreadRuntimeCount (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+/// Account the execution time since the last thread switch to the running Thread or
+/// to idle (deterministic mode, called before the running thread changes).
+void osPosixThreadRuntimeUpdate (void) {
+  os_thread_t *curr = osPosixInfo.thread.curr;
+  uint64_t     time;
+
+  if ((osPosixInfo.kernel.mode != osPosixSchedDeterministic) ||
+      (osPosixInfo.kernel.state == osPosixKernelInactive) ||
+      (osPosixInfo.kernel.state == osPosixKernelReady)) {
+    return;
+  }
+  time = osPosixThreadRuntimeCount();
+  if (osPosixInfo.thread.runtime_time != 0U) {
+    if (curr != NULL) {
+      curr->runtime += time - osPosixInfo.thread.runtime_time;
+    } else {
+      osPosixInfo.thread.runtime_idle += time - osPosixInfo.thread.runtime_time;
+    }
+  }
+  osPosixInfo.thread.runtime_time = time;
+}
+
+
+//  ==== Public API ====
+
+/// Create a thread and add it to Active Threads.
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+  os_thread_t   *thread;
+  const char    *name;
+  void          *cb_mem;
+  uint32_t       cb_size;
+  uint32_t       stack_size;
+  uint32_t       attr_bits;
+  uint32_t       affinity_mask;
+  osPriority_t   priority;
+  uint8_t        obj_class;
+  pthread_attr_t pattr;
+  size_t         host_stack;
+  int            err;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+
+  if (func == NULL) {
+    return NULL;
+  }
+
+  // Process attributes
+  if (attr != NULL) {
+    name          = attr->name;
+    attr_bits     = attr->attr_bits;
+    cb_mem        = attr->cb_mem;
+    cb_size       = attr->cb_size;
+    stack_size    = attr->stack_size;
+    priority      = attr->priority;
+    affinity_mask = attr->affinity_mask;
+    if (priority == osPriorityNone) {
+      priority = osPriorityNormal;
+    }
+    if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+      return NULL;
+    }
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_thread_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+    if ((attr->stack_mem != NULL) && (stack_size == 0U)) {
+      return NULL;
+    }
+    if (stack_size == 0U) {
+      stack_size = OS_STACK_SIZE;
+    }
+  } else {
+    name          = NULL;
+    attr_bits     = 0U;
+    cb_mem        = NULL;
+    stack_size    = OS_STACK_SIZE;
+    priority      = osPriorityNormal;
+    affinity_mask = 0U;
+  }
+
+  osPosixKernelEnter();
+
+  // Check privileged thread protection
+  if (((osPosixInfo.kernel.protect & osPosixKernelProtectPrivileged) != 0U) &&
+      ((attr_bits & osThreadPrivileged) != 0U)) {
+    osPosixKernelExit();
+    return NULL;
+  }
+
+  // Check safety class (a thread cannot create a thread with a higher class)
+  obj_class = osPosixObjectAttrClass(attr_bits);
+  if ((osPosixThreadSelf != NULL) &&
+      ((obj_class >> osPosixAttrClass_Pos) > osPosixObjectClass(osPosixThreadSelf))) {
+    osPosixKernelExit();
+    return NULL;
+  }
+
+  // Allocate control block
+  if (cb_mem != NULL) {
+    thread = (os_thread_t *)cb_mem;
+    (void)memset(thread, 0, sizeof(os_thread_t));
+  } else {
+    thread = (os_thread_t *)osPosixMemAlloc(sizeof(os_thread_t));
+    if (thread == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    thread->flags = osPosixFlagSystemObject;
+  }
+
+  // Initialize control block
+  thread->id            = osPosixIdThread;
+  thread->state         = osPosixThreadInactive;
+  thread->attr          = (uint8_t)((attr_bits & osThreadJoinable) | obj_class);
+  thread->name          = name;
+  thread->delay         = osWaitForever;
+  thread->priority      = (int8_t)priority;
+  thread->priority_base = (int8_t)priority;
+  thread->stack_size    = stack_size;
+  thread->zone          = attr_bits & (osThreadZone_Msk | osThreadZone_Valid);
+  thread->affinity_mask = affinity_mask;
+  thread->func          = func;
+  thread->argument      = argument;
+  (void)pthread_cond_init(&thread->cond, NULL);
+
+  // Create host thread
+  host_stack = (stack_size > OS_HOST_STACK_MIN) ? stack_size : OS_HOST_STACK_MIN;
+  (void)pthread_attr_init(&pattr);
+  (void)pthread_attr_setstacksize(&pattr, host_stack);
+  (void)pthread_attr_setdetachstate(&pattr, PTHREAD_CREATE_DETACHED);
+  err = pthread_create(&thread->pthread, &pattr, ThreadStart, thread);
+  (void)pthread_attr_destroy(&pattr);
+  if (err != 0) {
+    (void)osPosixErrorNotify(osPosixErrorHostThread, thread);
+    ThreadFree(thread);
+    osPosixKernelExit();
+    return NULL;
+  }
+  ThreadSetAffinity(thread);
+
+  osPosixObjectAdd(thread);
+  osPosixInfo.thread.count++;
+#if (OS_TRACE_ENABLE != 0)
+  OS_Trace_Record(OS_TRACE_THREAD_CREATE, (uint32_t)(uintptr_t)thread, (uint32_t)priority);
+  OS_Trace_ThreadName((uint32_t)(uintptr_t)thread, name);
+#endif
+
+  osPosixThreadReadyPut(thread);
+
+  osPosixKernelExit();
+
+  return thread;
+}
+
+/// Get name of a thread.
+const char *osThreadGetName (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+
+  if (!IsThreadValid(thread)) {
+    return NULL;
+  }
+  return thread->name;
+}
+
+/// Get safety class of a thread.
+uint32_t osThreadGetClass (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+
+  if (!IsThreadValid(thread)) {
+    return osErrorId;
+  }
+  return osPosixObjectClass(thread);
+}
+
+/// Get MPU protected zone of a thread.
+uint32_t osThreadGetZone (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+
+  if (!IsThreadValid(thread) || ((thread->zone & osThreadZone_Valid) == 0U)) {
+    return osErrorId;
+  }
+  return ((thread->zone & osThreadZone_Msk) >> osThreadZone_Pos);
+}
+
+/// Return the thread ID of the current running thread.
+osThreadId_t osThreadGetId (void) {
+
+  if (osPosixThreadSelf != NULL) {
+    return osPosixThreadSelf;
+  }
+  // Interrupt context: the interrupted thread (deterministic mode)
+  return osPosixInfo.thread.curr;
+}
+
+/// Get current thread state of a thread.
+osThreadState_t osThreadGetState (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+  osThreadState_t    state;
+
+  if (osPosixIsIrqMode() || !IsThreadValid(thread)) {
+    return osThreadError;
+  }
+
+  osPosixKernelEnter();
+  if ((thread == osPosixThreadSelf) || (thread == osPosixInfo.thread.curr)) {
+    state = osThreadRunning;
+  } else {
+    state = (osThreadState_t)(thread->state & osPosixThreadStateMask);
+  }
+  osPosixKernelExit();
+
+  return state;
+}
+
+/// Get stack size of a thread.
+uint32_t osThreadGetStackSize (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+
+  if (osPosixIsIrqMode() || !IsThreadValid(thread)) {
+    return 0U;
+  }
+  return thread->stack_size;
+}
+
+/// Get available stack space of a thread (no stack watermark on host).
+uint32_t osThreadGetStackSpace (osThreadId_t thread_id) {
+  (void)thread_id;
+  return 0U;
+}
+
+/// Get the accumulated execution time of a thread.
+uint64_t osThreadGetRuntime (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  uint64_t     runtime;
+#if defined(__linux__)
+  struct timespec ts;
+  clockid_t       clock;
+#endif
+
+  if (!IsThreadValid(thread)) {
+    return 0U;
+  }
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+
+  if (osPosixInfo.kernel.mode == osPosixSchedDeterministic) {
+    if (thread == osPosixInfo.thread.curr) {
+      osPosixThreadRuntimeUpdate();
+    }
+    runtime = thread->runtime;
+  } else {
+    // Concurrent mode: CPU time consumed by the host thread
+    runtime = 0U;
+#if defined(__linux__)
+    if ((pthread_getcpuclockid(thread->pthread, &clock) == 0) &&
+        (clock_gettime(clock, &ts) == 0)) {
+      runtime = ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+    }
+#endif
+  }
+
+  (void)pthread_mutex_unlock(&osPosixInfo.lock);
+
+  return runtime;
+}
+
+/// Change priority of a thread.
+osStatus_t osThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread) || (priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    status = osErrorSafetyClass;
+  } else if ((thread->state & osPosixThreadStateMask) == osPosixThreadTerminated) {
+    status = osErrorResource;
+  } else {
+    thread->priority_base = (int8_t)priority;
+    // Force re-evaluation of inherited priority
+    thread->priority = (int8_t)(priority - 1);
+    osPosixThreadPriorityUpdate(thread);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get current priority of a thread.
+osPriority_t osThreadGetPriority (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+
+  if (osPosixIsIrqMode()) {
+    return osPriorityError;
+  }
+  if (!IsThreadValid(thread) ||
+      ((thread->state & osPosixThreadStateMask) == osPosixThreadTerminated)) {
+    return osPriorityError;
+  }
+  return ((osPriority_t)thread->priority);
+}
+
+/// Pass control to next thread that is in state READY.
+osStatus_t osThreadYield (void) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (thread == NULL) {
+    return osError;
+  }
+
+  if (osPosixInfo.kernel.mode == osPosixSchedConcurrent) {
+    (void)sched_yield();
+    return osOK;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixInfo.kernel.state == osPosixKernelRunning) &&
+      (osPosixInfo.thread.ready != NULL) &&
+      (osPosixInfo.thread.ready->priority >= thread->priority)) {
+    thread->state = osPosixThreadReady;
+    osPosixThreadListPut(&osPosixInfo.thread.ready, thread);
+    ThreadSwitch(osPosixThreadListGet(&osPosixInfo.thread.ready));
+    ThreadWaitRun(thread);
+  }
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Suspend execution of a thread.
+osStatus_t osThreadSuspend (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    status = osErrorSafetyClass;
+  } else {
+    status = ThreadSuspend(thread);
+    if ((status == osOK) && (thread == osPosixThreadSelf)) {
+      // Suspend the calling thread until resumed
+      osPosixThreadDispatch();
+      ThreadWaitRun(thread);
+    }
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Resume execution of a thread.
+osStatus_t osThreadResume (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    status = osErrorSafetyClass;
+  } else {
+    status = ThreadResume(thread);
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Detach a thread (thread storage can be reclaimed when thread terminates).
+osStatus_t osThreadDetach (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    status = osErrorSafetyClass;
+  } else if ((thread->attr & osThreadJoinable) == 0U) {
+    status = osErrorResource;
+  } else {
+    thread->attr &= (uint8_t)~osThreadJoinable;
+    if ((thread->flags & osPosixThreadFlagExited) != 0U) {
+      ThreadFree(thread);
+    }
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Wait for specified thread to terminate.
+osStatus_t osThreadJoin (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if ((thread == osPosixThreadSelf) || ((thread->attr & osThreadJoinable) == 0U) ||
+      (thread->thread_join != NULL)) {
+    status = osErrorResource;
+  } else if ((thread->flags & osPosixThreadFlagExited) != 0U) {
+    ThreadFree(thread);
+    status = osOK;
+  } else if (osPosixThreadWaitEnter(osPosixThreadWaitingJoin, osWaitForever)) {
+    thread->thread_join = osPosixThreadSelf;
+    status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osErrorResource);
+    if (status == osOK) {
+      ThreadFree(thread);
+    } else {
+      thread->thread_join = NULL;
+    }
+  } else {
+    status = osErrorResource;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Terminate execution of current running thread.
+__NO_RETURN void osThreadExit (void) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  if (thread == NULL) {
+    // Not called from an RTOS thread: terminate the host thread only
+    pthread_exit(NULL);
+  }
+
+  (void)pthread_mutex_lock(&osPosixInfo.lock);
+  ThreadExitSelf(thread);
+}
+
+/// Terminate execution of a thread.
+osStatus_t osThreadTerminate (osThreadId_t thread_id) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    status = osErrorSafetyClass;
+  } else if (((thread->state & osPosixThreadStateMask) == osPosixThreadTerminated) ||
+             ((thread->state & osPosixThreadStateMask) == osPosixThreadInactive)) {
+    status = osErrorResource;
+  } else if (thread == osPosixThreadSelf) {
+    ThreadExitSelf(thread);
+  } else {
+    osPosixThreadTerminate(thread);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Feed watchdog of the current running thread.
+osStatus_t osThreadFeedWatchdog (uint32_t ticks) {
+  os_thread_t *thread = osPosixThreadSelf;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (thread == NULL) {
+    return osError;
+  }
+
+  osPosixKernelEnter();
+
+  if (ticks == 0U) {
+    if (thread->wdog_reload != 0U) {
+      osPosixInfo.thread.wdog_count--;
+    }
+    thread->wdog_reload = 0U;
+  } else {
+    if (thread->wdog_reload == 0U) {
+      osPosixInfo.thread.wdog_count++;
+    }
+    thread->wdog_reload = ticks;
+    thread->wdog_tick   = ticks;
+  }
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Protect creation of privileged threads.
+osStatus_t osThreadProtectPrivileged (void) {
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+
+  osPosixKernelEnter();
+  osPosixInfo.kernel.protect |= osPosixKernelProtectPrivileged;
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Suspend execution of threads for specified safety classes.
+osStatus_t osThreadSuspendClass (uint32_t safety_class, uint32_t mode) {
+  os_object_t *object;
+  os_thread_t *thread;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if ((safety_class > 0x0FU) || ((mode & (osSafetyWithSameClass | osSafetyWithLowerClass)) == 0U)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixThreadSelf != NULL) && (osPosixObjectClass(osPosixThreadSelf) < safety_class)) {
+    osPosixKernelExit();
+    return osErrorSafetyClass;
+  }
+
+  for (object = osPosixInfo.object_list; object != NULL; object = object->object_next) {
+    thread = (os_thread_t *)object;
+    if ((object->id == osPosixIdThread) && (thread != osPosixThreadSelf) &&
+        (thread != osPosixInfo.timer.thread) &&
+        osPosixObjectClassMatch(thread, safety_class, mode)) {
+      (void)ThreadSuspend(thread);
+    }
+  }
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Resume execution of threads for specified safety classes.
+osStatus_t osThreadResumeClass (uint32_t safety_class, uint32_t mode) {
+  os_object_t *object;
+  os_thread_t *thread;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if ((safety_class > 0x0FU) || ((mode & (osSafetyWithSameClass | osSafetyWithLowerClass)) == 0U)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixThreadSelf != NULL) && (osPosixObjectClass(osPosixThreadSelf) < safety_class)) {
+    osPosixKernelExit();
+    return osErrorSafetyClass;
+  }
+
+  for (object = osPosixInfo.object_list; object != NULL; object = object->object_next) {
+    thread = (os_thread_t *)object;
+    if ((object->id == osPosixIdThread) && osPosixObjectClassMatch(thread, safety_class, mode)) {
+      (void)ThreadResume(thread);
+    }
+  }
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Terminate execution of threads assigned to a specified MPU protected zone.
+osStatus_t osThreadTerminateZone (uint32_t zone) {
+  os_object_t *object;
+  os_object_t *object_next;
+  os_thread_t *thread;
+
+  if (zone > (osThreadZone_Msk >> osThreadZone_Pos)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if ((osPosixThreadSelf != NULL) && (osPosixIrqNest == 0U) &&
+      (osPosixThreadSelf->zone == (osThreadZone(zone)))) {
+    osPosixKernelExit();
+    return osErrorResource;
+  }
+
+  object = osPosixInfo.object_list;
+  while (object != NULL) {
+    object_next = object->object_next;
+    thread = (os_thread_t *)object;
+    if ((object->id == osPosixIdThread) && (thread->zone == osThreadZone(zone))) {
+      osPosixThreadTerminate(thread);
+    }
+    object = object_next;
+  }
+
+  osPosixKernelExit();
+
+  return osOK;
+}
+
+/// Set processor affinity mask of a thread.
+osStatus_t osThreadSetAffinityMask (osThreadId_t thread_id, uint32_t affinity_mask) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  osStatus_t   status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsThreadValid(thread)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    status = osErrorSafetyClass;
+  } else if ((thread->state & osPosixThreadStateMask) == osPosixThreadTerminated) {
+    status = osErrorResource;
+  } else {
+    thread->affinity_mask = affinity_mask;
+    ThreadSetAffinity(thread);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Get current processor affinity mask of a thread.
+uint32_t osThreadGetAffinityMask (osThreadId_t thread_id) {
+  const os_thread_t *thread = (const os_thread_t *)thread_id;
+
+  if (osPosixIsIrqMode() || !IsThreadValid(thread)) {
+    return 0U;
+  }
+  return thread->affinity_mask;
+}
+
+/// Get number of active threads.
+uint32_t osThreadGetCount (void) {
+
+  if (osPosixIsIrqMode()) {
+    return 0U;
+  }
+  return osPosixInfo.thread.count;
+}
+
+/// Enumerate active threads.
+uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
+  const os_object_t *object;
+  uint32_t           count = 0U;
+
+  if (osPosixIsIrqMode() || (thread_array == NULL) || (array_items == 0U)) {
+    return 0U;
+  }
+
+  osPosixKernelEnter();
+
+  for (object = osPosixInfo.object_list; (object != NULL) && (count < array_items); object = object->object_next) {
+    if (object->id == osPosixIdThread) {
+      thread_array[count++] = (osThreadId_t)object;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return count;
+}
+
+
+//  ==== Thread Flags Functions ====
+
+/// Set the specified Thread Flags of a thread.
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
+  os_thread_t *thread = (os_thread_t *)thread_id;
+  uint32_t     thread_flags;
+  uint32_t     thread_flags0;
+
+  if (!IsThreadValid(thread) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(thread)) {
+    osPosixKernelExit();
+    return osFlagsErrorSafetyClass;
+  }
+  if ((thread->state & osPosixThreadStateMask) == osPosixThreadTerminated) {
+    osPosixKernelExit();
+    return osFlagsErrorResource;
+  }
+
+  thread->thread_flags |= flags;
+  thread_flags = thread->thread_flags;
+
+  // Check if Thread is waiting for Thread Flags
+  if (thread->state == osPosixThreadWaitingThreadFlags) {
+    thread_flags0 = ThreadFlagsCheck(thread, thread->wait_flags, thread->wait_option);
+    if (thread_flags0 != 0U) {
+      if ((thread->wait_option & osFlagsNoClear) == 0U) {
+        thread_flags = thread_flags0 & ~thread->wait_flags;
+      } else {
+        thread_flags = thread_flags0;
+      }
+      osPosixThreadWaitExit(thread, thread_flags0);
+    }
+  }
+
+  osPosixKernelExit();
+
+  return thread_flags;
+}
+
+/// Clear the specified Thread Flags of current running thread.
+uint32_t osThreadFlagsClear (uint32_t flags) {
+  os_thread_t *thread = osPosixThreadSelf;
+  uint32_t     thread_flags;
+
+  if (osPosixIsIrqMode()) {
+    return osFlagsErrorISR;
+  }
+  if (thread == NULL) {
+    return osFlagsErrorUnknown;
+  }
+  if ((flags & osFlagsError) != 0U) {
+    return osFlagsErrorParameter;
+  }
+
+  osPosixKernelEnter();
+  thread_flags = thread->thread_flags;
+  thread->thread_flags &= ~flags;
+  osPosixKernelExit();
+
+  return thread_flags;
+}
+
+/// Get the current Thread Flags of current running thread.
+uint32_t osThreadFlagsGet (void) {
+  const os_thread_t *thread = osPosixThreadSelf;
+
+  if (osPosixIsIrqMode() || (thread == NULL)) {
+    return 0U;
+  }
+  return thread->thread_flags;
+}
+
+/// Wait for one or more Thread Flags of the current running thread to become signaled.
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_thread_t *thread = osPosixThreadSelf;
+  uint32_t     thread_flags;
+
+  if (osPosixIsIrqMode()) {
+    return osFlagsErrorISR;
+  }
+  if (thread == NULL) {
+    return osFlagsErrorUnknown;
+  }
+  if ((flags & osFlagsError) != 0U) {
+    return osFlagsErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  thread_flags = ThreadFlagsCheck(thread, flags, options);
+  if (thread_flags == 0U) {
+    if (timeout != 0U) {
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingThreadFlags, timeout)) {
+        thread->wait_flags  = flags;
+        thread->wait_option = (uint8_t)options;
+        thread_flags = osPosixThreadWaitBlock(osFlagsErrorTimeout);
+      } else {
+        thread_flags = osFlagsErrorTimeout;
+      }
+    } else {
+      thread_flags = osFlagsErrorResource;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return thread_flags;
+}
+
+
+//  ==== Generic Wait Functions ====
+
+/// Wait for Timeout (Time Delay).
+osStatus_t osDelay (uint32_t ticks) {
+  osStatus_t status = osOK;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (ticks == 0U) {
+    return osOK;
+  }
+
+  osPosixKernelEnter();
+
+  if (osPosixThreadWaitEnter(osPosixThreadWaitingDelay, ticks)) {
+    status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osOK);
+  } else {
+    status = osError;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Wait for Timeout in microseconds (sub-tick Delay).
+osStatus_t osDelayUs (uint32_t usec) {
+  osStatus_t status;
+  uint64_t   cycles;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (usec == 0U) {
+    return osOK;
+  }
+
+  cycles = (((uint64_t)usec * OS_Tick_GetClock()) + 999999U) / 1000000U;
+  if (cycles > 0x7FFFFFFFU) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  status = ThreadDelaySysTimer(osPosixKernelSysTimerCount() + (uint32_t)cycles);
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Wait until specified time.
+osStatus_t osDelayUntil (uint32_t ticks) {
+  osStatus_t status;
+  uint32_t   delay;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+
+  osPosixKernelEnter();
+
+  delay = ticks - osPosixInfo.kernel.tick;
+  if ((delay == 0U) || (delay > 0x7FFFFFFFU)) {
+    status = osErrorParameter;
+  } else if (osPosixThreadWaitEnter(osPosixThreadWaitingDelay, delay)) {
+    status = (osStatus_t)osPosixThreadWaitBlock((uint32_t)osOK);
+  } else {
+    status = osError;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Wait until specified system timer count (sub-tick Delay).
+osStatus_t osDelayUntilSysTimer (uint32_t count) {
+  osStatus_t status;
+  uint32_t   delta;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+
+  osPosixKernelEnter();
+
+  delta = count - osPosixKernelSysTimerCount();
+  if ((delta == 0U) || (delta > 0x7FFFFFFFU)) {
+    status = osErrorParameter;
+  } else {
+    status = ThreadDelaySysTimer(count);
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Timer functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  Timer wheel geometry
+#define WHEEL_SLOTS         (1UL << OS_TIMER_WHEEL_BITS)
+#define WHEEL_MASK          (WHEEL_SLOTS - 1U)
+#define WHEEL_SHIFT(level)  ((level) * OS_TIMER_WHEEL_BITS)
+
+#if ((OS_TIMER_WHEEL_BITS * OS_TIMER_WHEEL_LEVELS) > 31)
+#error "Timer wheel range exceeds 31 bits (reduce OS_TIMER_WHEEL_BITS or OS_TIMER_WHEEL_LEVELS)"
+#endif
+
+/// Timer wheel range in ticks (timeouts beyond are re-inserted at the top level)
+#define WHEEL_RANGE         (1UL << WHEEL_SHIFT(OS_TIMER_WHEEL_LEVELS))
+
+/// Get Timer from its list link.
+#define TimerFromLink(l)    ((os_timer_t *)(void *)((uint8_t *)(l) - offsetof(os_timer_t, link)))
+
+
+//  ==== Helper functions ====
+
+/// Validate timer ID.
+static inline bool IsTimerValid (const os_timer_t *timer) {
+  return ((timer != NULL) && (timer->id == osPosixIdTimer));
+}
+
+/// Initialize an empty circular list.
+static inline void ListInit (os_timer_link_t *list) {
+  list->next = list;
+  list->prev = list;
+}
+
+/// Append a link at the end of a circular list.
+static inline void ListAppend (os_timer_link_t *list, os_timer_link_t *link) {
+  link->next       = list;
+  link->prev       = list->prev;
+  list->prev->next = link;
+  list->prev       = link;
+}
+
+/// Move all links of a circular list to the end of another list (O(1)).
+static inline void ListSplice (os_timer_link_t *list, os_timer_link_t *from) {
+
+  if (from->next == from) {
+    return;
+  }
+  from->next->prev = list->prev;
+  list->prev->next = from->next;
+  from->prev->next = list;
+  list->prev       = from->prev;
+  ListInit(from);
+}
+
+/// Unlink Timer from the list it is linked into.
+static inline void TimerUnlink (os_timer_t *timer) {
+  timer->link.next->prev = timer->link.prev;
+  timer->link.prev->next = timer->link.next;
+  timer->link.next = NULL;
+  timer->link.prev = NULL;
+}
+
+/// Wake up the Timer Thread when Timers expired.
+static void TimerThreadWakeup (void) {
+  os_thread_t *thread = osPosixInfo.timer.wait;
+
+  if ((thread != NULL) && (osPosixInfo.timer.expired.next != &osPosixInfo.timer.expired)) {
+    osPosixInfo.timer.wait = NULL;
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+  }
+}
+
+/// Insert Timer into the timer wheel slot of its expiry time (O(1)).
+static void TimerInsert (os_timer_t *timer) {
+  uint32_t delta = timer->expires - osPosixInfo.timer.time;
+  uint32_t level = 0U;
+  uint32_t slot;
+
+  if (delta == 0U) {
+    // Already due: run callback with the other expired Timers
+    ListAppend(&osPosixInfo.timer.expired, &timer->link);
+    TimerThreadWakeup();
+    return;
+  }
+
+  while ((level < (OS_TIMER_WHEEL_LEVELS - 1U)) && (delta >= (1UL << WHEEL_SHIFT(level + 1U)))) {
+    level++;
+  }
+  if (delta >= WHEEL_RANGE) {
+    // Beyond wheel range: park in the top level slot that is cascaded last
+    slot = ((osPosixInfo.timer.time >> WHEEL_SHIFT(level)) - 1U) & WHEEL_MASK;
+  } else {
+    slot = (timer->expires >> WHEEL_SHIFT(level)) & WHEEL_MASK;
+  }
+  ListAppend(&osPosixInfo.timer.wheel[level][slot], &timer->link);
+}
+
+/// Re-insert all Timers of a higher level slot into the lower levels.
+static void TimerCascade (uint32_t level) {
+  os_timer_link_t  list;
+  os_timer_link_t *slot;
+  os_timer_t      *timer;
+
+  slot = &osPosixInfo.timer.wheel[level][(osPosixInfo.timer.time >> WHEEL_SHIFT(level)) & WHEEL_MASK];
+  if (slot->next == slot) {
+    return;
+  }
+  ListInit(&list);
+  ListSplice(&list, slot);
+  while (list.next != &list) {
+    timer = TimerFromLink(list.next);
+    TimerUnlink(timer);
+    TimerInsert(timer);
+  }
+}
+
+/// Advance the timer wheel by one tick.
+static void TimerWheelTick (void) {
+  uint32_t level;
+
+  osPosixInfo.timer.time++;
+
+  // Cascade higher level slots on level boundaries (amortized O(1) per Timer)
+  for (level = 1U; level < OS_TIMER_WHEEL_LEVELS; level++) {
+    if ((osPosixInfo.timer.time & ((1UL << WHEEL_SHIFT(level)) - 1U)) != 0U) {
+      break;
+    }
+    TimerCascade(level);
+  }
+
+  // All Timers of the current slot expire now: move them at once to the expired list
+  ListSplice(&osPosixInfo.timer.expired, &osPosixInfo.timer.wheel[0][osPosixInfo.timer.time & WHEEL_MASK]);
+}
+
+/// Timer Thread: executes the callbacks of expired timers.
+static void TimerThread (void *argument) {
+  os_timer_t   *timer;
+  osTimerFunc_t func;
+  void         *arg;
+  uint32_t      late;
+  (void)argument;
+
+  osPosixKernelEnter();
+
+  for (;;) {
+    if (osPosixInfo.timer.expired.next == &osPosixInfo.timer.expired) {
+      // Wait for expired Timers
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingTimer, osWaitForever)) {
+        osPosixInfo.timer.wait = osPosixThreadSelf;
+        (void)osPosixThreadWaitBlock((uint32_t)osOK);
+      } else {
+        // Kernel locked or suspended: retry on the next kernel entry
+        osPosixKernelExit();
+        osPosixKernelEnter();
+      }
+      continue;
+    }
+
+    timer = TimerFromLink(osPosixInfo.timer.expired.next);
+    TimerUnlink(timer);
+    if (timer->type == osPosixTimerPeriodic) {
+      // Reload relative to the expiry time (no drift when callbacks are late)
+      late = osPosixInfo.timer.time - timer->expires;
+      timer->expires += timer->load;
+      if (late >= timer->load) {
+        ListAppend(&osPosixInfo.timer.expired, &timer->link);
+      } else {
+        TimerInsert(timer);
+      }
+    } else {
+      timer->state = osPosixTimerStopped;
+      osPosixInfo.timer.count--;
+    }
+    func = timer->func;
+    arg  = timer->arg;
+
+    if ((timer->flags & osPosixTimerFlagLocked) != 0U) {
+      // Kernel internal Timer: callback only updates kernel objects
+      func(arg);
+      continue;
+    }
+
+    osPosixKernelExit();
+    func(arg);
+    osPosixKernelEnter();
+  }
+}
+
+/// Destroy a Timer object (kernel lock held).
+static void TimerDestroy (os_timer_t *timer) {
+
+  if (timer->state == osPosixTimerRunning) {
+    TimerUnlink(timer);
+    osPosixInfo.timer.count--;
+  }
+  timer->state = osPosixTimerInactive;
+  timer->id    = osPosixIdInvalid;
+  osPosixObjectRemove(timer);
+
+  if ((timer->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(timer);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Initialize the timer wheel (osKernelInitialize).
+void osPosixTimerInit (void) {
+  uint32_t level;
+  uint32_t slot;
+
+  for (level = 0U; level < OS_TIMER_WHEEL_LEVELS; level++) {
+    for (slot = 0U; slot < WHEEL_SLOTS; slot++) {
+      ListInit(&osPosixInfo.timer.wheel[level][slot]);
+    }
+  }
+  ListInit(&osPosixInfo.timer.expired);
+}
+
+/// Process Timers for elapsed ticks (tick handler).
+/// \param[in]  ticks           number of elapsed ticks.
+void osPosixTimerTick (uint32_t ticks) {
+
+  if (osPosixInfo.timer.count == 0U) {
+    osPosixInfo.timer.time += ticks;
+    return;
+  }
+  while (ticks != 0U) {
+    TimerWheelTick();
+    ticks--;
+  }
+  TimerThreadWakeup();
+}
+
+/// Get ticks until the next Timer expires (lower bound for Timers in higher levels).
+/// \return number of ticks or osWaitForever when no Timer is active.
+uint32_t osPosixTimerNextTick (void) {
+  const os_timer_link_t *slot;
+  uint32_t time = osPosixInfo.timer.time;
+  uint32_t next = osWaitForever;
+  uint32_t delta;
+  uint32_t level;
+  uint32_t n;
+
+  if (osPosixInfo.timer.count == 0U) {
+    return osWaitForever;
+  }
+  if (osPosixInfo.timer.expired.next != &osPosixInfo.timer.expired) {
+    return 0U;
+  }
+
+  for (level = 0U; level < OS_TIMER_WHEEL_LEVELS; level++) {
+    for (n = 1U; n <= WHEEL_SLOTS; n++) {
+      slot = &osPosixInfo.timer.wheel[level][((time >> WHEEL_SHIFT(level)) + n) & WHEEL_MASK];
+      if (slot->next != slot) {
+        // Ticks until the slot is processed (level 0) or cascaded (higher levels)
+        delta = ((((time >> WHEEL_SHIFT(level)) + n) << WHEEL_SHIFT(level))) - time;
+        if (delta < next) {
+          next = delta;
+        }
+        break;
+      }
+    }
+  }
+
+  return next;
+}
+
+/// Create Timer Thread (called by osKernelStart).
+/// \return status code that indicates the execution status of the function.
+osStatus_t osPosixTimerSetup (void) {
+  osThreadAttr_t attr;
+
+  if (osPosixInfo.timer.thread != NULL) {
+    return osOK;
+  }
+
+  (void)memset(&attr, 0, sizeof(attr));
+  attr.name     = "osPosixTimerThread";
+  attr.priority = (osPriority_t)OS_TIMER_THREAD_PRIO;
+  osPosixInfo.timer.thread = (os_thread_t *)osThreadNew(TimerThread, NULL, &attr);
+  if (osPosixInfo.timer.thread == NULL) {
+    return osError;
+  }
+
+  return osOK;
+}
+
+/// Destroy a Timer object (osKernelDestroyClass).
+/// \param[in]  timer           timer object.
+void osPosixTimerDestroy (os_timer_t *timer) {
+  TimerDestroy(timer);
+}
+
+/// Start or restart a Timer (kernel lock held).
+/// \param[in]  timer           timer object.
+/// \param[in]  ticks           timer load value.
+void osPosixTimerStartInternal (os_timer_t *timer, uint32_t ticks) {
+
+  if (timer->state == osPosixTimerRunning) {
+    TimerUnlink(timer);
+  } else {
+    timer->state = osPosixTimerRunning;
+    osPosixInfo.timer.count++;
+  }
+  timer->load    = ticks;
+  timer->expires = osPosixInfo.timer.time + ticks;
+  TimerInsert(timer);
+}
+
+/// Stop a running Timer (kernel lock held).
+/// \param[in]  timer           timer object.
+void osPosixTimerStopInternal (os_timer_t *timer) {
+
+  timer->state = osPosixTimerStopped;
+  TimerUnlink(timer);
+  osPosixInfo.timer.count--;
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a timer.
+osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument, const osTimerAttr_t *attr) {
+  os_timer_t *timer;
+  const char *name;
+  void       *cb_mem;
+  uint32_t    cb_size;
+  uint32_t    attr_bits;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+  if ((func == NULL) || ((type != osTimerOnce) && (type != osTimerPeriodic))) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_timer_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    timer = (os_timer_t *)cb_mem;
+    (void)memset(timer, 0, sizeof(os_timer_t));
+  } else {
+    timer = (os_timer_t *)osPosixMemAlloc(sizeof(os_timer_t));
+    if (timer == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    timer->flags = osPosixFlagSystemObject;
+  }
+
+  timer->id    = osPosixIdTimer;
+  timer->state = osPosixTimerStopped;
+  timer->attr  = osPosixObjectAttrClass(attr_bits);
+  timer->name  = name;
+  timer->type  = (uint8_t)type;
+  timer->func  = func;
+  timer->arg   = argument;
+  osPosixObjectAdd(timer);
+
+  osPosixKernelExit();
+
+  return timer;
+}
+
+/// Get name of a timer.
+const char *osTimerGetName (osTimerId_t timer_id) {
+  const os_timer_t *timer = (const os_timer_t *)timer_id;
+
+  if (osPosixIsIrqMode() || !IsTimerValid(timer)) {
+    return NULL;
+  }
+  return timer->name;
+}
+
+/// Start or restart a timer.
+osStatus_t osTimerStart (osTimerId_t timer_id, uint32_t ticks) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+  osStatus_t  status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsTimerValid(timer) || (ticks == 0U)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(timer)) {
+    status = osErrorSafetyClass;
+  } else {
+    osPosixTimerStartInternal(timer, ticks);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Stop a timer.
+osStatus_t osTimerStop (osTimerId_t timer_id) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+  osStatus_t  status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsTimerValid(timer)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(timer)) {
+    status = osErrorSafetyClass;
+  } else if (timer->state != osPosixTimerRunning) {
+    status = osErrorResource;
+  } else {
+    osPosixTimerStopInternal(timer);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Check if a timer is running.
+uint32_t osTimerIsRunning (osTimerId_t timer_id) {
+  const os_timer_t *timer = (const os_timer_t *)timer_id;
+
+  if (osPosixIsIrqMode() || !IsTimerValid(timer)) {
+    return 0U;
+  }
+  return ((timer->state == osPosixTimerRunning) ? 1U : 0U);
+}
+
+/// Delete a timer.
+osStatus_t osTimerDelete (osTimerId_t timer_id) {
+  os_timer_t *timer = (os_timer_t *)timer_id;
+  osStatus_t  status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsTimerValid(timer)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(timer)) {
+    status = osErrorSafetyClass;
+  } else {
+    TimerDestroy(timer);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
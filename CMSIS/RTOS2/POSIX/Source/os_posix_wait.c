@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Multiple Object Wait functions
+ *
+ * Threads that wait for multiple objects are linked into a kernel list.
+ * Objects report state changes that make them ready (osPosixWaitNotify) and
+ * deletion (osPosixWaitDestroy); only threads that reference the object are
+ * re-evaluated.
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+#define WAIT_ANY            0x00U       ///< Wait until any object is ready
+#define WAIT_ALL            0x01U       ///< Wait until all objects are ready
+
+
+//  ==== Helper functions ====
+
+/// Validate object ID for a multiple object wait.
+static inline bool IsWaitObjectValid (const os_object_t *object) {
+
+  if (object == NULL) {
+    return false;
+  }
+  switch (object->id) {
+    case osPosixIdEventFlags:
+    case osPosixIdMutex:
+    case osPosixIdSemaphore:
+    case osPosixIdMemoryPool:
+    case osPosixIdMessageQueue:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Check if an object is ready (a wait function with timeout 0 would succeed).
+static bool WaitObjectReady (const os_object_t *object, const os_thread_t *thread) {
+  const os_mutex_t *mutex;
+  bool              ready;
+
+  switch (object->id) {
+    case osPosixIdEventFlags:
+      ready = (((const os_event_flags_t *)object)->event_flags != 0U);
+      break;
+    case osPosixIdMutex:
+      mutex = (const os_mutex_t *)object;
+      ready = (mutex->lock == 0U) ||
+              ((mutex->owner_thread == thread) && ((mutex->mutex_attr & osMutexRecursive) != 0U) &&
+               (mutex->lock != 0xFFFFU));
+      break;
+    case osPosixIdSemaphore:
+      ready = (((const os_semaphore_t *)object)->tokens != 0U);
+      break;
+    case osPosixIdMemoryPool:
+      ready = (((const os_memory_pool_t *)object)->mp_info.block_free != NULL);
+      break;
+    case osPosixIdMessageQueue:
+      ready = (((const os_message_queue_t *)object)->msg_count != 0U);
+      break;
+    default:
+      ready = false;
+      break;
+  }
+  return ready;
+}
+
+/// Check the wait condition.
+/// \return index of the ready object (0 for all), -1 when the condition is not met.
+static int32_t WaitCheck (void * const *object_ids, uint32_t count, uint8_t mode, const os_thread_t *thread) {
+  uint32_t n;
+
+  for (n = 0U; n < count; n++) {
+    if (WaitObjectReady((const os_object_t *)object_ids[n], thread)) {
+      if (mode == WAIT_ANY) {
+        return ((int32_t)n);
+      }
+    } else if (mode == WAIT_ALL) {
+      return (-1);
+    }
+  }
+  return ((mode == WAIT_ALL) ? 0 : -1);
+}
+
+/// Check if a waiting Thread references an object.
+static bool WaitReferences (const os_thread_t *thread, const void *object) {
+  void * const *object_ids = (void * const *)thread->wait_info;
+  uint32_t      n;
+
+  for (n = 0U; n < thread->wait_flags; n++) {
+    if (object_ids[n] == object) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Wait for multiple objects.
+static int32_t WaitMultiple (void * const *object_ids, uint32_t count, uint8_t mode, uint32_t timeout) {
+  os_thread_t *thread;
+  int32_t      ret;
+  uint32_t     n;
+
+  if (osPosixIsIrqMode() && (timeout != 0U)) {
+    return ((int32_t)osErrorParameter);
+  }
+  if ((object_ids == NULL) || (count == 0U)) {
+    return ((int32_t)osErrorParameter);
+  }
+
+  osPosixKernelEnter();
+
+  thread = osPosixThreadSelf;
+
+  for (n = 0U; n < count; n++) {
+    if (!IsWaitObjectValid((const os_object_t *)object_ids[n])) {
+      osPosixKernelExit();
+      return ((int32_t)osErrorParameter);
+    }
+    if (!osPosixClassAllowed(object_ids[n])) {
+      osPosixKernelExit();
+      return ((int32_t)osErrorSafetyClass);
+    }
+  }
+
+  // Return cached Memory Pool blocks; while the Thread waits, freed blocks bypass the Caches
+  for (n = 0U; n < count; n++) {
+    if (((const os_object_t *)object_ids[n])->id == osPosixIdMemoryPool) {
+      osPosixMemoryPoolWaitPrepare((os_memory_pool_t *)object_ids[n], (timeout != 0U));
+    }
+  }
+
+  ret = WaitCheck(object_ids, count, mode, thread);
+  if (ret < 0) {
+    if (timeout == 0U) {
+      ret = (int32_t)osErrorResource;
+    } else if (osPosixThreadWaitEnter(osPosixThreadWaitingMultiple, timeout)) {
+      thread->wait_info   = (void *)(uintptr_t)object_ids;
+      thread->wait_flags  = count;
+      thread->wait_option = mode;
+      osPosixThreadListPut(&osPosixInfo.thread.wait_list, thread);
+      ret = (int32_t)osPosixThreadWaitBlock((uint32_t)osErrorTimeout);
+    } else {
+      ret = (int32_t)osErrorTimeout;
+    }
+  }
+
+  osPosixKernelExit();
+
+  return ret;
+}
+
+
+//  ==== Library functions ====
+
+/// Release Threads waiting for multiple objects after an object became ready (kernel lock held).
+/// \param[in]  object          object control block.
+void osPosixWaitNotify (const void *object) {
+  os_thread_t *thread;
+  os_thread_t *thread_next;
+  int32_t      ret;
+
+  thread = osPosixInfo.thread.wait_list;
+  while (thread != NULL) {
+    thread_next = thread->thread_next;
+    if (WaitReferences(thread, object)) {
+      ret = WaitCheck((void * const *)thread->wait_info, thread->wait_flags, thread->wait_option, thread);
+      if (ret >= 0) {
+        osPosixThreadWaitExit(thread, (uint32_t)ret);
+      }
+    }
+    thread = thread_next;
+  }
+}
+
+/// Check if Threads wait for multiple objects that include an object (kernel lock held).
+/// \param[in]  object          object control block.
+/// \return true when a waiting Thread references the object.
+bool osPosixWaitPending (const void *object) {
+  const os_thread_t *thread;
+
+  for (thread = osPosixInfo.thread.wait_list; thread != NULL; thread = thread->thread_next) {
+    if (WaitReferences(thread, object)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Release Threads waiting for multiple objects when an object is deleted (kernel lock held).
+/// \param[in]  object          object control block.
+void osPosixWaitDestroy (const void *object) {
+  os_thread_t *thread;
+  os_thread_t *thread_next;
+
+  thread = osPosixInfo.thread.wait_list;
+  while (thread != NULL) {
+    thread_next = thread->thread_next;
+    if (WaitReferences(thread, object)) {
+      osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+    }
+    thread = thread_next;
+  }
+}
+
+
+//  ==== Public API ====
+
+/// Wait until any of the specified objects is ready.
+int32_t osWaitAny (void * const *object_ids, uint32_t count, uint32_t timeout) {
+  return WaitMultiple(object_ids, count, WAIT_ANY, timeout);
+}
+
+/// Wait until all of the specified objects are ready.
+osStatus_t osWaitAll (void * const *object_ids, uint32_t count, uint32_t timeout) {
+  return ((osStatus_t)WaitMultiple(object_ids, count, WAIT_ALL, timeout));
+}
@@ -0,0 +1,683 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Work Queue functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "os_posix_lib.h"
+
+
+//  ==== Helper functions ====
+
+/// Validate work queue ID.
+static inline bool IsWorkQueueValid (const os_work_queue_t *wq) {
+  return ((wq != NULL) && (wq->id == osPosixIdWorkQueue));
+}
+
+/// Validate work ID.
+static inline bool IsWorkValid (const os_work_t *work) {
+  return ((work != NULL) && (work->id == osPosixIdWork));
+}
+
+static void WorkerThread (void *argument);
+
+/// Check if the running Thread is a worker of the Work Queue.
+static bool IsWorkerSelf (const os_work_queue_t *wq) {
+  const os_thread_t *thread = osPosixThreadSelf;
+
+  return ((thread != NULL) && (thread->func == WorkerThread) && (thread->argument == wq));
+}
+
+/// Wake up an idle worker when Works are queued (at most one wakeup pending).
+static void WorkQueueWakeup (os_work_queue_t *wq) {
+  os_thread_t *thread;
+
+  if ((wq->count != 0U) && (wq->wake == 0U) && (wq->thread_list != NULL)) {
+    thread = osPosixThreadListGet(&wq->thread_list);
+    wq->wake = 1U;
+    osPosixThreadWaitExit(thread, (uint32_t)osOK);
+  }
+}
+
+/// Put Work at the end of a priority lane (O(1)).
+static void WorkEnqueue (os_work_queue_t *wq, os_work_t *work, uint32_t lane) {
+
+  work->next = NULL;
+  work->prev = wq->last[lane];
+  if (work->prev != NULL) {
+    work->prev->next = work;
+  } else {
+    wq->first[lane] = work;
+  }
+  wq->last[lane]  = work;
+  wq->lane_mask  |= (1UL << lane);
+  wq->count++;
+
+  work->state = osPosixWorkQueued;
+  work->wq    = wq;
+  work->lane  = (uint8_t)lane;
+
+  WorkQueueWakeup(wq);
+}
+
+/// Get the first Work of the highest non-empty priority lane (O(1)).
+static os_work_t *WorkDequeue (os_work_queue_t *wq) {
+  os_work_t *work;
+  uint32_t   lane;
+
+  if (wq->lane_mask == 0U) {
+    return NULL;
+  }
+  lane = 31U - (uint32_t)__builtin_clz(wq->lane_mask);
+
+  work = wq->first[lane];
+  wq->first[lane] = work->next;
+  if (work->next != NULL) {
+    work->next->prev = NULL;
+  } else {
+    wq->last[lane]  = NULL;
+    wq->lane_mask  &= ~(1UL << lane);
+  }
+  wq->count--;
+
+  work->state = osPosixWorkIdle;
+  work->wq    = NULL;
+  work->next  = NULL;
+
+  return work;
+}
+
+/// Put Work into the delayed list of the Work Queue and start its Timer.
+static void WorkDelay (os_work_queue_t *wq, os_work_t *work, uint32_t lane, uint32_t ticks) {
+
+  work->prev = NULL;
+  work->next = wq->delayed;
+  if (work->next != NULL) {
+    work->next->prev = work;
+  }
+  wq->delayed = work;
+
+  work->state = osPosixWorkDelayed;
+  work->wq    = wq;
+  work->lane  = (uint8_t)lane;
+
+  osPosixTimerStartInternal(&work->timer, ticks);
+}
+
+/// Remove a pending Work from its lane or from the delayed list (O(1)).
+static void WorkRemove (os_work_t *work) {
+  os_work_queue_t *wq = work->wq;
+  uint32_t         lane = work->lane;
+
+  if (work->prev != NULL) {
+    work->prev->next = work->next;
+  } else if (work->state == osPosixWorkQueued) {
+    wq->first[lane] = work->next;
+  } else {
+    wq->delayed = work->next;
+  }
+  if (work->next != NULL) {
+    work->next->prev = work->prev;
+  } else if (work->state == osPosixWorkQueued) {
+    wq->last[lane] = work->prev;
+  } else {
+    // Delayed list has no tail pointer
+  }
+
+  if (work->state == osPosixWorkQueued) {
+    if (wq->first[lane] == NULL) {
+      wq->lane_mask &= ~(1UL << lane);
+    }
+    wq->count--;
+  } else if (work->timer.state == osPosixTimerRunning) {
+    osPosixTimerStopInternal(&work->timer);
+  } else {
+    // Delay Timer already expired
+  }
+
+  work->state = osPosixWorkIdle;
+  work->wq    = NULL;
+  work->next  = NULL;
+  work->prev  = NULL;
+}
+
+/// Delay Timer callback: move Work into its lane (Timer Thread, kernel lock held).
+static void WorkTimerExpired (void *argument) {
+  os_work_t       *work = (os_work_t *)argument;
+  os_work_queue_t *wq;
+  uint32_t         lane;
+
+  if (work->state == osPosixWorkDelayed) {
+    wq   = work->wq;
+    lane = work->lane;
+    WorkRemove(work);
+    WorkEnqueue(wq, work, lane);
+  }
+}
+
+/// Remove all pending Works from a Work Queue.
+static void WorkQueueFlush (os_work_queue_t *wq) {
+  uint32_t lane;
+
+  for (lane = 0U; lane < wq->lanes; lane++) {
+    while (wq->first[lane] != NULL) {
+      WorkRemove(wq->first[lane]);
+    }
+  }
+  while (wq->delayed != NULL) {
+    WorkRemove(wq->delayed);
+  }
+}
+
+/// Terminate all worker Threads of a Work Queue (they leave at their next kernel entry).
+static void WorkQueueTerminate (const os_work_queue_t *wq) {
+  os_object_t *object;
+  os_object_t *object_next;
+
+  object = osPosixInfo.object_list;
+  while (object != NULL) {
+    object_next = object->object_next;
+    if ((object->id == osPosixIdThread) &&
+        (((os_thread_t *)object)->func     == WorkerThread) &&
+        (((os_thread_t *)object)->argument == wq)) {
+      osPosixThreadTerminate((os_thread_t *)object);
+    }
+    object = object_next;
+  }
+}
+
+/// Release a Work Queue Control Block.
+static void WorkQueueFree (os_work_queue_t *wq) {
+
+  wq->state = osPosixWorkQueueInactive;
+  if ((wq->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(wq);
+  }
+}
+
+/// Worker Thread: executes queued Works, highest lane first.
+static void WorkerThread (void *argument) {
+  os_work_queue_t *wq = (os_work_queue_t *)argument;
+  os_work_t       *work;
+  os_thread_t     *thread;
+  osWorkFunc_t     func;
+  void            *arg;
+
+  osPosixKernelEnter();
+
+  while (wq->state == osPosixWorkQueueActive) {
+    work = WorkDequeue(wq);
+    if (work == NULL) {
+      // All Works of this activation done: wait for the next one
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingWork, osWaitForever)) {
+        osPosixThreadSelf->wait_info = wq;
+        osPosixThreadListPut(&wq->thread_list, osPosixThreadSelf);
+        if (osPosixThreadWaitBlock((uint32_t)osOK) == (uint32_t)osOK) {
+          wq->wake = 0U;
+        }
+      } else {
+        // Kernel locked or suspended: retry on the next kernel entry
+        osPosixKernelExit();
+        osPosixKernelEnter();
+      }
+      continue;
+    }
+
+    // More Works queued: let an idle worker of the pool share them
+    WorkQueueWakeup(wq);
+
+    func = work->func;
+    arg  = work->arg;
+
+    osPosixKernelExit();
+    func(arg);
+    osPosixKernelEnter();
+  }
+
+  // Work Queue deleted: the last worker releases the deleting Thread
+  wq->workers--;
+  if (wq->workers == 0U) {
+    thread = osPosixThreadListGet(&wq->thread_list);
+    if (thread != NULL) {
+      osPosixThreadWaitExit(thread, (uint32_t)osOK);
+    }
+  }
+
+  osPosixKernelExit();
+}
+
+/// Destroy a Work object (kernel lock held).
+static void WorkDestroy (os_work_t *work) {
+
+  if (work->state != osPosixWorkIdle) {
+    WorkRemove(work);
+  }
+  work->id = osPosixIdInvalid;
+  osPosixObjectRemove(work);
+
+  if ((work->flags & osPosixFlagSystemObject) != 0U) {
+    osPosixMemFree(work);
+  }
+}
+
+
+//  ==== Library functions ====
+
+/// Destroy a Work Queue object (osKernelDestroyClass).
+/// \param[in]  wq              work queue object.
+void osPosixWorkQueueDestroy (os_work_queue_t *wq) {
+
+  WorkQueueFlush(wq);
+  WorkQueueTerminate(wq);
+
+  wq->id = osPosixIdInvalid;
+  osPosixObjectRemove(wq);
+  WorkQueueFree(wq);
+}
+
+/// Destroy a Work object (osKernelDestroyClass).
+/// \param[in]  work            work object.
+void osPosixWorkDestroy (os_work_t *work) {
+  WorkDestroy(work);
+}
+
+
+//  ==== Public API ====
+
+/// Create and Initialize a Work Queue object with its worker threads.
+osWorkQueueId_t osWorkQueueNew (const osWorkQueueAttr_t *attr) {
+  os_work_queue_t *wq;
+  osThreadAttr_t   thread_attr;
+  const char      *name;
+  void            *cb_mem;
+  uint32_t         cb_size;
+  uint32_t         attr_bits;
+  uint32_t         workers;
+  uint32_t         lanes;
+  uint32_t         n;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+
+  (void)memset(&thread_attr, 0, sizeof(thread_attr));
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    workers   = (attr->workers != 0U) ? attr->workers : 1U;
+    lanes     = (attr->lanes   != 0U) ? attr->lanes   : 1U;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_work_queue_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+    thread_attr.stack_size = attr->stack_size;
+    thread_attr.priority   = attr->priority;
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+    workers   = 1U;
+    lanes     = 1U;
+  }
+  if (lanes > osPosixWorkQueueLanesMax) {
+    return NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    wq = (os_work_queue_t *)cb_mem;
+    (void)memset(wq, 0, sizeof(os_work_queue_t));
+  } else {
+    wq = (os_work_queue_t *)osPosixMemAlloc(sizeof(os_work_queue_t));
+    if (wq == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    wq->flags = osPosixFlagSystemObject;
+  }
+
+  wq->id    = osPosixIdWorkQueue;
+  wq->state = osPosixWorkQueueActive;
+  wq->attr  = osPosixObjectAttrClass(attr_bits);
+  wq->name  = name;
+  wq->lanes = lanes;
+  osPosixObjectAdd(wq);
+
+  osPosixKernelExit();
+
+  // Worker threads inherit name and safety class of the Work Queue
+  thread_attr.name      = name;
+  thread_attr.attr_bits = ((uint32_t)osPosixObjectClass(wq) << osSafetyClass_Pos) | osSafetyClass_Valid;
+  for (n = 0U; n < workers; n++) {
+    if (osThreadNew(WorkerThread, wq, &thread_attr) == NULL) {
+      break;
+    }
+    osPosixKernelEnter();
+    wq->workers++;
+    osPosixKernelExit();
+  }
+  if (n < workers) {
+    (void)osWorkQueueDelete(wq);
+    return NULL;
+  }
+
+  return wq;
+}
+
+/// Get name of a Work Queue object.
+const char *osWorkQueueGetName (osWorkQueueId_t wq_id) {
+  const os_work_queue_t *wq = (const os_work_queue_t *)wq_id;
+
+  if (!IsWorkQueueValid(wq)) {
+    return NULL;
+  }
+  return wq->name;
+}
+
+/// Get number of work items queued in a Work Queue.
+uint32_t osWorkQueueGetCount (osWorkQueueId_t wq_id) {
+  const os_work_queue_t *wq = (const os_work_queue_t *)wq_id;
+
+  if (!IsWorkQueueValid(wq)) {
+    return 0U;
+  }
+  return wq->count;
+}
+
+/// Delete a Work Queue object.
+osStatus_t osWorkQueueDelete (osWorkQueueId_t wq_id) {
+  os_work_queue_t *wq = (os_work_queue_t *)wq_id;
+  os_thread_t     *thread;
+  osStatus_t       status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsWorkQueueValid(wq)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(wq)) {
+    status = osErrorSafetyClass;
+  } else if (IsWorkerSelf(wq)) {
+    // Worker cannot wait for itself
+    status = osErrorResource;
+  } else if ((osPosixInfo.kernel.state == osPosixKernelInactive) ||
+             (osPosixInfo.kernel.state == osPosixKernelReady)) {
+    // Workers did not run yet
+    WorkQueueFlush(wq);
+    WorkQueueTerminate(wq);
+    wq->id = osPosixIdInvalid;
+    osPosixObjectRemove(wq);
+    WorkQueueFree(wq);
+    status = osOK;
+  } else if (osPosixInfo.kernel.state != osPosixKernelRunning) {
+    status = osErrorResource;
+  } else {
+    WorkQueueFlush(wq);
+    wq->id    = osPosixIdInvalid;
+    wq->state = osPosixWorkQueueDeleting;
+    osPosixObjectRemove(wq);
+
+    // Release idle workers; busy workers leave after their current Work
+    while ((thread = osPosixThreadListGet(&wq->thread_list)) != NULL) {
+      osPosixThreadWaitExit(thread, (uint32_t)osErrorResource);
+    }
+    if (wq->workers != 0U) {
+      if (osPosixThreadWaitEnter(osPosixThreadWaitingWork, osWaitForever)) {
+        osPosixThreadSelf->wait_info = wq;
+        osPosixThreadListPut(&wq->thread_list, osPosixThreadSelf);
+        (void)osPosixThreadWaitBlock((uint32_t)osOK);
+      }
+    }
+    WorkQueueFree(wq);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Create and Initialize a work item.
+osWorkId_t osWorkNew (osWorkFunc_t func, void *argument, const osWorkAttr_t *attr) {
+  os_work_t  *work;
+  const char *name;
+  void       *cb_mem;
+  uint32_t    cb_size;
+  uint32_t    attr_bits;
+
+  if (osPosixIsIrqMode()) {
+    return NULL;
+  }
+  if (func == NULL) {
+    return NULL;
+  }
+
+  if (attr != NULL) {
+    name      = attr->name;
+    attr_bits = attr->attr_bits;
+    cb_mem    = attr->cb_mem;
+    cb_size   = attr->cb_size;
+    if (cb_mem != NULL) {
+      if ((((uintptr_t)cb_mem & (sizeof(void *) - 1U)) != 0U) || (cb_size < sizeof(os_work_t))) {
+        return NULL;
+      }
+    } else if (cb_size != 0U) {
+      return NULL;
+    }
+  } else {
+    name      = NULL;
+    attr_bits = 0U;
+    cb_mem    = NULL;
+  }
+
+  osPosixKernelEnter();
+
+  if (cb_mem != NULL) {
+    work = (os_work_t *)cb_mem;
+    (void)memset(work, 0, sizeof(os_work_t));
+  } else {
+    work = (os_work_t *)osPosixMemAlloc(sizeof(os_work_t));
+    if (work == NULL) {
+      osPosixKernelExit();
+      return NULL;
+    }
+    work->flags = osPosixFlagSystemObject;
+  }
+
+  work->id    = osPosixIdWork;
+  work->state = osPosixWorkIdle;
+  work->attr  = osPosixObjectAttrClass(attr_bits);
+  work->name  = name;
+  work->func  = func;
+  work->arg   = argument;
+
+  // Delay Timer: kernel internal (not in the object list), callback runs under the kernel lock
+  work->timer.state = osPosixTimerStopped;
+  work->timer.flags = osPosixTimerFlagLocked;
+  work->timer.name  = name;
+  work->timer.type  = (uint8_t)osTimerOnce;
+  work->timer.func  = WorkTimerExpired;
+  work->timer.arg   = work;
+  osPosixObjectAdd(work);
+
+  osPosixKernelExit();
+
+  return work;
+}
+
+/// Get name of a work item.
+const char *osWorkGetName (osWorkId_t work_id) {
+  const os_work_t *work = (const os_work_t *)work_id;
+
+  if (!IsWorkValid(work)) {
+    return NULL;
+  }
+  return work->name;
+}
+
+/// Submit a work item to a Work Queue.
+osStatus_t osWorkSubmit (osWorkQueueId_t wq_id, osWorkId_t work_id, uint32_t lane) {
+  os_work_queue_t *wq   = (os_work_queue_t *)wq_id;
+  os_work_t       *work = (os_work_t *)work_id;
+  osStatus_t       status;
+
+  if (!IsWorkQueueValid(wq) || !IsWorkValid(work)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (lane >= wq->lanes) {
+    status = osErrorParameter;
+  } else if (!osPosixClassAllowed(wq) || !osPosixClassAllowed(work)) {
+    status = osErrorSafetyClass;
+  } else if ((work->state != osPosixWorkIdle) && (work->wq != wq)) {
+    // Pending on another Work Queue
+    status = osErrorResource;
+  } else if (work->state == osPosixWorkQueued) {
+    // Already queued: executes once
+    status = osOK;
+  } else {
+    if (work->state == osPosixWorkDelayed) {
+      WorkRemove(work);
+    }
+    WorkEnqueue(wq, work, lane);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Submit a work item to a Work Queue after a delay.
+osStatus_t osWorkSubmitDelayed (osWorkQueueId_t wq_id, osWorkId_t work_id, uint32_t lane, uint32_t ticks) {
+  os_work_queue_t *wq   = (os_work_queue_t *)wq_id;
+  os_work_t       *work = (os_work_t *)work_id;
+  osStatus_t       status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (ticks == 0U) {
+    return osWorkSubmit(wq_id, work_id, lane);
+  }
+  if (!IsWorkQueueValid(wq) || !IsWorkValid(work)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (lane >= wq->lanes) {
+    status = osErrorParameter;
+  } else if (!osPosixClassAllowed(wq) || !osPosixClassAllowed(work)) {
+    status = osErrorSafetyClass;
+  } else if ((work->state != osPosixWorkIdle) && (work->wq != wq)) {
+    // Pending on another Work Queue
+    status = osErrorResource;
+  } else if (work->state == osPosixWorkQueued) {
+    // Already queued: executes without delay
+    status = osOK;
+  } else {
+    if (work->state == osPosixWorkDelayed) {
+      // Restart the delay
+      WorkRemove(work);
+    }
+    WorkDelay(wq, work, lane, ticks);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Cancel a pending (queued or delayed) work item.
+osStatus_t osWorkCancel (osWorkId_t work_id) {
+  os_work_t  *work = (os_work_t *)work_id;
+  osStatus_t  status;
+
+  if (!IsWorkValid(work)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(work)) {
+    status = osErrorSafetyClass;
+  } else if (work->state == osPosixWorkIdle) {
+    status = osErrorResource;
+  } else {
+    WorkRemove(work);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
+
+/// Check if a work item is pending (queued or delayed).
+uint32_t osWorkIsPending (osWorkId_t work_id) {
+  const os_work_t *work = (const os_work_t *)work_id;
+
+  if (!IsWorkValid(work)) {
+    return 0U;
+  }
+  return ((work->state != osPosixWorkIdle) ? 1U : 0U);
+}
+
+/// Delete a work item.
+osStatus_t osWorkDelete (osWorkId_t work_id) {
+  os_work_t  *work = (os_work_t *)work_id;
+  osStatus_t  status;
+
+  if (osPosixIsIrqMode()) {
+    return osErrorISR;
+  }
+  if (!IsWorkValid(work)) {
+    return osErrorParameter;
+  }
+
+  osPosixKernelEnter();
+
+  if (!osPosixClassAllowed(work)) {
+    status = osErrorSafetyClass;
+  } else {
+    WorkDestroy(work);
+    status = osOK;
+  }
+
+  osPosixKernelExit();
+
+  return status;
+}
@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Core API conformance test
+ *
+ * Checks the behavior of the core CMSIS-RTOS2 API that application code relies
+ * on: kernel state, thread management, delays, mutexes, semaphores, message
+ * queues, event flags and timers. The checks hold in both scheduler modes
+ * (OS_SCHED_MODE 0: concurrent, 1: deterministic); the order of execution
+ * after a preemption is checked in deterministic mode only.
+ *
+ * Usage: test_api (exit status 0: passed)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+// Tolerance for delays and timers in ticks (host scheduling latency)
+#define TICK_SLACK      50U
+
+static uint32_t Failed;
+static bool     Deterministic;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);   \
+      Failed++;                                                         \
+    }                                                                   \
+  } while (0)
+
+static osSemaphoreId_t Sync;            // Signals from helper threads
+static volatile uint32_t Step;          // Progress of helper threads
+
+
+//  ==== Kernel ====
+
+// Kernel information and scheduler lock.
+static void TestKernel (void) {
+  osVersion_t version;
+  char        id[64];
+  uint32_t    tick;
+
+  CHECK(osKernelGetInfo(&version, id, sizeof(id)) == osOK);
+  CHECK(version.api >= 20000000U);
+  CHECK(strlen(id) > 0U);
+
+  CHECK(osKernelGetState() == osKernelRunning);
+  CHECK(osKernelGetTickFreq() != 0U);
+  CHECK(osKernelGetSysTimerFreq() != 0U);
+
+  CHECK(osKernelLock() == 0);
+  CHECK(osKernelGetState() == osKernelLocked);
+  CHECK(osKernelLock() == 1);
+  CHECK(osKernelUnlock() == 1);
+  CHECK(osKernelGetState() == osKernelRunning);
+  CHECK(osKernelUnlock() == 0);
+  CHECK(osKernelRestoreLock(1) == 1);
+  CHECK(osKernelGetState() == osKernelLocked);
+  CHECK(osKernelRestoreLock(0) == 0);
+  CHECK(osKernelGetState() == osKernelRunning);
+
+  tick = osKernelGetTickCount();
+  CHECK(osDelay(5U) == osOK);
+  CHECK((osKernelGetTickCount() - tick) >= 5U);
+}
+
+
+//  ==== Delay ====
+
+// Relative and absolute delays.
+static void TestDelay (void) {
+  uint32_t tick;
+  uint32_t elapsed;
+
+  CHECK(osDelay(0U) == osOK);
+
+  tick = osKernelGetTickCount();
+  CHECK(osDelay(20U) == osOK);
+  elapsed = osKernelGetTickCount() - tick;
+  CHECK((elapsed >= 20U) && (elapsed <= (20U + TICK_SLACK)));
+
+  tick = osKernelGetTickCount() + 20U;
+  CHECK(osDelayUntil(tick) == osOK);
+  elapsed = osKernelGetTickCount() - tick;
+  CHECK(elapsed <= TICK_SLACK);
+
+  // Time in the past
+  CHECK(osDelayUntil(osKernelGetTickCount() - 1U) == osErrorParameter);
+}
+
+
+//  ==== Thread ====
+
+static osThreadId_t ThreadSelf;
+
+static void ThreadHigh (void *argument) {
+  ThreadSelf = osThreadGetId();
+  Step = (uint32_t)(uintptr_t)argument;
+}
+
+static void ThreadWait (void *argument) {
+  (void)argument;
+  CHECK(osThreadFlagsWait(0x0001U, osFlagsWaitAny, osWaitForever) == 0x0001U);
+  Step = 2U;
+  (void)osSemaphoreRelease(Sync);
+  osThreadExit();
+}
+
+static void ThreadLoop (void *argument) {
+  (void)argument;
+  for (;;) {
+    (void)osDelay(1U);
+  }
+}
+
+// Thread creation, attributes, state, flags, join and termination.
+static void TestThread (void) {
+  osThreadAttr_t attr = { 0 };
+  osThreadId_t   id;
+  uint32_t       count;
+
+  id = osThreadGetId();
+  CHECK(id != NULL);
+  CHECK(osThreadGetState(id) == osThreadRunning);
+  CHECK(osThreadGetPriority(id) == osPriorityNormal);
+  CHECK(osThreadYield() == osOK);
+  count = osThreadGetCount();
+
+  // Higher priority thread (preempts in deterministic mode)
+  attr.name      = "High";
+  attr.priority  = osPriorityHigh;
+  attr.attr_bits = osThreadJoinable;
+  Step = 0U;
+  id = osThreadNew(ThreadHigh, (void *)1U, &attr);
+  CHECK(id != NULL);
+  if (Deterministic) {
+    CHECK(Step == 1U);
+  }
+  CHECK(osThreadJoin(id) == osOK);
+  CHECK(Step == 1U);
+  CHECK(ThreadSelf == id);
+  CHECK(osThreadGetCount() == count);
+
+  // Thread waiting for thread flags
+  attr.name      = "Wait";
+  attr.priority  = osPriorityNormal;
+  attr.attr_bits = 0U;
+  Step = 0U;
+  id = osThreadNew(ThreadWait, NULL, &attr);
+  CHECK(id != NULL);
+  CHECK(strcmp(osThreadGetName(id), "Wait") == 0);
+  CHECK(osThreadGetPriority(id) == osPriorityNormal);
+  CHECK(osThreadSetPriority(id, osPriorityBelowNormal) == osOK);
+  CHECK(osThreadGetPriority(id) == osPriorityBelowNormal);
+  CHECK(osThreadGetCount() == (count + 1U));
+  CHECK(osDelay(10U) == osOK);
+  CHECK(osThreadGetState(id) == osThreadBlocked);
+  CHECK(Step == 0U);
+  CHECK((osThreadFlagsSet(id, 0x0001U) & osFlagsError) == 0U);
+  CHECK(osSemaphoreAcquire(Sync, 1000U) == osOK);
+  CHECK(Step == 2U);
+
+  // Own thread flags
+  CHECK(osThreadFlagsSet(osThreadGetId(), 0x0006U) == 0x0006U);
+  CHECK(osThreadFlagsGet() == 0x0006U);
+  CHECK(osThreadFlagsWait(0x0002U, osFlagsWaitAny | osFlagsNoClear, 0U) == 0x0006U);
+  CHECK(osThreadFlagsWait(0x0006U, osFlagsWaitAll, 0U) == 0x0006U);
+  CHECK(osThreadFlagsGet() == 0U);
+  CHECK(osThreadFlagsWait(0x0001U, osFlagsWaitAny, 0U) == osFlagsErrorResource);
+  CHECK(osThreadFlagsWait(0x0001U, osFlagsWaitAny, 5U) == osFlagsErrorTimeout);
+
+  // Suspend, resume and terminate
+  id = osThreadNew(ThreadLoop, NULL, NULL);
+  CHECK(id != NULL);
+  CHECK(osThreadSuspend(id) == osOK);
+  CHECK(osThreadGetState(id) == osThreadBlocked);
+  CHECK(osThreadResume(id) == osOK);
+  CHECK(osThreadTerminate(id) == osOK);
+  CHECK(osThreadGetCount() == count);
+
+  // Invalid parameters
+  CHECK(osThreadNew(NULL, NULL, NULL) == NULL);
+  CHECK(osThreadGetState(NULL) == osThreadError);
+  CHECK(osThreadSetPriority(osThreadGetId(), osPriorityError) == osErrorParameter);
+  CHECK(osThreadJoin(osThreadGetId()) != osOK);
+}
+
+
+//  ==== Mutex ====
+
+static osMutexId_t Mutex;
+
+// Low priority owner of the mutex (inherits the priority of the waiting main thread).
+static void MutexHolder (void *argument) {
+  (void)argument;
+  CHECK(osMutexAcquire(Mutex, osWaitForever) == osOK);
+  (void)osSemaphoreRelease(Sync);
+  (void)osDelay(20U);
+  CHECK(osThreadGetPriority(osThreadGetId()) == osPriorityNormal);
+  CHECK(osMutexRelease(Mutex) == osOK);
+  CHECK(osThreadGetPriority(osThreadGetId()) == osPriorityLow);
+  (void)osSemaphoreRelease(Sync);
+}
+
+// Ownership, recursion, timeouts and priority inheritance.
+static void TestMutex (void) {
+  osMutexAttr_t attr = { 0 };
+  osThreadAttr_t tattr = { 0 };
+  osThreadId_t  id;
+
+  attr.name      = "Mutex";
+  attr.attr_bits = osMutexRecursive | osMutexPrioInherit;
+  Mutex = osMutexNew(&attr);
+  CHECK(Mutex != NULL);
+  CHECK(strcmp(osMutexGetName(Mutex), "Mutex") == 0);
+  CHECK(osMutexGetOwner(Mutex) == NULL);
+
+  CHECK(osMutexAcquire(Mutex, 0U) == osOK);
+  CHECK(osMutexAcquire(Mutex, 0U) == osOK);
+  CHECK(osMutexGetOwner(Mutex) == osThreadGetId());
+  CHECK(osMutexRelease(Mutex) == osOK);
+  CHECK(osMutexGetOwner(Mutex) == osThreadGetId());
+  CHECK(osMutexRelease(Mutex) == osOK);
+  CHECK(osMutexGetOwner(Mutex) == NULL);
+  CHECK(osMutexRelease(Mutex) == osErrorResource);
+
+  // Mutex owned by a lower priority thread
+  tattr.priority = osPriorityLow;
+  id = osThreadNew(MutexHolder, NULL, &tattr);
+  CHECK(id != NULL);
+  CHECK(osSemaphoreAcquire(Sync, 1000U) == osOK);
+  CHECK(osMutexGetOwner(Mutex) == id);
+  CHECK(osMutexAcquire(Mutex, 0U) == osErrorResource);
+  CHECK(osMutexRelease(Mutex) == osErrorResource);
+  CHECK(osMutexAcquire(Mutex, 5U) == osErrorTimeout);
+  CHECK(osMutexAcquire(Mutex, 1000U) == osOK);
+  CHECK(osMutexGetOwner(Mutex) == osThreadGetId());
+  CHECK(osMutexRelease(Mutex) == osOK);
+  CHECK(osSemaphoreAcquire(Sync, 1000U) == osOK);
+
+  CHECK(osMutexDelete(Mutex) == osOK);
+}
+
+
+//  ==== Semaphore ====
+
+static osSemaphoreId_t Semaphore;
+
+static void SemaphoreReleaser (void *argument) {
+  (void)argument;
+  (void)osDelay(10U);
+  CHECK(osSemaphoreRelease(Semaphore) == osOK);
+}
+
+// Token counting, limits and blocking acquire.
+static void TestSemaphore (void) {
+  osSemaphoreAttr_t attr = { 0 };
+
+  attr.name = "Semaphore";
+  Semaphore = osSemaphoreNew(2U, 1U, &attr);
+  CHECK(Semaphore != NULL);
+  CHECK(strcmp(osSemaphoreGetName(Semaphore), "Semaphore") == 0);
+  CHECK(osSemaphoreGetCount(Semaphore) == 1U);
+
+  CHECK(osSemaphoreRelease(Semaphore) == osOK);
+  CHECK(osSemaphoreGetCount(Semaphore) == 2U);
+  CHECK(osSemaphoreRelease(Semaphore) == osErrorResource);
+  CHECK(osSemaphoreAcquire(Semaphore, 0U) == osOK);
+  CHECK(osSemaphoreAcquire(Semaphore, 0U) == osOK);
+  CHECK(osSemaphoreGetCount(Semaphore) == 0U);
+  CHECK(osSemaphoreAcquire(Semaphore, 0U) == osErrorResource);
+  CHECK(osSemaphoreAcquire(Semaphore, 5U) == osErrorTimeout);
+
+  // Token released by another thread while waiting
+  CHECK(osThreadNew(SemaphoreReleaser, NULL, NULL) != NULL);
+  CHECK(osSemaphoreAcquire(Semaphore, 1000U) == osOK);
+  CHECK(osSemaphoreGetCount(Semaphore) == 0U);
+
+  CHECK(osSemaphoreNew(0U, 0U, NULL) == NULL);
+  CHECK(osSemaphoreNew(1U, 2U, NULL) == NULL);
+  CHECK(osSemaphoreDelete(Semaphore) == osOK);
+}
+
+
+//  ==== Message Queue ====
+
+static osMessageQueueId_t MessageQueue;
+
+static void MessageSender (void *argument) {
+  uint32_t msg = (uint32_t)(uintptr_t)argument;
+
+  (void)osDelay(10U);
+  CHECK(osMessageQueuePut(MessageQueue, &msg, 0U, osWaitForever) == osOK);
+}
+
+// Message order, priorities, capacity and blocking get.
+static void TestMessageQueue (void) {
+  osMessageQueueAttr_t attr = { 0 };
+  uint32_t msg;
+  uint8_t  prio;
+
+  attr.name = "MessageQueue";
+  MessageQueue = osMessageQueueNew(3U, sizeof(uint32_t), &attr);
+  CHECK(MessageQueue != NULL);
+  CHECK(strcmp(osMessageQueueGetName(MessageQueue), "MessageQueue") == 0);
+  CHECK(osMessageQueueGetCapacity(MessageQueue) == 3U);
+  CHECK(osMessageQueueGetMsgSize(MessageQueue) == sizeof(uint32_t));
+  CHECK(osMessageQueueGetCount(MessageQueue) == 0U);
+  CHECK(osMessageQueueGetSpace(MessageQueue) == 3U);
+
+  // FIFO order within a priority, higher priority first
+  msg = 1U; CHECK(osMessageQueuePut(MessageQueue, &msg, 0U, 0U) == osOK);
+  msg = 2U; CHECK(osMessageQueuePut(MessageQueue, &msg, 0U, 0U) == osOK);
+  msg = 3U; CHECK(osMessageQueuePut(MessageQueue, &msg, 5U, 0U) == osOK);
+  CHECK(osMessageQueueGetCount(MessageQueue) == 3U);
+  CHECK(osMessageQueueGetSpace(MessageQueue) == 0U);
+  CHECK(osMessageQueuePut(MessageQueue, &msg, 0U, 0U) == osErrorResource);
+  CHECK(osMessageQueuePut(MessageQueue, &msg, 0U, 5U) == osErrorTimeout);
+
+  CHECK(osMessageQueueGet(MessageQueue, &msg, &prio, 0U) == osOK);
+  CHECK((msg == 3U) && (prio == 5U));
+  CHECK(osMessageQueueGet(MessageQueue, &msg, &prio, 0U) == osOK);
+  CHECK((msg == 1U) && (prio == 0U));
+  CHECK(osMessageQueueGet(MessageQueue, &msg, NULL, 0U) == osOK);
+  CHECK(msg == 2U);
+  CHECK(osMessageQueueGet(MessageQueue, &msg, NULL, 0U) == osErrorResource);
+  CHECK(osMessageQueueGet(MessageQueue, &msg, NULL, 5U) == osErrorTimeout);
+
+  // Message put by another thread while waiting
+  CHECK(osThreadNew(MessageSender, (void *)4U, NULL) != NULL);
+  CHECK(osMessageQueueGet(MessageQueue, &msg, NULL, 1000U) == osOK);
+  CHECK(msg == 4U);
+
+  // Reset discards the messages
+  msg = 5U;
+  CHECK(osMessageQueuePut(MessageQueue, &msg, 0U, 0U) == osOK);
+  CHECK(osMessageQueueReset(MessageQueue) == osOK);
+  CHECK(osMessageQueueGetCount(MessageQueue) == 0U);
+
+  CHECK(osMessageQueueNew(0U, sizeof(uint32_t), NULL) == NULL);
+  CHECK(osMessageQueueDelete(MessageQueue) == osOK);
+}
+
+
+//  ==== Event Flags ====
+
+static osEventFlagsId_t EventFlags;
+
+static void EventSetter (void *argument) {
+  (void)argument;
+  (void)osDelay(10U);
+  (void)osEventFlagsSet(EventFlags, 0x0010U);
+  (void)osDelay(10U);
+  (void)osEventFlagsSet(EventFlags, 0x0020U);
+}
+
+// Wait any/all, clear options and timeouts.
+static void TestEventFlags (void) {
+  osEventFlagsAttr_t attr = { 0 };
+
+  attr.name = "EventFlags";
+  EventFlags = osEventFlagsNew(&attr);
+  CHECK(EventFlags != NULL);
+  CHECK(strcmp(osEventFlagsGetName(EventFlags), "EventFlags") == 0);
+  CHECK(osEventFlagsGet(EventFlags) == 0U);
+
+  CHECK(osEventFlagsSet(EventFlags, 0x0003U) == 0x0003U);
+  CHECK(osEventFlagsWait(EventFlags, 0x0001U, osFlagsWaitAny | osFlagsNoClear, 0U) == 0x0003U);
+  CHECK(osEventFlagsWait(EventFlags, 0x0005U, osFlagsWaitAll, 0U) == osFlagsErrorResource);
+  CHECK(osEventFlagsWait(EventFlags, 0x0005U, osFlagsWaitAny, 0U) == 0x0003U);
+  CHECK(osEventFlagsGet(EventFlags) == 0x0002U);
+  CHECK(osEventFlagsClear(EventFlags, 0x0002U) == 0x0002U);
+  CHECK(osEventFlagsGet(EventFlags) == 0U);
+  CHECK(osEventFlagsWait(EventFlags, 0x0001U, osFlagsWaitAny, 5U) == osFlagsErrorTimeout);
+
+  // Flags set by another thread while waiting for all
+  CHECK(osThreadNew(EventSetter, NULL, NULL) != NULL);
+  CHECK(osEventFlagsWait(EventFlags, 0x0030U, osFlagsWaitAll, 1000U) == 0x0030U);
+  CHECK(osEventFlagsGet(EventFlags) == 0U);
+
+  CHECK(osEventFlagsSet(EventFlags, 0x80000000U) == osFlagsErrorParameter);
+  CHECK(osEventFlagsDelete(EventFlags) == osOK);
+}
+
+
+//  ==== Timer ====
+
+static volatile uint32_t TimerCount;
+
+static void TimerCallback (void *argument) {
+  TimerCount += (uint32_t)(uintptr_t)argument;
+}
+
+// One-shot and periodic timers.
+static void TestTimer (void) {
+  osTimerAttr_t attr = { 0 };
+  osTimerId_t   once;
+  osTimerId_t   periodic;
+  uint32_t      tick;
+  uint32_t      count;
+
+  attr.name = "Once";
+  once = osTimerNew(TimerCallback, osTimerOnce, (void *)1U, &attr);
+  CHECK(once != NULL);
+  CHECK(strcmp(osTimerGetName(once), "Once") == 0);
+  periodic = osTimerNew(TimerCallback, osTimerPeriodic, (void *)100U, NULL);
+  CHECK(periodic != NULL);
+
+  CHECK(osTimerIsRunning(once) == 0U);
+  CHECK(osTimerStop(once) == osErrorResource);
+  CHECK(osTimerStart(once, 0U) == osErrorParameter);
+
+  // One-shot timer expires once
+  TimerCount = 0U;
+  tick = osKernelGetTickCount();
+  CHECK(osTimerStart(once, 10U) == osOK);
+  CHECK(osTimerIsRunning(once) == 1U);
+  while ((TimerCount == 0U) && ((osKernelGetTickCount() - tick) < 1000U)) {
+    (void)osDelay(1U);
+  }
+  CHECK(TimerCount == 1U);
+  CHECK((osKernelGetTickCount() - tick) >= 10U);
+  CHECK(osDelay(20U) == osOK);
+  CHECK(TimerCount == 1U);
+  CHECK(osTimerIsRunning(once) == 0U);
+
+  // Stopped timer does not expire
+  CHECK(osTimerStart(once, 10U) == osOK);
+  CHECK(osTimerStop(once) == osOK);
+  CHECK(osDelay(20U) == osOK);
+  CHECK(TimerCount == 1U);
+
+  // Periodic timer expires every period until stopped
+  TimerCount = 0U;
+  tick = osKernelGetTickCount();
+  CHECK(osTimerStart(periodic, 10U) == osOK);
+  while ((TimerCount < 500U) && ((osKernelGetTickCount() - tick) < 1000U)) {
+    (void)osDelay(1U);
+  }
+  CHECK(TimerCount >= 500U);
+  CHECK((osKernelGetTickCount() - tick) >= 50U);
+  CHECK(osTimerIsRunning(periodic) == 1U);
+  CHECK(osTimerStop(periodic) == osOK);
+  CHECK(osDelay(20U) == osOK);
+  count = TimerCount;
+  CHECK(osDelay(20U) == osOK);
+  CHECK(TimerCount == count);
+
+  CHECK(osTimerDelete(once) == osOK);
+  CHECK(osTimerDelete(periodic) == osOK);
+}
+
+
+// Test main thread.
+static void Main (void *argument) {
+  (void)argument;
+
+  Deterministic = (osPosixKernelGetSchedMode() == osPosixSchedDeterministic);
+
+  Sync = osSemaphoreNew(1U, 0U, NULL);
+
+  TestKernel();
+  TestDelay();
+  TestThread();
+  TestMutex();
+  TestSemaphore();
+  TestMessageQueue();
+  TestEventFlags();
+  TestTimer();
+
+  printf("test_api (%s): %s\n", Deterministic ? "deterministic" : "concurrent",
+         (Failed == 0U) ? "passed" : "FAILED");
+  exit((Failed == 0U) ? 0 : 1);
+}
+
+int main (void) {
+  CHECK(osKernelGetState() == osKernelInactive);
+  CHECK(osKernelInitialize() == osOK);
+  CHECK(osKernelGetState() == osKernelReady);
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+  return 1;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Memory Pool cache regression test
+ *
+ * A block that is freed twice into a per-thread cache is rejected like
+ * without cache, is not allocated twice and does not corrupt the used and
+ * available block counts.
+ *
+ * Usage: test_mempool_cache (exit status 0: passed)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define BLOCK_COUNT     8U              // Memory Pool capacity
+#define CACHE_DEPTH     4U              // Cache depth of cached configuration
+
+static uint32_t Failed;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);   \
+      Failed++;                                                         \
+    }                                                                   \
+  } while (0)
+
+// Free a block twice, then check allocation and counts.
+static void TestDoubleFree (uint32_t cache_depth) {
+  osMemoryPoolId_t mp;
+  void            *block;
+  void            *b1, *b2;
+
+  mp = osMemoryPoolNew(BLOCK_COUNT, 32U, &(osMemoryPoolAttr_t){ .cache_depth = cache_depth });
+  CHECK(mp != NULL);
+
+  block = osMemoryPoolAlloc(mp, 0U);
+  CHECK(block != NULL);
+  CHECK(osMemoryPoolFree(mp, block) == osOK);
+  CHECK(osMemoryPoolFree(mp, block) == osErrorResource);
+  CHECK(osMemoryPoolFree(mp, block) == osErrorResource);
+
+  b1 = osMemoryPoolAlloc(mp, 0U);
+  b2 = osMemoryPoolAlloc(mp, 0U);
+  CHECK((b1 != NULL) && (b2 != NULL) && (b1 != b2));
+  CHECK(osMemoryPoolGetCount(mp) == 2U);
+  CHECK(osMemoryPoolGetSpace(mp) == (BLOCK_COUNT - 2U));
+
+  CHECK(osMemoryPoolFree(mp, b1) == osOK);
+  CHECK(osMemoryPoolFree(mp, b2) == osOK);
+  CHECK(osMemoryPoolFree(mp, b2) == osErrorResource);
+  CHECK(osMemoryPoolGetCount(mp) == 0U);
+  CHECK(osMemoryPoolGetSpace(mp) == BLOCK_COUNT);
+
+  CHECK(osMemoryPoolDelete(mp) == osOK);
+}
+
+// Test main thread.
+static void Main (void *argument) {
+  (void)argument;
+
+  TestDoubleFree(0U);
+  TestDoubleFree(CACHE_DEPTH);
+
+  printf("test_mempool_cache: %s\n", (Failed == 0U) ? "passed" : "FAILED");
+  exit((Failed == 0U) ? 0 : 1);
+}
+
+int main (void) {
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+  return 1;
+}
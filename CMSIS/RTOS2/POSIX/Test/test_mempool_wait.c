@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS2 POSIX Host Implementation
+ * Title:       Memory Pool multiple object wait regression test
+ *
+ * osWaitAny and osWaitAll on an exhausted Memory Pool see a block that a
+ * running thread frees into its per-thread cache, before and while waiting.
+ *
+ * Usage: test_mempool_wait (exit status 0: passed)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "os_posix.h"
+
+#define BLOCK_COUNT     4U              // Memory Pool capacity
+#define CACHE_DEPTH     4U              // Cache depth of cached configuration
+
+static uint32_t Failed;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);   \
+      Failed++;                                                         \
+    }                                                                   \
+  } while (0)
+
+static osMemoryPoolId_t  Pool;
+static osSemaphoreId_t   FreeReq;       // Free one block of the Freer thread
+static osSemaphoreId_t   FreeDone;
+static void             *FreerBlock[BLOCK_COUNT];
+
+// Thread that owns the blocks and frees one per request (stays alive, keeps its cache).
+static void Freer (void *argument) {
+  uint32_t n;
+  (void)argument;
+
+  for (n = 0U; n < BLOCK_COUNT; n++) {
+    FreerBlock[n] = osMemoryPoolAlloc(Pool, 0U);
+  }
+  (void)osSemaphoreRelease(FreeDone);
+
+  for (n = 0U; n < BLOCK_COUNT; n++) {
+    (void)osSemaphoreAcquire(FreeReq, osWaitForever);
+    (void)osDelay(10U);
+    (void)osMemoryPoolFree(Pool, FreerBlock[n]);
+    (void)osSemaphoreRelease(FreeDone);
+  }
+  (void)osDelay(osWaitForever);
+}
+
+// Wait for a block freed by a running thread, with and without a Memory Pool cache.
+static void TestWait (uint32_t cache_depth) {
+  void        *objects[1];
+  osThreadId_t freer;
+  void        *block;
+
+  Pool = osMemoryPoolNew(BLOCK_COUNT, 32U, &(osMemoryPoolAttr_t){ .cache_depth = cache_depth });
+  CHECK(Pool != NULL);
+  objects[0] = Pool;
+
+  freer = osThreadNew(Freer, NULL, NULL);
+  CHECK(freer != NULL);
+  CHECK(osSemaphoreAcquire(FreeDone, 1000U) == osOK);
+  CHECK(osMemoryPoolGetSpace(Pool) == 0U);
+  CHECK(osWaitAny(objects, 1U, 0U) == (int32_t)osErrorResource);
+
+  // Block freed while waiting (osWaitAny)
+  CHECK(osSemaphoreRelease(FreeReq) == osOK);
+  CHECK(osWaitAny(objects, 1U, 1000U) == 0);
+  CHECK(osSemaphoreAcquire(FreeDone, 1000U) == osOK);
+  block = osMemoryPoolAlloc(Pool, 0U);
+  CHECK(block != NULL);
+
+  // Block freed while waiting (osWaitAll)
+  CHECK(osSemaphoreRelease(FreeReq) == osOK);
+  CHECK(osWaitAll(objects, 1U, 1000U) == osOK);
+  CHECK(osSemaphoreAcquire(FreeDone, 1000U) == osOK);
+  CHECK(osMemoryPoolAlloc(Pool, 0U) != NULL);
+
+  // Block freed before waiting (held in the cache of the running thread)
+  CHECK(osSemaphoreRelease(FreeReq) == osOK);
+  CHECK(osSemaphoreAcquire(FreeDone, 1000U) == osOK);
+  CHECK(osWaitAny(objects, 1U, 0U) == 0);
+  CHECK(osMemoryPoolAlloc(Pool, 0U) != NULL);
+
+  // Freed blocks use the caches again when no thread waits
+  CHECK(osMemoryPoolFree(Pool, block) == osOK);
+  CHECK(osMemoryPoolGetSpace(Pool) == 1U);
+
+  CHECK(osThreadTerminate(freer) == osOK);
+  CHECK(osMemoryPoolDelete(Pool) == osOK);
+}
+
+// Test main thread.
+static void Main (void *argument) {
+  (void)argument;
+
+  FreeReq  = osSemaphoreNew(BLOCK_COUNT, 0U, NULL);
+  FreeDone = osSemaphoreNew(BLOCK_COUNT, 0U, NULL);
+
+  TestWait(0U);
+  TestWait(CACHE_DEPTH);
+
+  printf("test_mempool_wait: %s\n", (Failed == 0U) ? "passed" : "FAILED");
+  exit((Failed == 0U) ? 0 : 1);
+}
+
+int main (void) {
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+  return 1;
+}
@@ -0,0 +1,509 @@
+/**************************************************************************//**
+ * @file     os_mem_tlsf.c
+ * @brief    CMSIS OS Memory implementation using Two-Level Segregated Fit
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "os_mem.h"
+
+#if defined(_RTE_)
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#endif
+
+// Second level subdivisions per power of two: 2^OS_MEM_SL_LOG2 (4: 16 lists, 5: 32 lists)
+#ifndef OS_MEM_SL_LOG2
+#define OS_MEM_SL_LOG2          4
+#endif
+
+// Largest memory block: 2^OS_MEM_SIZE_LOG2 - 1 bytes (memory regions are limited to this size)
+#ifndef OS_MEM_SIZE_LOG2
+#define OS_MEM_SIZE_LOG2        24
+#endif
+
+// Critical section: interrupts are disabled on Cortex-M, other targets serialize the calls
+#ifndef OS_MEM_LOCK
+#if defined(__CORTEX_M)
+#define OS_MEM_LOCK()           MemLock()
+#define OS_MEM_UNLOCK(lock)     __set_PRIMASK(lock)
+static inline uint32_t MemLock (void) {
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+}
+#else
+#define OS_MEM_LOCK()           0U
+#define OS_MEM_UNLOCK(lock)     (void)(lock)
+#endif
+#endif
+
+#if (OS_MEM_SL_LOG2 < 1) || (OS_MEM_SL_LOG2 > 5)
+#error "OS_MEM_SL_LOG2 must be in range 1..5"
+#endif
+#if (OS_MEM_SIZE_LOG2 < (OS_MEM_SL_LOG2 + 4)) || (OS_MEM_SIZE_LOG2 > 31)
+#error "OS_MEM_SIZE_LOG2 out of range"
+#endif
+
+#define ALIGN_LOG2              3U
+#define ALIGN_SIZE              (1U << ALIGN_LOG2)
+#define SL_COUNT                (1U << OS_MEM_SL_LOG2)
+#define FL_SHIFT                (OS_MEM_SL_LOG2 + ALIGN_LOG2)
+#define FL_COUNT                (OS_MEM_SIZE_LOG2 - FL_SHIFT + 1U)
+#define SMALL_BLOCK             (1U << FL_SHIFT)
+
+#define REGION_MAGIC            0x544C5346U     // "TLSF"
+
+/// Memory block
+typedef struct mem_block_s {
+  struct mem_block_s *prev_phys;                // Previous physical block (NULL for the first block)
+  size_t              size;                     // Payload size in bytes | BLOCK_FREE
+  struct mem_block_s *next_free;                // Next free block in list (free blocks only)
+  struct mem_block_s *prev_free;                // Previous free block in list (free blocks only)
+} mem_block_t;
+
+#define BLOCK_FREE              1U
+#define BLOCK_HDR               ((uint32_t)offsetof(mem_block_t, next_free))
+#define BLOCK_MIN               ((uint32_t)(sizeof(mem_block_t) - offsetof(mem_block_t, next_free)))
+#define BLOCK_MAX               ((1UL << OS_MEM_SIZE_LOG2) - ALIGN_SIZE)
+
+/// Memory region control data (at the start of the region)
+typedef struct mem_region_s {
+  uint32_t             magic;                   // REGION_MAGIC
+  uint32_t             size;                    // Region size in bytes
+  struct mem_region_s *next;                    // Next region
+  const char          *name;                    // Region name
+  uint8_t             *base;                    // First block
+  uint8_t             *limit;                   // Sentinel block
+  uint32_t             used;                    // Allocated bytes (including block headers)
+  uint32_t             max_used;                // High-water mark of allocated bytes
+  uint32_t             free_bytes;              // Free bytes (including block headers)
+  uint32_t             free_blocks;             // Number of free blocks
+  uint32_t             alloc_count;             // Number of allocations
+  uint32_t             alloc_failed;            // Number of failed allocations
+  uint32_t             free_count;              // Number of freed blocks
+  uint32_t             fl_bitmap;               // First level: non-empty second level bitmaps
+  uint32_t             sl_bitmap[FL_COUNT];     // Second level: non-empty free lists
+  mem_block_t         *free_list[FL_COUNT][SL_COUNT];
+} mem_region_t;
+
+// List of memory regions (the first region is the default region)
+static mem_region_t *RegionList;
+
+
+//  ==== Helper functions ====
+
+/// Find last (most significant) set bit.
+static inline uint32_t BitFls (uint32_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (31U - (uint32_t)__builtin_clz(value));
+#else
+  uint32_t n = 31U;
+  while ((value & (1UL << n)) == 0U) {
+    n--;
+  }
+  return n;
+#endif
+}
+
+/// Find first (least significant) set bit.
+static inline uint32_t BitFfs (uint32_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return ((uint32_t)__builtin_ctz(value));
+#else
+  return (BitFls(value & (0U - value)));
+#endif
+}
+
+/// Get payload size of a block.
+static inline uint32_t BlockSize (const mem_block_t *block) {
+  return ((uint32_t)(block->size & ~(size_t)BLOCK_FREE));
+}
+
+/// Check if block is free.
+static inline int BlockIsFree (const mem_block_t *block) {
+  return ((block->size & BLOCK_FREE) != 0U);
+}
+
+/// Get payload of a block.
+static inline void *BlockPayload (const mem_block_t *block) {
+  return ((uint8_t *)block + BLOCK_HDR);
+}
+
+/// Get next physical block.
+static inline mem_block_t *BlockNext (const mem_block_t *block) {
+  return ((mem_block_t *)((uint8_t *)block + BLOCK_HDR + BlockSize(block)));
+}
+
+/// Map block size to free list indices (list containing blocks of this size).
+static void MappingInsert (uint32_t size, uint32_t *fl, uint32_t *sl) {
+  uint32_t f;
+
+  if (size < SMALL_BLOCK) {
+    *fl = 0U;
+    *sl = size >> ALIGN_LOG2;
+  } else {
+    f   = BitFls(size);
+    *sl = (size >> (f - OS_MEM_SL_LOG2)) ^ SL_COUNT;
+    *fl = f - FL_SHIFT + 1U;
+  }
+}
+
+/// Map requested size to free list indices (first list whose blocks are all large enough).
+static void MappingSearch (uint32_t size, uint32_t *fl, uint32_t *sl) {
+
+  if (size >= SMALL_BLOCK) {
+    size += (1UL << (BitFls(size) - OS_MEM_SL_LOG2)) - 1U;
+  }
+  MappingInsert(size, fl, sl);
+}
+
+/// Insert a block into its free list.
+static void FreeListInsert (mem_region_t *region, mem_block_t *block) {
+  uint32_t fl, sl;
+
+  MappingInsert(BlockSize(block), &fl, &sl);
+  block->size     |= BLOCK_FREE;
+  block->prev_free = NULL;
+  block->next_free = region->free_list[fl][sl];
+  if (block->next_free != NULL) {
+    block->next_free->prev_free = block;
+  }
+  region->free_list[fl][sl] = block;
+  region->sl_bitmap[fl]    |= (1UL << sl);
+  region->fl_bitmap        |= (1UL << fl);
+  region->free_bytes       += BlockSize(block) + BLOCK_HDR;
+  region->free_blocks++;
+}
+
+/// Remove a block from its free list.
+static void FreeListRemove (mem_region_t *region, mem_block_t *block) {
+  uint32_t fl, sl;
+
+  MappingInsert(BlockSize(block), &fl, &sl);
+  if (block->prev_free != NULL) {
+    block->prev_free->next_free = block->next_free;
+  } else {
+    region->free_list[fl][sl] = block->next_free;
+    if (block->next_free == NULL) {
+      region->sl_bitmap[fl] &= ~(1UL << sl);
+      if (region->sl_bitmap[fl] == 0U) {
+        region->fl_bitmap &= ~(1UL << fl);
+      }
+    }
+  }
+  if (block->next_free != NULL) {
+    block->next_free->prev_free = block->prev_free;
+  }
+  block->size &= ~(size_t)BLOCK_FREE;
+  region->free_bytes -= BlockSize(block) + BLOCK_HDR;
+  region->free_blocks--;
+}
+
+/// Find a free block of at least the size mapped to fl/sl.
+static mem_block_t *FreeListFind (const mem_region_t *region, uint32_t fl, uint32_t sl) {
+  uint32_t sl_map;
+  uint32_t fl_map;
+
+  if (fl >= FL_COUNT) {
+    return NULL;
+  }
+  sl_map = region->sl_bitmap[fl] & (~0UL << sl);
+  if (sl_map == 0U) {
+    fl_map = (fl < 31U) ? (region->fl_bitmap & (~0UL << (fl + 1U))) : 0U;
+    if (fl_map == 0U) {
+      return NULL;
+    }
+    fl     = BitFfs(fl_map);
+    sl_map = region->sl_bitmap[fl];
+  }
+  return (region->free_list[fl][BitFfs(sl_map)]);
+}
+
+/// Get region by ID (NULL: default region).
+static mem_region_t *RegionGet (OS_Mem_RegionId_t region_id) {
+  mem_region_t *region = (mem_region_t *)region_id;
+
+  if (region == NULL) {
+    region = RegionList;
+  }
+  if ((region == NULL) || (region->magic != REGION_MAGIC)) {
+    return NULL;
+  }
+  return region;
+}
+
+/// Get allocated block from payload address (NULL when not allocated).
+static mem_block_t *BlockGet (const void *ptr, mem_region_t **region_out) {
+  mem_region_t *region;
+  mem_block_t  *block;
+  mem_block_t  *next;
+
+  for (region = RegionList; region != NULL; region = region->next) {
+    if (((const uint8_t *)ptr >= region->base) && ((const uint8_t *)ptr < region->limit)) {
+      break;
+    }
+  }
+  if ((region == NULL) || ((((uintptr_t)ptr) & (ALIGN_SIZE - 1U)) != 0U)) {
+    return NULL;
+  }
+  block = (mem_block_t *)((uint8_t *)ptr - BLOCK_HDR);
+  if (((uint8_t *)block < region->base) || BlockIsFree(block)) {
+    return NULL;
+  }
+  next = BlockNext(block);
+  if (((uint8_t *)next > region->limit) || (next->prev_phys != block)) {
+    return NULL;
+  }
+  *region_out = region;
+  return block;
+}
+
+
+//  ==== OS Memory functions ====
+
+// Add a memory region.
+OS_Mem_RegionId_t OS_Mem_AddRegion (const char *name, void *mem, uint32_t size) {
+  mem_region_t  *region = (mem_region_t *)mem;
+  mem_region_t **link;
+  mem_block_t   *block;
+  mem_block_t   *sentinel;
+  uintptr_t      first;
+  uintptr_t      last;
+  uint32_t       lock;
+
+  if ((mem == NULL) || ((((uintptr_t)mem) & (ALIGN_SIZE - 1U)) != 0U) ||
+      (size < (sizeof(mem_region_t) + (2U * BLOCK_HDR) + BLOCK_MIN + ALIGN_SIZE))) {
+    return NULL;
+  }
+
+  (void)memset(region, 0, sizeof(mem_region_t));
+  region->magic = REGION_MAGIC;
+  region->size  = size;
+  region->name  = name;
+
+  // First free block after control data, sentinel block at the end
+  first = ((uintptr_t)mem + sizeof(mem_region_t) + (ALIGN_SIZE - 1U)) & ~(uintptr_t)(ALIGN_SIZE - 1U);
+  last  = (((uintptr_t)mem + size) & ~(uintptr_t)(ALIGN_SIZE - 1U)) - BLOCK_HDR;
+  if ((last - first - BLOCK_HDR) > BLOCK_MAX) {
+    last = first + BLOCK_HDR + BLOCK_MAX;
+  }
+  block               = (mem_block_t *)first;
+  block->prev_phys    = NULL;
+  block->size         = (size_t)(last - first - BLOCK_HDR);
+  sentinel            = (mem_block_t *)last;
+  sentinel->prev_phys = block;
+  sentinel->size      = 0U;
+  region->base        = (uint8_t *)first;
+  region->limit       = (uint8_t *)last;
+  FreeListInsert(region, block);
+
+  lock = OS_MEM_LOCK();
+  for (link = &RegionList; *link != NULL; link = &(*link)->next) {}
+  *link = region;
+  OS_MEM_UNLOCK(lock);
+
+  return region;
+}
+
+// Get a memory region by name.
+OS_Mem_RegionId_t OS_Mem_GetRegion (const char *name) {
+  mem_region_t *region;
+
+  if (name == NULL) {
+    return RegionList;
+  }
+  for (region = RegionList; region != NULL; region = region->next) {
+    if ((region->name != NULL) && (strcmp(region->name, name) == 0)) {
+      break;
+    }
+  }
+  return region;
+}
+
+// Get name of a memory region.
+const char *OS_Mem_GetRegionName (OS_Mem_RegionId_t region_id) {
+  const mem_region_t *region = RegionGet(region_id);
+
+  if (region == NULL) {
+    return NULL;
+  }
+  return region->name;
+}
+
+// Allocate a memory block from a memory region.
+void *OS_Mem_Alloc (OS_Mem_RegionId_t region_id, uint32_t size) {
+  mem_region_t *region = RegionGet(region_id);
+  mem_block_t  *block;
+  mem_block_t  *remain;
+  uint32_t      fl, sl;
+  uint32_t      lock;
+
+  if (region == NULL) {
+    return NULL;
+  }
+
+  lock = OS_MEM_LOCK();
+
+  block = NULL;
+  if ((size != 0U) && (size <= BLOCK_MAX)) {
+    size = (size + (ALIGN_SIZE - 1U)) & ~(ALIGN_SIZE - 1U);
+    if (size < BLOCK_MIN) {
+      size = BLOCK_MIN;
+    }
+    MappingSearch(size, &fl, &sl);
+    block = FreeListFind(region, fl, sl);
+  }
+  if (block == NULL) {
+    region->alloc_failed++;
+    OS_MEM_UNLOCK(lock);
+    return NULL;
+  }
+  FreeListRemove(region, block);
+
+  // Split off the remainder when it can hold a block
+  if (BlockSize(block) >= (size + BLOCK_HDR + BLOCK_MIN)) {
+    remain            = (mem_block_t *)((uint8_t *)block + BLOCK_HDR + size);
+    remain->prev_phys = block;
+    remain->size      = BlockSize(block) - size - BLOCK_HDR;
+    BlockNext(remain)->prev_phys = remain;
+    block->size       = size;
+    FreeListInsert(region, remain);
+  }
+
+  region->used += BlockSize(block) + BLOCK_HDR;
+  if (region->used > region->max_used) {
+    region->max_used = region->used;
+  }
+  region->alloc_count++;
+
+  OS_MEM_UNLOCK(lock);
+
+  return BlockPayload(block);
+}
+
+// Return an allocated memory block back to its memory region.
+int32_t OS_Mem_Free (void *ptr) {
+  mem_region_t *region;
+  mem_block_t  *block;
+  mem_block_t  *neighbor;
+  uint32_t      lock;
+
+  if (ptr == NULL) {
+    return (-1);
+  }
+
+  lock = OS_MEM_LOCK();
+
+  block = BlockGet(ptr, &region);
+  if (block == NULL) {
+    OS_MEM_UNLOCK(lock);
+    return (-1);
+  }
+  region->used -= BlockSize(block) + BLOCK_HDR;
+  region->free_count++;
+
+  // Merge with free neighbors
+  neighbor = block->prev_phys;
+  if ((neighbor != NULL) && BlockIsFree(neighbor)) {
+    FreeListRemove(region, neighbor);
+    neighbor->size += BlockSize(block) + BLOCK_HDR;
+    block = neighbor;
+    BlockNext(block)->prev_phys = block;
+  }
+  neighbor = BlockNext(block);
+  if (BlockIsFree(neighbor)) {
+    FreeListRemove(region, neighbor);
+    block->size += BlockSize(neighbor) + BLOCK_HDR;
+    BlockNext(block)->prev_phys = block;
+  }
+  FreeListInsert(region, block);
+
+  OS_MEM_UNLOCK(lock);
+
+  return (0);
+}
+
+// Get the usable size of an allocated memory block.
+uint32_t OS_Mem_GetBlockSize (const void *ptr) {
+  mem_region_t *region;
+  mem_block_t  *block;
+  uint32_t      size = 0U;
+  uint32_t      lock;
+
+  if (ptr == NULL) {
+    return 0U;
+  }
+
+  lock = OS_MEM_LOCK();
+  block = BlockGet(ptr, &region);
+  if (block != NULL) {
+    size = BlockSize(block);
+  }
+  OS_MEM_UNLOCK(lock);
+
+  return size;
+}
+
+// Get statistics of a memory region.
+int32_t OS_Mem_GetStats (OS_Mem_RegionId_t region_id, OS_Mem_Stats_t *stats) {
+  mem_region_t      *region = RegionGet(region_id);
+  const mem_block_t *block;
+  uint32_t           largest = 0U;
+  uint32_t           fl;
+  uint32_t           lock;
+
+  if ((region == NULL) || (stats == NULL)) {
+    return (-1);
+  }
+
+  lock = OS_MEM_LOCK();
+
+  // The largest free block is in the highest non-empty free list
+  if (region->fl_bitmap != 0U) {
+    fl    = BitFls(region->fl_bitmap);
+    block = region->free_list[fl][BitFls(region->sl_bitmap[fl])];
+    for (; block != NULL; block = block->next_free) {
+      if (BlockSize(block) > largest) {
+        largest = BlockSize(block);
+      }
+    }
+  }
+
+  stats->size          = region->size;
+  stats->used          = region->used;
+  stats->max_used      = region->max_used;
+  stats->free_bytes    = region->free_bytes;
+  stats->largest_free  = largest;
+  stats->free_blocks   = region->free_blocks;
+  stats->alloc_count   = region->alloc_count;
+  stats->alloc_failed  = region->alloc_failed;
+  stats->free_count    = region->free_count;
+  stats->fragmentation = 0U;
+  if (region->free_bytes != 0U) {
+    stats->fragmentation = 1000U - (uint32_t)(((uint64_t)(largest + BLOCK_HDR) * 1000U) / region->free_bytes);
+  }
+
+  OS_MEM_UNLOCK(lock);
+
+  return (0);
+}
@@ -0,0 +1,99 @@
+/**************************************************************************//**
+ * @file     os_runtime.c
+ * @brief    CMSIS OS Runtime cycle counter implementation
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include "os_runtime.h"
+
+//lint -emacro((923,9078),DCB,DWT) "cast from unsigned long to pointer"
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+// Runtime counter: cycle counter of cmsis_perf.h (PMU when present, otherwise DWT)
+#include "cmsis_perf.h"
+
+#if (CMSIS_PERF_BACKEND != CMSIS_PERF_BACKEND_NONE)
+
+// Time of the last thread switch
+static uint64_t RuntimeSwitch __attribute__((section(".bss.os")));
+
+// Setup and start the runtime counter.
+__WEAK int32_t OS_Runtime_Setup (void) {
+
+  if (perf_init() != 0) {
+    return (-1);
+  }
+  RuntimeSwitch = perf_cycles64();
+
+  return (0);
+}
+
+// Get runtime counter frequency.
+__WEAK uint32_t OS_Runtime_GetFreq (void) {
+  return (SystemCoreClock);
+}
+
+// Get runtime counter value extended to 64 bits.
+__WEAK uint64_t OS_Runtime_GetCount (void) {
+  return (perf_cycles64());
+}
+
+// Account the execution time since the previous thread switch.
+__WEAK void OS_Runtime_Switch (uint64_t *runtime) {
+  uint64_t count = OS_Runtime_GetCount();
+
+  if (runtime != NULL) {
+    *runtime += count - RuntimeSwitch;
+  }
+  RuntimeSwitch = count;
+}
+
+// Get the execution time since the last thread switch.
+__WEAK uint64_t OS_Runtime_GetElapsed (void) {
+  return (OS_Runtime_GetCount() - RuntimeSwitch);
+}
+
+#else
+
+// No cycle counter: runtime accounting is not available.
+__WEAK int32_t OS_Runtime_Setup (void) {
+  return (-1);
+}
+
+__WEAK uint32_t OS_Runtime_GetFreq (void) {
+  return (0U);
+}
+
+__WEAK uint64_t OS_Runtime_GetCount (void) {
+  return (0U);
+}
+
+__WEAK void OS_Runtime_Switch (uint64_t *runtime) {
+  (void)runtime;
+}
+
+__WEAK uint64_t OS_Runtime_GetElapsed (void) {
+  return (0U);
+}
+
+#endif
@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_systick.c
  * @brief    CMSIS OS Tick SysTick implementation
- * @version  V1.0.5
- * @date     16. October 2023
+ * @version  V1.1.0
+ * @date     17. October 2024
  ******************************************************************************/
 /*
- * Copyright (c) 2017-2023 ARM Limited. All rights reserved.
+ * Copyright (c) 2017-2024 ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -34,7 +34,118 @@
 #define SYSTICK_IRQ_PRIORITY    0xFFU
 #endif
 
-static uint8_t PendST __attribute__((section(".bss.os")));
+// Minimum cycles between a one-shot event and the next tick (covers the interrupt latency)
+#ifndef SYSTICK_ONESHOT_MARGIN
+#define SYSTICK_ONESHOT_MARGIN  1000U
+#endif
+
+static uint8_t  PendST   __attribute__((section(".bss.os")));
+
+// Tickless idle: periodic reload value, programmed ticks and pending tick
+static uint32_t TickLoad __attribute__((section(".bss.os")));
+static uint32_t TickNext __attribute__((section(".bss.os")));
+static uint8_t  TickPend __attribute__((section(".bss.os")));
+
+// One-shot event: state (0: none, 1: programmed, 2: rest of the tick period), tick period cycles elapsed
+// at the start of the current counter period, reload value of the current counter period and tick period
+// cycles after the event
+static uint8_t  OneShot     __attribute__((section(".bss.os")));
+static uint32_t OneShotBase __attribute__((section(".bss.os")));
+static uint32_t OneShotLoad __attribute__((section(".bss.os")));
+static uint32_t OneShotRest __attribute__((section(".bss.os")));
+
+// Timestamp: timer cycles at the start of the current tick period, timestamp while a tickless idle event is
+// programmed, sequence counter (odd while the time base is changed), number of counter wraps taken over
+// into the time base (never 0) and unprocessed counter wrap whose COUNTFLAG was cleared by a read (TickGen)
+static uint64_t          TickTime  __attribute__((section(".bss.os")));
+static uint64_t          TickStamp __attribute__((section(".bss.os")));
+static volatile uint32_t TickSeq   __attribute__((section(".bss.os")));
+static volatile uint32_t TickGen   __attribute__((section(".bss.os")));
+static volatile uint32_t TickWrap  __attribute__((section(".bss.os")));
+
+// Begin update of the time base (interrupts disabled).
+static uint32_t TimeUpdateBegin (void) {
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  TickSeq++;
+  __DMB();
+  return (primask);
+}
+
+// End update of the time base.
+static void TimeUpdateEnd (uint32_t primask) {
+  __DMB();
+  TickSeq++;
+  __set_PRIMASK(primask);
+}
+
+// Take over counter wraps into the time base (time base update).
+static void TimeWrapProcessed (void) {
+  TickGen++;
+  if (TickGen == 0U) {
+    TickGen = 1U;
+  }
+  TickWrap = 0U;
+}
+
+// Read SysTick CTRL and keep a counter wrap for OS_Tick_GetTimestamp64.
+static uint32_t SysTick_GetCtrl (void) {
+  uint32_t ctrl = SysTick->CTRL;
+
+  if ((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U) {
+    TickWrap = TickGen;
+  }
+  return (ctrl);
+}
+
+// Start SysTick with a single period of (load + 1) cycles followed by periods of (reload + 1) cycles.
+static void SysTick_StartOnce (uint32_t load, uint32_t reload) {
+
+  SysTick->LOAD  = load;
+  SysTick->VAL   = 0U;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+  // The reload value is taken over on the first clock: set the following reload value
+  while (SysTick->VAL == 0U) {
+    __NOP();
+  }
+  SysTick->LOAD  = reload;
+}
+
+// Get timer cycles since OS_Tick_Setup from the time base and the counter.
+static uint64_t SysTick_GetTime (void) {
+  uint32_t val;
+  uint32_t base;
+  uint32_t load;
+  uint8_t  state;
+
+  // Counter wrap not taken over into the time base: the pending bit is cleared on entry of the SysTick
+  // handler, COUNTFLAG when the handler acknowledges the tick
+  val = SysTick->VAL;
+  if (((SysTick_GetCtrl() & SysTick_CTRL_COUNTFLAG_Msk) != 0U) || (TickWrap == TickGen) ||
+      (PendST != 0U) || ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)) {
+    // Counter runs in the next counter period
+    val   = SysTick->VAL;
+    state = OneShot;
+    if (state == 1U) {
+      base = OneShotBase + OneShotLoad + 1U;
+      load = OneShotRest - 1U;
+    } else {
+      base = TickLoad + 1U;
+      load = TickLoad;
+    }
+  } else {
+    state = OneShot;
+    base  = (state != 0U) ? OneShotBase : 0U;
+    load  = (state != 0U) ? OneShotLoad : TickLoad;
+  }
+  if (val != 0U) {
+    base += (load - val) + 1U;
+  }
+
+  return (TickTime + base);
+}
 
 // Setup OS Tick.
 __WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
@@ -72,7 +183,12 @@ __WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
   SysTick->LOAD =  load;
   SysTick->VAL  =  0U;
 
-  PendST = 0U;
+  PendST   = 0U;
+  TickLoad = load;
+  TickNext = 0U;
+  OneShot  = 0U;
+  TickTime = 0U;
+  TimeWrapProcessed();
 
   return (0);
 }
@@ -85,13 +201,13 @@ __WEAK void OS_Tick_Enable (void) {
     SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
   }
 
-  SysTick->CTRL |=  SysTick_CTRL_ENABLE_Msk;
+  SysTick->CTRL  = SysTick_GetCtrl() | SysTick_CTRL_ENABLE_Msk;
 }
 
 /// Disable OS Tick.
 __WEAK void OS_Tick_Disable (void) {
 
-  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  SysTick->CTRL  = SysTick_GetCtrl() & ~SysTick_CTRL_ENABLE_Msk;
 
   if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U) {
     SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
@@ -101,7 +217,13 @@ __WEAK void OS_Tick_Disable (void) {
 
 // Acknowledge OS Tick IRQ.
 __WEAK void OS_Tick_AcknowledgeIRQ (void) {
+  uint32_t primask = TimeUpdateBegin();
+
   (void)SysTick->CTRL;
+  TickTime += (uint64_t)TickLoad + 1U;
+  TimeWrapProcessed();
+
+  TimeUpdateEnd(primask);
 }
 
 // Get OS Tick IRQ number.
@@ -116,19 +238,41 @@ __WEAK uint32_t OS_Tick_GetClock (void) {
 
 // Get OS Tick interval.
 __WEAK uint32_t OS_Tick_GetInterval (void) {
-  return (SysTick->LOAD + 1U);
+  return (TickLoad + 1U);
 }
 
 // Get OS Tick count value.
 __WEAK uint32_t OS_Tick_GetCount (void) {
   uint32_t val;
   uint32_t count;
+  uint32_t base;
+  uint32_t load;
 
   val = SysTick->VAL;
+
+  if (OneShot == 0U) {
+    if (val != 0U) {
+      count = (SysTick->LOAD - val) + 1U;
+    } else {
+      count = 0U;
+    }
+    //lint -e{904} "Return statement before end of function"
+    return (count);
+  }
+
+  // Tick period is split by a one-shot event
+  base = OneShotBase;
+  load = OneShotLoad;
+  if ((OneShot == 1U) && ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)) {
+    // Event expired (interrupt pending): counter runs in the rest of the tick period
+    val   = SysTick->VAL;
+    base += load + 1U;
+    load  = OneShotRest - 1U;
+  }
   if (val != 0U) {
-    count = (SysTick->LOAD - val) + 1U;
+    count = base + (load - val) + 1U;
   } else {
-    count = 0U;
+    count = (base + load + 1U) % (TickLoad + 1U);
   }
 
   return (count);
@@ -136,7 +280,220 @@ __WEAK uint32_t OS_Tick_GetCount (void) {
 
 // Get OS Tick overflow status.
 __WEAK uint32_t OS_Tick_GetOverflow (void) {
+  if (OneShot == 1U) {
+    // Pending interrupt is the one-shot event
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
   return ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) >> SCB_ICSR_PENDSTSET_Pos);
 }
 
+// Program next OS Tick event (tickless idle).
+__WEAK uint32_t OS_Tick_SetNextEvent (uint32_t ticks) {
+  uint32_t period;
+  uint32_t val;
+  uint32_t primask;
+
+  period = TickLoad + 1U;
+  if ((ticks == 0U) || (TickNext != 0U) || (OneShot != 0U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  // Limit to the 24-bit counter range (longer periods are chained by the caller)
+  if (ticks > (0x01000000U / period)) {
+    ticks = 0x01000000U / period;
+  }
+
+  // Timestamp does not advance until OS_Tick_GetElapsed
+  primask   = TimeUpdateBegin();
+  TickStamp = SysTick_GetTime();
+
+  OS_Tick_Disable();
+
+  // Tick that expired before suspend is reported as elapsed
+  TickPend = PendST;
+  PendST   = 0U;
+
+  // Cycles remaining in the current tick period
+  val = SysTick->VAL;
+  if (val == 0U) {
+    val = period;
+  } else if (val == 1U) {
+    // Tick boundary is reached while programming
+    TickPend++;
+    val = period;
+  } else {
+    // Counter is stopped in the current tick period
+  }
+
+  // Expire at a tick boundary and continue with periodic ticks
+  SysTick_StartOnce((val - 1U) + ((ticks - 1U) * period), TickLoad);
+
+  TickNext = ticks;
+
+  TimeUpdateEnd(primask);
+
+  return (ticks);
+}
+
+// Get elapsed OS Ticks since OS_Tick_SetNextEvent (tickless idle).
+__WEAK uint32_t OS_Tick_GetElapsed (void) {
+  uint32_t period;
+  uint32_t ctrl;
+  uint32_t val;
+  uint32_t ticks;
+  uint32_t primask;
+
+  if (TickNext == 0U) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  primask = TimeUpdateBegin();
+
+  period = TickLoad + 1U;
+  ticks  = TickNext;
+
+  ctrl = SysTick->CTRL;
+  if ((ctrl & SysTick_CTRL_COUNTFLAG_Msk) == 0U) {
+    SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+    val = SysTick->VAL;
+    if (((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) == 0U) && (val != 0U)) {
+      // Woken up before the event: count completed ticks and restore the tick phase
+      ticks -= (val + (period - 1U)) / period;
+      val    = ((val - 1U) % period) + 1U;
+      if (val == 1U) {
+        // Tick boundary is reached while reprogramming
+        ticks++;
+        val = period;
+      }
+      SysTick_StartOnce(val - 1U, TickLoad);
+    } else {
+      SysTick->CTRL = ctrl | SysTick_CTRL_ENABLE_Msk;
+    }
+  }
+
+  // Elapsed ticks are reported to the kernel instead of the tick interrupt
+  SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+
+  ticks   += TickPend;
+  TickPend = 0U;
+  TickNext = 0U;
+
+  TickTime += (uint64_t)ticks * period;
+  TimeWrapProcessed();
+
+  TimeUpdateEnd(primask);
+
+  return (ticks);
+}
+
+// Program one-shot OS Tick event (sub-tick event).
+__WEAK int32_t OS_Tick_SetOneShot (uint32_t cycles) {
+  uint32_t val;
+  uint32_t elapsed;
+  uint32_t rest;
+  uint32_t primask;
+
+  if ((cycles == 0U) || (TickNext != 0U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  // SysTick does not count with a reload value of 0
+  if (cycles < 2U) {
+    cycles = 2U;
+  }
+
+  primask = TimeUpdateBegin();
+
+  OS_Tick_Disable();
+
+  if (PendST != 0U) {
+    // Tick or one-shot event expired and is processed first
+    OS_Tick_Enable();
+    TimeUpdateEnd(primask);
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  // Cycles of the tick period elapsed and remaining
+  val = SysTick->VAL;
+  if ((OneShot == 1U) && (val != 0U) && (cycles >= val)) {
+    // Programmed event expires earlier and is kept
+    OS_Tick_Enable();
+    TimeUpdateEnd(primask);
+    //lint -e{904} "Return statement before end of function"
+    return (0);
+  }
+  if (OneShot == 0U) {
+    elapsed = (val != 0U) ? ((TickLoad - val) + 1U) : 0U;
+  } else {
+    elapsed = OneShotBase + ((val != 0U) ? ((OneShotLoad - val) + 1U) : 0U);
+  }
+  rest = (TickLoad + 1U) - elapsed;
+
+  // Event must expire before the next tick, with time left to take over the reload value
+  if ((cycles >= rest) || ((rest - cycles) < SYSTICK_ONESHOT_MARGIN)) {
+    OS_Tick_Enable();
+    TimeUpdateEnd(primask);
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  // Split the tick period: event after cycles, counter continues with the rest of the period
+  OneShot     = 1U;
+  OneShotBase = elapsed;
+  OneShotLoad = cycles - 1U;
+  OneShotRest = rest - cycles;
+  SysTick_StartOnce(cycles - 1U, OneShotRest - 1U);
+
+  TimeUpdateEnd(primask);
+
+  return (0);
+}
+
+// Check for one-shot OS Tick event (sub-tick event).
+__WEAK uint32_t OS_Tick_GetOneShot (void) {
+  uint32_t primask;
+
+  if (OneShot != 1U) {
+    // Tick: the next tick period is not split
+    OneShot = 0U;
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  primask = TimeUpdateBegin();
+
+  // Event expired: the counter runs in the rest of the tick period, followed by periodic ticks
+  SysTick->LOAD = TickLoad;
+  (void)SysTick->CTRL;
+  OneShotBase  += OneShotLoad + 1U;
+  OneShotLoad   = OneShotRest - 1U;
+  OneShot       = 2U;
+  TimeWrapProcessed();
+
+  TimeUpdateEnd(primask);
+
+  return (1U);
+}
+
+// Get 64-bit OS Tick timestamp.
+__WEAK uint64_t OS_Tick_GetTimestamp64 (void) {
+  uint64_t time;
+  uint32_t seq;
+
+  // Repeated when the time base is changed by an interrupt (or on another processor) meanwhile
+  do {
+    seq = TickSeq;
+    __DMB();
+    time = (TickNext != 0U) ? TickStamp : SysTick_GetTime();
+    __DMB();
+  } while (((seq & 1U) != 0U) || (seq != TickSeq));
+
+  return (time);
+}
+
 #endif  // SysTick
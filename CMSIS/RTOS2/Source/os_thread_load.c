@@ -0,0 +1,163 @@
+/**************************************************************************//**
+ * @file     os_thread_load.c
+ * @brief    CMSIS OS Thread Load implementation
+ * @version  V1.0.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include "os_thread_load.h"
+
+#define HISTORY_SIZE            (OS_THREAD_LOAD_WINDOW + 1U)
+
+// Check if a thread ID is contained in an ID array.
+static uint32_t ThreadIdFound (const osThreadId_t *id, uint32_t count, osThreadId_t thread_id) {
+  uint32_t n;
+
+  for (n = 0U; n < count; n++) {
+    if (id[n] == thread_id) {
+      return (1U);
+    }
+  }
+  return (0U);
+}
+
+// Calculate load in 0.1 % units.
+static uint32_t LoadCalc (uint64_t time, uint64_t span) {
+
+  if (span == 0U) {
+    return (0U);
+  }
+  if (time >= span) {
+    return (1000U);
+  }
+  return ((uint32_t)((time * 1000U) / span));
+}
+
+// Initialize thread load measurement.
+int32_t OS_ThreadLoad_Init (OS_ThreadLoad_t *info, OS_ThreadLoad_Entry_t *entry, osThreadId_t *id_buf, uint32_t max) {
+  uint64_t idle;
+  uint32_t n;
+
+  if ((info == NULL) || (entry == NULL) || (id_buf == NULL) || (max == 0U)) {
+    return (-1);
+  }
+
+  info->entry     = entry;
+  info->id_buf    = id_buf;
+  info->max       = max;
+  info->count     = 0U;
+  info->idle_load = 0U;
+  info->index     = 0U;
+  info->samples   = 0U;
+
+  idle = osKernelGetIdleRuntime();
+  for (n = 0U; n < HISTORY_SIZE; n++) {
+    info->idle[n]  = idle;
+    info->total[n] = 0U;
+  }
+
+  return (0);
+}
+
+// Take a sample and update the thread loads over the sliding window.
+uint32_t OS_ThreadLoad_Update (OS_ThreadLoad_t *info) {
+  OS_ThreadLoad_Entry_t *entry;
+  osThreadId_t          *id;
+  uint64_t               runtime;
+  uint64_t               delta;
+  uint64_t               span;
+  uint32_t               id_count;
+  uint32_t               curr, prev, first;
+  uint32_t               i, j, n;
+
+  if ((info == NULL) || (info->entry == NULL)) {
+    return (0U);
+  }
+  entry = info->entry;
+  id    = info->id_buf;
+
+  id_count = osThreadEnumerate(id, info->max);
+
+  // Remove entries of terminated threads
+  j = 0U;
+  for (i = 0U; i < info->count; i++) {
+    if (ThreadIdFound(id, id_count, entry[i].thread_id) != 0U) {
+      if (i != j) {
+        entry[j] = entry[i];
+      }
+      j++;
+    }
+  }
+  info->count = j;
+
+  // Add entries for new threads (execution time is accounted from now on)
+  for (i = 0U; (i < id_count) && (info->count < info->max); i++) {
+    for (j = 0U; j < info->count; j++) {
+      if (entry[j].thread_id == id[i]) {
+        break;
+      }
+    }
+    if (j == info->count) {
+      runtime = osThreadGetRuntime(id[i]);
+      entry[j].thread_id = id[i];
+      entry[j].load      = 0U;
+      for (n = 0U; n < HISTORY_SIZE; n++) {
+        entry[j].runtime[n] = runtime;
+      }
+      info->count++;
+    }
+  }
+
+  // Record the new sample
+  curr = info->index;
+  prev = (curr + HISTORY_SIZE - 1U) % HISTORY_SIZE;
+
+  info->idle[curr] = osKernelGetIdleRuntime();
+  delta = info->idle[curr] - info->idle[prev];
+  for (i = 0U; i < info->count; i++) {
+    runtime = osThreadGetRuntime(entry[i].thread_id);
+    if (runtime < entry[i].runtime[prev]) {
+      // Thread ID reused by a new thread: restart its history
+      for (n = 0U; n < HISTORY_SIZE; n++) {
+        entry[i].runtime[n] = runtime;
+      }
+    }
+    entry[i].runtime[curr] = runtime;
+    delta += entry[i].runtime[curr] - entry[i].runtime[prev];
+  }
+  info->total[curr] = info->total[prev] + delta;
+
+  if (info->samples < HISTORY_SIZE) {
+    info->samples++;
+  }
+  info->index = (curr + 1U) % HISTORY_SIZE;
+
+  // Calculate load between the oldest and the newest sample in the window
+  first = (curr + HISTORY_SIZE - (info->samples - 1U)) % HISTORY_SIZE;
+  span  = info->total[curr] - info->total[first];
+
+  info->idle_load = LoadCalc(info->idle[curr] - info->idle[first], span);
+  for (i = 0U; i < info->count; i++) {
+    entry[i].load = LoadCalc(entry[i].runtime[curr] - entry[i].runtime[first], span);
+  }
+
+  return (info->count);
+}
@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_tick_gtim.c
  * @brief    CMSIS OS Tick implementation for Generic Timer
- * @version  V1.0.1
- * @date     24. November 2017
+ * @version  V1.1.0
+ * @date     17. October 2024
  ******************************************************************************/
 /*
- * Copyright (c) 2017 ARM Limited. All rights reserved.
+ * Copyright (c) 2017-2024 ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -36,6 +36,11 @@
 #define GTIM_IRQ_NUM                SecurePhyTimer_IRQn
 #endif
 
+// Minimum cycles between a one-shot event and the next tick
+#ifndef GTIM_ONESHOT_MARGIN
+#define GTIM_ONESHOT_MARGIN         100U
+#endif
+
 // Timer interrupt pending flag
 static uint8_t GTIM_PendIRQ;
 
@@ -45,6 +50,18 @@ static uint32_t GTIM_Clock;
 // Timer load value
 static uint32_t GTIM_Load;
 
+// Ticks programmed by OS_Tick_SetNextEvent
+static uint32_t GTIM_Next;
+
+// Compare value of the first tick not processed before OS_Tick_SetNextEvent
+static uint64_t GTIM_Start;
+
+// One-shot event programmed by OS_Tick_SetOneShot
+static uint8_t GTIM_OneShot;
+
+// Compare value of the next tick while a one-shot event is programmed
+static uint64_t GTIM_Tick;
+
 // Setup OS Tick.
 int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
   uint32_t prio, bits;
@@ -67,6 +84,8 @@ int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
 
   // Calculate load value
   GTIM_Load = (GTIM_Clock / freq) - 1U;
+  GTIM_Next = 0U;
+  GTIM_OneShot = 0U;
 
   // Disable Generic Timer and set load value
   PL1_SetControl(0U);
@@ -176,12 +195,127 @@ uint32_t OS_Tick_GetInterval (void) {
 
 // Get OS Tick count value.
 uint32_t OS_Tick_GetCount (void) {
+  if (GTIM_OneShot != 0U) {
+    // Compare value holds the one-shot event
+    return (GTIM_Load - (uint32_t)(GTIM_Tick - PL1_GetCurrentPhysicalValue()));
+  }
   return (GTIM_Load - PL1_GetCurrentValue());
 }
 
 // Get OS Tick overflow status.
 uint32_t OS_Tick_GetOverflow (void) {
   CNTP_CTL_Type cntp_ctl;
+
+  if (GTIM_OneShot != 0U) {
+    return ((PL1_GetCurrentPhysicalValue() >= GTIM_Tick) ? 1U : 0U);
+  }
   cntp_ctl.w = PL1_GetControl();
   return (cntp_ctl.b.ISTATUS);
 }
+
+// Program next OS Tick event (tickless idle).
+uint32_t OS_Tick_SetNextEvent (uint32_t ticks) {
+  uint64_t period = (uint64_t)GTIM_Load + 1U;
+
+  if ((ticks == 0U) || (GTIM_Next != 0U) || (GTIM_OneShot != 0U)) {
+    return (0U);
+  }
+
+  OS_Tick_Disable();
+
+  // Compare value holds the next tick (or the pending tick when expired)
+  GTIM_Start   = PL1_GetPhysicalCompareValue();
+  GTIM_PendIRQ = 0U;
+
+  // 64-bit compare value: no range limit
+  PL1_SetPhysicalCompareValue(GTIM_Start + ((uint64_t)(ticks - 1U) * period));
+  OS_Tick_Enable();
+
+  GTIM_Next = ticks;
+
+  return (ticks);
+}
+
+// Get elapsed OS Ticks since OS_Tick_SetNextEvent (tickless idle).
+uint32_t OS_Tick_GetElapsed (void) {
+  uint64_t period = (uint64_t)GTIM_Load + 1U;
+  uint64_t count;
+  uint32_t ticks;
+
+  if (GTIM_Next == 0U) {
+    return (0U);
+  }
+  GTIM_Next = 0U;
+
+  // Count ticks passed since the first programmed tick
+  count = PL1_GetCurrentPhysicalValue();
+  if (count < GTIM_Start) {
+    ticks = 0U;
+  } else {
+    ticks = (uint32_t)((count - GTIM_Start) / period) + 1U;
+  }
+
+  // Continue periodic ticks in phase
+  PL1_SetPhysicalCompareValue(GTIM_Start + ((uint64_t)ticks * period));
+  IRQ_ClearPending(GTIM_IRQ_NUM);
+
+  return (ticks);
+}
+
+// Program one-shot OS Tick event (sub-tick event).
+int32_t OS_Tick_SetOneShot (uint32_t cycles) {
+  uint64_t time;
+  uint64_t tick;
+
+  if ((cycles == 0U) || (GTIM_Next != 0U)) {
+    return (-1);
+  }
+
+  time = PL1_GetCurrentPhysicalValue() + cycles;
+
+  if (GTIM_OneShot != 0U) {
+    if (time >= PL1_GetPhysicalCompareValue()) {
+      // Programmed event expires earlier and is kept
+      return (0);
+    }
+    tick = GTIM_Tick;
+  } else {
+    tick = PL1_GetPhysicalCompareValue();
+  }
+
+  // Event must expire before the next tick
+  if ((time + GTIM_ONESHOT_MARGIN) > tick) {
+    return (-1);
+  }
+
+  GTIM_Tick    = tick;
+  GTIM_OneShot = 1U;
+  PL1_SetPhysicalCompareValue(time);
+
+  return (0);
+}
+
+// Check for one-shot OS Tick event (sub-tick event).
+uint32_t OS_Tick_GetOneShot (void) {
+
+  if (GTIM_OneShot == 0U) {
+    return (0U);
+  }
+  GTIM_OneShot = 0U;
+
+  // Restore the compare value of the next tick
+  PL1_SetPhysicalCompareValue(GTIM_Tick);
+  IRQ_ClearPending(GTIM_IRQ_NUM);
+
+  if (PL1_GetCurrentPhysicalValue() >= GTIM_Tick) {
+    // Tick expired as well
+    return (0U);
+  }
+  return (1U);
+}
+
+// Get 64-bit OS Tick timestamp.
+uint64_t OS_Tick_GetTimestamp64 (void) {
+  // Physical counter (CNTPCT) is 64-bit and common to all processors
+  return (PL1_GetCurrentPhysicalValue());
+}
@@ -0,0 +1,389 @@
+/**************************************************************************//**
+ * @file     os_tick_posix.c
+ * @brief    CMSIS OS Tick implementation for POSIX hosts
+ * @version  V1.1.0
+ * @date     17. October 2024
+ ******************************************************************************/
+/*
+ * Copyright (c) 2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os_tick.h"
+
+#include <pthread.h>
+#include <time.h>
+
+// Timer clock: CLOCK_MONOTONIC in nanoseconds
+#ifndef PTICK_CLOCK
+#define PTICK_CLOCK                 1000000000U
+#endif
+
+// Host thread that emulates the timer interrupt
+static pthread_t       PTICK_Thread;
+static pthread_mutex_t PTICK_Mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  PTICK_Cond;
+
+// Timer interrupt handler
+static IRQHandler_t PTICK_Handler;
+
+// Timer interrupt pending flag
+static uint8_t  PTICK_PendIRQ;
+
+// Timer enable flag
+static uint8_t  PTICK_Enabled;
+
+// Timer thread started flag
+static uint8_t  PTICK_Started;
+
+// Timer load value
+static uint32_t PTICK_Load;
+
+// Start of the current timer period (enabled) or elapsed count (disabled)
+static uint64_t PTICK_Base;
+
+// Ticks programmed by OS_Tick_SetNextEvent
+static uint32_t PTICK_Next;
+
+// Tick expired before OS_Tick_SetNextEvent
+static uint32_t PTICK_PendTick;
+
+// Start of the timer period at OS_Tick_SetNextEvent
+static uint64_t PTICK_Start;
+
+// One-shot event time (0: none)
+static uint64_t PTICK_OneShot;
+
+// Get monotonic host time in timer clock units.
+static uint64_t PTICK_GetTime (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Wait for a timer state change or until deadline (mutex held).
+static void PTICK_WaitUntil (uint64_t deadline) {
+  struct timespec ts;
+#if defined(__APPLE__)
+  uint64_t now;
+
+  now = PTICK_GetTime();
+  deadline = (deadline > now) ? (deadline - now) : 0U;
+  ts.tv_sec  = (time_t)(deadline / 1000000000U);
+  ts.tv_nsec = (long)  (deadline % 1000000000U);
+  (void)pthread_cond_timedwait_relative_np(&PTICK_Cond, &PTICK_Mutex, &ts);
+#else
+  ts.tv_sec  = (time_t)(deadline / 1000000000U);
+  ts.tv_nsec = (long)  (deadline % 1000000000U);
+  (void)pthread_cond_timedwait(&PTICK_Cond, &PTICK_Mutex, &ts);
+#endif
+}
+
+// Timer interrupt emulation thread.
+static void *PTICK_ThreadFunc (void *arg) {
+  uint64_t deadline;
+  (void)arg;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+  for (;;) {
+    while ((PTICK_Enabled == 0U) && (PTICK_PendIRQ == 0U)) {
+      (void)pthread_cond_wait(&PTICK_Cond, &PTICK_Mutex);
+    }
+    if (PTICK_Enabled == 0U) {
+      // Disabled with a pending period: keep it pending until enabled
+      (void)pthread_cond_wait(&PTICK_Cond, &PTICK_Mutex);
+      continue;
+    }
+
+    // Deadline changes (tickless idle, one-shot event) wake up the wait
+    deadline = PTICK_Base + PTICK_Load + 1U;
+    if ((PTICK_OneShot != 0U) && (PTICK_OneShot < deadline)) {
+      deadline = PTICK_OneShot;
+    }
+    if (PTICK_GetTime() < deadline) {
+      PTICK_WaitUntil(deadline);
+      continue;
+    }
+
+    // Period elapsed: execute interrupt handler (acknowledges the period)
+    (void)pthread_mutex_unlock(&PTICK_Mutex);
+    PTICK_Handler();
+    (void)pthread_mutex_lock(&PTICK_Mutex);
+  }
+
+  return (NULL);
+}
+
+// Setup OS Tick.
+__attribute__((weak)) int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
+  pthread_condattr_t attr;
+  uint32_t load;
+
+  if ((freq == 0U) || (handler == NULL)) {
+    return (-1);
+  }
+
+  load = (PTICK_CLOCK / freq) - 1U;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  PTICK_Handler = handler;
+  PTICK_Load    = load;
+  PTICK_Enabled = 0U;
+  PTICK_PendIRQ = 0U;
+  PTICK_Base    = 0U;
+  PTICK_Next    = 0U;
+  PTICK_OneShot = 0U;
+
+  if (PTICK_Started == 0U) {
+    // Timed waits use CLOCK_MONOTONIC
+    (void)pthread_condattr_init(&attr);
+#if !defined(__APPLE__)
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+    (void)pthread_cond_init(&PTICK_Cond, &attr);
+    (void)pthread_condattr_destroy(&attr);
+    if (pthread_create(&PTICK_Thread, NULL, PTICK_ThreadFunc, NULL) != 0) {
+      (void)pthread_mutex_unlock(&PTICK_Mutex);
+      return (-1);
+    }
+    (void)pthread_detach(PTICK_Thread);
+    PTICK_Started = 1U;
+  }
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return (0);
+}
+
+/// Enable OS Tick.
+__attribute__((weak)) void OS_Tick_Enable (void) {
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  if (PTICK_Enabled == 0U) {
+    // Continue counting from the value reached when disabled
+    PTICK_Base = PTICK_GetTime() - PTICK_Base;
+    if (PTICK_PendIRQ != 0U) {
+      PTICK_PendIRQ = 0U;
+      PTICK_Base   -= (uint64_t)PTICK_Load + 1U;
+    }
+    PTICK_Enabled = 1U;
+    (void)pthread_cond_signal(&PTICK_Cond);
+  }
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+}
+
+/// Disable OS Tick.
+__attribute__((weak)) void OS_Tick_Disable (void) {
+  uint64_t elapsed;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  if (PTICK_Enabled != 0U) {
+    PTICK_Enabled = 0U;
+    elapsed = PTICK_GetTime() - PTICK_Base;
+    // Remember pending interrupt flag
+    if (elapsed > PTICK_Load) {
+      elapsed -= (uint64_t)PTICK_Load + 1U;
+      PTICK_PendIRQ = 1U;
+    }
+    // Keep counter value while disabled
+    PTICK_Base = elapsed % ((uint64_t)PTICK_Load + 1U);
+  }
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+}
+
+// Acknowledge OS Tick IRQ.
+__attribute__((weak)) void OS_Tick_AcknowledgeIRQ (void) {
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+  if (PTICK_Enabled != 0U) {
+    PTICK_Base += (uint64_t)PTICK_Load + 1U;
+  }
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+}
+
+// Get OS Tick IRQ number.
+__attribute__((weak)) int32_t  OS_Tick_GetIRQn (void) {
+  return (-1);
+}
+
+// Get OS Tick clock.
+__attribute__((weak)) uint32_t OS_Tick_GetClock (void) {
+  return (PTICK_CLOCK);
+}
+
+// Get OS Tick interval.
+__attribute__((weak)) uint32_t OS_Tick_GetInterval (void) {
+  return (PTICK_Load + 1U);
+}
+
+// Get OS Tick count value.
+__attribute__((weak)) uint32_t OS_Tick_GetCount (void) {
+  uint64_t elapsed;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+  if (PTICK_Enabled != 0U) {
+    elapsed = PTICK_GetTime() - PTICK_Base;
+  } else {
+    elapsed = PTICK_Base;
+  }
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return ((uint32_t)(elapsed % ((uint64_t)PTICK_Load + 1U)));
+}
+
+// Get OS Tick overflow status.
+__attribute__((weak)) uint32_t OS_Tick_GetOverflow (void) {
+  uint32_t overflow;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+  if (PTICK_Enabled != 0U) {
+    overflow = ((PTICK_GetTime() - PTICK_Base) > PTICK_Load) ? 1U : 0U;
+  } else {
+    overflow = PTICK_PendIRQ;
+  }
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return (overflow);
+}
+
+// Program next OS Tick event (tickless idle).
+__attribute__((weak)) uint32_t OS_Tick_SetNextEvent (uint32_t ticks) {
+  uint64_t period;
+  uint32_t busy;
+
+  if (ticks == 0U) {
+    return (0U);
+  }
+
+  // Not possible while an event or a one-shot event is programmed
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+  busy = ((PTICK_Next != 0U) || (PTICK_OneShot != 0U)) ? 1U : 0U;
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+  if (busy != 0U) {
+    return (0U);
+  }
+
+  OS_Tick_Disable();
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  period = (uint64_t)PTICK_Load + 1U;
+
+  // Tick that expired before suspend is reported as elapsed
+  PTICK_PendTick = PTICK_PendIRQ;
+  PTICK_PendIRQ  = 0U;
+
+  // Continue the current timer period and extend it by (ticks - 1) periods
+  PTICK_Start   = PTICK_GetTime() - PTICK_Base;
+  PTICK_Base    = PTICK_Start + ((uint64_t)(ticks - 1U) * period);
+  PTICK_Next    = ticks;
+  PTICK_Enabled = 1U;
+  (void)pthread_cond_signal(&PTICK_Cond);
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return (ticks);
+}
+
+// Get elapsed OS Ticks since OS_Tick_SetNextEvent (tickless idle).
+__attribute__((weak)) uint32_t OS_Tick_GetElapsed (void) {
+  uint64_t period;
+  uint32_t ticks;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  if (PTICK_Next == 0U) {
+    (void)pthread_mutex_unlock(&PTICK_Mutex);
+    return (0U);
+  }
+
+  period = (uint64_t)PTICK_Load + 1U;
+
+  // Count completed periods and continue periodic ticks in phase
+  ticks          = (uint32_t)((PTICK_GetTime() - PTICK_Start) / period);
+  PTICK_Base     = PTICK_Start + ((uint64_t)ticks * period);
+  ticks         += PTICK_PendTick;
+  PTICK_PendTick = 0U;
+  PTICK_Next     = 0U;
+  (void)pthread_cond_signal(&PTICK_Cond);
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return (ticks);
+}
+
+// Program one-shot OS Tick event (sub-tick event).
+__attribute__((weak)) int32_t OS_Tick_SetOneShot (uint32_t cycles) {
+  uint64_t time;
+  int32_t  ret = -1;
+
+  if (cycles == 0U) {
+    return (-1);
+  }
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  if ((PTICK_Enabled != 0U) && (PTICK_Next == 0U)) {
+    time = PTICK_GetTime() + cycles;
+    // Event must expire before the next tick; an earlier event is kept
+    if (time <= (PTICK_Base + PTICK_Load)) {
+      if ((PTICK_OneShot == 0U) || (time < PTICK_OneShot)) {
+        PTICK_OneShot = time;
+        (void)pthread_cond_signal(&PTICK_Cond);
+      }
+      ret = 0;
+    }
+  }
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return (ret);
+}
+
+// Check for one-shot OS Tick event (sub-tick event).
+__attribute__((weak)) uint32_t OS_Tick_GetOneShot (void) {
+  uint64_t time;
+  uint32_t event = 0U;
+
+  (void)pthread_mutex_lock(&PTICK_Mutex);
+
+  if (PTICK_OneShot != 0U) {
+    time = PTICK_GetTime();
+    if (time >= PTICK_OneShot) {
+      PTICK_OneShot = 0U;
+      // Reported as one-shot event only when the tick period has not elapsed as well
+      if ((PTICK_Enabled != 0U) && ((time - PTICK_Base) <= PTICK_Load)) {
+        event = 1U;
+      }
+    }
+  }
+
+  (void)pthread_mutex_unlock(&PTICK_Mutex);
+
+  return (event);
+}
+
+// Get 64-bit OS Tick timestamp.
+__attribute__((weak)) uint64_t OS_Tick_GetTimestamp64 (void) {
+  // Monotonic host time is lock-free and common to all threads
+  return (PTICK_GetTime());
+}
@@ -1,11 +1,11 @@
 /**************************************************************************//**
  * @file     os_tick_ptim.c
  * @brief    CMSIS OS Tick implementation for Private Timer
- * @version  V1.0.2
- * @date     02. March 2018
+ * @version  V1.1.0
+ * @date     17. October 2024
  ******************************************************************************/
 /*
- * Copyright (c) 2017-2018 Arm Limited. All rights reserved.
+ * Copyright (c) 2017-2024 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -34,7 +34,53 @@
 #define PTIM_IRQ_PRIORITY           0xFFU
 #endif
 
-static uint8_t PTIM_PendIRQ;        // Timer interrupt pending flag
+// Minimum cycles between a one-shot event and the next tick
+#ifndef PTIM_ONESHOT_MARGIN
+#define PTIM_ONESHOT_MARGIN         100U
+#endif
+
+static uint8_t  PTIM_PendIRQ;       // Timer interrupt pending flag
+static uint8_t  PTIM_PendTick;      // Tick expired before OS_Tick_SetNextEvent
+static uint32_t PTIM_Next;          // Ticks programmed by OS_Tick_SetNextEvent
+static uint8_t  PTIM_OneShot;       // One-shot event programmed by OS_Tick_SetOneShot
+static uint32_t PTIM_OneShotRest;   // Tick period cycles after the one-shot event
+
+// Timestamp: timer cycles at the start of the current tick period, timestamp while a tickless idle event
+// is programmed and sequence counter (odd while the time base is changed)
+static uint64_t          PTIM_Time;
+static uint64_t          PTIM_Stamp;
+static volatile uint32_t PTIM_Seq;
+
+// Begin update of the time base (interrupts disabled).
+static uint32_t PTIM_TimeUpdateBegin (void) {
+  uint32_t cpsr = __get_CPSR();
+
+  __disable_irq();
+  PTIM_Seq++;
+  __DMB();
+  return (cpsr);
+}
+
+// End update of the time base.
+static void PTIM_TimeUpdateEnd (uint32_t cpsr) {
+  __DMB();
+  PTIM_Seq++;
+  if ((cpsr & CPSR_I_Msk) == 0U) {
+    __enable_irq();
+  }
+}
+
+// Get timer cycles since OS_Tick_Setup from the time base and the counter.
+static uint64_t PTIM_GetTime (void) {
+  uint32_t count;
+
+  // Event flag is set until the tick is acknowledged
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount() + PTIM_GetLoadValue() + 1U;
+  }
+  return (PTIM_Time + count);
+}
 
 // Setup OS Tick.
 int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
@@ -47,6 +93,10 @@ int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
   }
 
   PTIM_PendIRQ = 0U;
+  PTIM_Next    = 0U;
+  PTIM_OneShot = 0U;
+  PTIM_OneShotRest = 0U;
+  PTIM_Time    = 0U;
 
   // Private Timer runs with the system frequency
   load = (SystemCoreClock / freq) - 1U;
@@ -133,7 +183,12 @@ void OS_Tick_Disable (void) {
 
 // Acknowledge OS Tick IRQ.
 void OS_Tick_AcknowledgeIRQ (void) {
+  uint32_t cpsr = PTIM_TimeUpdateBegin();
+
   PTIM_ClearEventFlag();
+  PTIM_Time += (uint64_t)PTIM_GetLoadValue() + 1U;
+
+  PTIM_TimeUpdateEnd(cpsr);
 }
 
 // Get OS Tick IRQ number.
@@ -154,12 +209,197 @@ uint32_t OS_Tick_GetInterval (void) {
 // Get OS Tick count value.
 uint32_t OS_Tick_GetCount (void) {
   uint32_t load = PTIM_GetLoadValue();
-  return  (load - PTIM_GetCurrentValue());
+  uint32_t val  = PTIM_GetCurrentValue();
+
+  if (PTIM_OneShot != 0U) {
+    // Tick period is split by a one-shot event
+    if (PTIM_GetEventFlag() != 0U) {
+      // Event expired: counter reloaded at the event
+      return (((load + 1U) - PTIM_OneShotRest) + (load - PTIM_GetCurrentValue()));
+    }
+    return ((load - val) - PTIM_OneShotRest);
+  }
+  return  (load - val);
 }
 
 // Get OS Tick overflow status.
 uint32_t OS_Tick_GetOverflow (void) {
+  if (PTIM_OneShot != 0U) {
+    // Event flag belongs to the one-shot event
+    return (0U);
+  }
   return (PTIM->ISR & 1);
 }
 
+// Program next OS Tick event (tickless idle).
+uint32_t OS_Tick_SetNextEvent (uint32_t ticks) {
+  uint32_t period = PTIM_GetLoadValue() + 1U;
+  uint32_t max;
+  uint32_t cpsr;
+
+  if ((ticks == 0U) || (PTIM_Next != 0U) || (PTIM_OneShot != 0U)) {
+    return (0U);
+  }
+
+  // Limit to the 32-bit counter range (longer periods are chained by the caller)
+  max = ((0xFFFFFFFFU - period) / period) + 1U;
+  if (ticks > max) {
+    ticks = max;
+  }
+
+  // Timestamp does not advance until OS_Tick_GetElapsed
+  cpsr       = PTIM_TimeUpdateBegin();
+  PTIM_Stamp = PTIM_GetTime();
+
+  OS_Tick_Disable();
+
+  // Tick that expired before suspend is reported as elapsed
+  PTIM_PendTick = PTIM_PendIRQ;
+  PTIM_PendIRQ  = 0U;
+  PTIM_ClearEventFlag();
+
+  // Expire at a tick boundary, auto reload continues with periodic ticks
+  PTIM_SetCurrentValue(PTIM_GetCurrentValue() + ((ticks - 1U) * period));
+  OS_Tick_Enable();
+
+  PTIM_Next = ticks;
+
+  PTIM_TimeUpdateEnd(cpsr);
+
+  return (ticks);
+}
+
+// Get elapsed OS Ticks since OS_Tick_SetNextEvent (tickless idle).
+uint32_t OS_Tick_GetElapsed (void) {
+  uint32_t period = PTIM_GetLoadValue() + 1U;
+  uint32_t count;
+  uint32_t ticks;
+  uint32_t cpsr;
+
+  if (PTIM_Next == 0U) {
+    return (0U);
+  }
+
+  cpsr  = PTIM_TimeUpdateBegin();
+  ticks = PTIM_Next;
+  if (PTIM_GetEventFlag() == 0U) {
+    OS_Tick_Disable();
+    if (PTIM_GetEventFlag() == 0U) {
+      // Woken up before the event: count completed ticks and restore the tick phase
+      count  = PTIM_GetCurrentValue();
+      ticks -= (count / period) + 1U;
+      PTIM_SetCurrentValue(count % period);
+    }
+    PTIM_PendIRQ = 0U;
+    OS_Tick_Enable();
+  }
+
+  // Elapsed ticks are reported to the kernel instead of the tick interrupt
+  PTIM_ClearEventFlag();
+  IRQ_ClearPending(PrivTimer_IRQn);
+
+  ticks        += PTIM_PendTick;
+  PTIM_PendTick = 0U;
+  PTIM_Next     = 0U;
+
+  PTIM_Time += (uint64_t)ticks * period;
+
+  PTIM_TimeUpdateEnd(cpsr);
+
+  return (ticks);
+}
+
+// Program one-shot OS Tick event (sub-tick event).
+int32_t OS_Tick_SetOneShot (uint32_t cycles) {
+  uint32_t count;
+  uint32_t rest;
+  uint32_t cpsr;
+  int32_t  ret;
+
+  if ((cycles == 0U) || (PTIM_Next != 0U)) {
+    return (-1);
+  }
+
+  cpsr = PTIM_TimeUpdateBegin();
+
+  OS_Tick_Disable();
+
+  count = PTIM_GetCurrentValue();
+  rest  = count + 1U + PTIM_OneShotRest;
+
+  if ((PTIM_PendIRQ != 0U) || (PTIM_GetEventFlag() != 0U)) {
+    // Tick or one-shot event expired and is processed first
+    ret = -1;
+  } else if ((PTIM_OneShot != 0U) && (cycles > count)) {
+    // Programmed event expires earlier and is kept
+    ret = 0;
+  } else if ((cycles >= rest) || ((rest - cycles) < PTIM_ONESHOT_MARGIN)) {
+    // Event must expire before the next tick
+    ret = -1;
+  } else {
+    // Split the tick period: event after cycles, the rest of the period follows
+    PTIM_OneShotRest = rest - cycles;
+    PTIM_OneShot     = 1U;
+    PTIM_SetCurrentValue(cycles - 1U);
+    ret = 0;
+  }
+
+  OS_Tick_Enable();
+
+  PTIM_TimeUpdateEnd(cpsr);
+
+  return (ret);
+}
+
+// Check for one-shot OS Tick event (sub-tick event).
+uint32_t OS_Tick_GetOneShot (void) {
+  uint32_t load;
+  uint32_t late;
+  uint32_t event;
+  uint32_t cpsr;
+
+  if (PTIM_OneShot == 0U) {
+    return (0U);
+  }
+
+  cpsr = PTIM_TimeUpdateBegin();
+
+  PTIM_OneShot = 0U;
+
+  // Counter was reloaded at the event: continue with the rest of the tick period
+  load = PTIM_GetLoadValue();
+  late = load - PTIM_GetCurrentValue();
+  if (late < PTIM_OneShotRest) {
+    PTIM_ClearEventFlag();
+    PTIM_SetCurrentValue(PTIM_OneShotRest - 1U - late);
+    event = 1U;
+  } else {
+    // Tick period elapsed as well: continue in phase with periodic ticks, the event flag is cleared by
+    // OS_Tick_AcknowledgeIRQ
+    PTIM_SetCurrentValue(load - (late - PTIM_OneShotRest));
+    event = 0U;
+  }
+  PTIM_OneShotRest = 0U;
+
+  PTIM_TimeUpdateEnd(cpsr);
+
+  return (event);
+}
+
+// Get 64-bit OS Tick timestamp.
+uint64_t OS_Tick_GetTimestamp64 (void) {
+  uint64_t time;
+  uint32_t seq;
+
+  // Repeated when the time base is changed by an interrupt meanwhile
+  do {
+    seq = PTIM_Seq;
+    __DMB();
+    time = (PTIM_Next != 0U) ? PTIM_Stamp : PTIM_GetTime();
+    __DMB();
+  } while (((seq & 1U) != 0U) || (seq != PTIM_Seq));
+
+  return (time);
+}
+
 #endif  // PTIM
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * $Revision:   V1.0.0
+ *
+ * Project:     CMSIS-RTOS2
+ * Title:       OS Trace binary event ring buffer
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include "os_trace.h"
+#include "cmsis_os2.h"
+
+#if defined(_RTE_)
+//lint -emacro((923,9078),DCB,DWT) "cast from unsigned long to pointer"
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "cmsis_perf.h"
+#endif
+
+// Timestamp counter: cycle counter of cmsis_perf.h on targets, monotonic clock (100 ns) on POSIX
+// hosts and OS Tick timestamp on targets without a cycle counter. A different counter is defined
+// with OS_TRACE_TIMESTAMP() and OS_TRACE_TIMESTAMP_FREQ.
+#ifndef OS_TRACE_TIMESTAMP
+#if   defined(CMSIS_PERF_BACKEND) && (CMSIS_PERF_BACKEND != CMSIS_PERF_BACKEND_NONE)
+#define OS_TRACE_TIMESTAMP()        perf_cycles()
+#define OS_TRACE_TIMESTAMP_FREQ     SystemCoreClock
+#define OS_TRACE_TIMESTAMP_PERF
+#elif defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+static inline uint32_t HostTimestamp (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint32_t)(((uint64_t)ts.tv_sec * 10000000U) + ((uint64_t)ts.tv_nsec / 100U)));
+}
+#define OS_TRACE_TIMESTAMP()        HostTimestamp()
+#define OS_TRACE_TIMESTAMP_FREQ     10000000U
+#else
+#include "os_tick.h"
+#define OS_TRACE_TIMESTAMP()        ((uint32_t)OS_Tick_GetTimestamp64())
+#define OS_TRACE_TIMESTAMP_FREQ     OS_Tick_GetClock()
+#endif
+#endif
+
+// Maximum number of name characters (multiple of 4) and threads named at trace start
+#ifndef OS_TRACE_NAME_MAX
+#define OS_TRACE_NAME_MAX           32U
+#endif
+#ifndef OS_TRACE_THREAD_MAX
+#define OS_TRACE_THREAD_MAX         32U
+#endif
+
+// Kernel data section on targets (host builds such as the POSIX port use the default section,
+// Mach-O does not accept the ELF section name)
+#if defined(_RTE_)
+#define OS_TRACE_BSS                __attribute__((section(".bss.os")))
+#else
+#define OS_TRACE_BSS
+#endif
+
+// Trace buffer
+static OS_Trace_Header_t *TraceBuf   OS_TRACE_BSS;
+static OS_Trace_Record_t *TraceRec   OS_TRACE_BSS;
+static uint32_t           TraceShift OS_TRACE_BSS;
+
+// Reserve the next record index (lock-free, safe from threads and interrupts).
+static inline uint32_t TraceReserve (OS_Trace_Header_t *buf) {
+#if defined(__CORTEX_M) && (!defined(__ARM_FEATURE_LDREX) || ((__ARM_FEATURE_LDREX & 4) == 0))
+  // No exclusive word access (Armv6-M): interrupts are disabled for the increment
+  uint32_t primask = __get_PRIMASK();
+  uint32_t index;
+
+  __disable_irq();
+  index = buf->head;
+  buf->head = index + 1U;
+  __set_PRIMASK(primask);
+  return index;
+#else
+  return __atomic_fetch_add(&buf->head, 1U, __ATOMIC_RELAXED);
+#endif
+}
+
+// Initialize the trace buffer.
+uint32_t OS_Trace_Init (void *mem, uint32_t size) {
+  OS_Trace_Header_t *buf = (OS_Trace_Header_t *)mem;
+  uint32_t           count;
+  uint32_t           shift;
+  uint32_t           n;
+
+  if ((mem == NULL) || ((((uint32_t)(uintptr_t)mem) & 3U) != 0U) ||
+      (size < (sizeof(OS_Trace_Header_t) + (2U * sizeof(OS_Trace_Record_t))))) {
+    return 0U;
+  }
+
+  // Largest power of 2 number of records that fits
+  count = (size - (uint32_t)sizeof(OS_Trace_Header_t)) / (uint32_t)sizeof(OS_Trace_Record_t);
+  for (shift = 0U; (2UL << shift) <= count; shift++) {}
+  count = 1UL << shift;
+
+  TraceBuf = NULL;
+
+  buf->magic       = OS_TRACE_MAGIC;
+  buf->version     = (uint16_t)OS_TRACE_VERSION;
+  buf->record_size = (uint16_t)sizeof(OS_Trace_Record_t);
+  buf->count       = count;
+  buf->freq        = OS_TRACE_TIMESTAMP_FREQ;
+  buf->head        = 0U;
+  buf->enable      = 0U;
+  buf->reserved[0] = 0U;
+  buf->reserved[1] = 0U;
+
+  TraceRec = (OS_Trace_Record_t *)(buf + 1);
+  for (n = 0U; n < count; n++) {
+    TraceRec[n].seq = 0U;
+  }
+  TraceShift = shift;
+
+#if defined(OS_TRACE_TIMESTAMP_PERF) && !defined(OS_TRACE_NO_CYCCNT_SETUP)
+  // Enable the cycle counter
+  (void)perf_init();
+#endif
+
+  TraceBuf = buf;
+
+  return count;
+}
+
+// Record the names of the existing threads.
+static void TraceThreadNames (void) {
+  osThreadId_t thread[OS_TRACE_THREAD_MAX];
+  uint32_t     count;
+  uint32_t     n;
+
+  count = osThreadEnumerate(thread, OS_TRACE_THREAD_MAX);
+  for (n = 0U; n < count; n++) {
+    OS_Trace_ThreadName((uint32_t)(uintptr_t)thread[n], osThreadGetName(thread[n]));
+  }
+}
+
+// Start recording of trace events.
+void OS_Trace_Start (void) {
+  if (TraceBuf != NULL) {
+    __atomic_store_n(&TraceBuf->enable, 1U, __ATOMIC_RELAXED);
+    // Threads created later are named by the kernel
+    TraceThreadNames();
+  }
+}
+
+// Stop recording of trace events.
+void OS_Trace_Stop (void) {
+  if ((TraceBuf != NULL) && (__atomic_load_n(&TraceBuf->enable, __ATOMIC_RELAXED) != 0U)) {
+    // Names again at the end, since earlier name records may be overwritten
+    TraceThreadNames();
+    __atomic_store_n(&TraceBuf->enable, 0U, __ATOMIC_RELAXED);
+  }
+}
+
+// Record a trace event.
+void OS_Trace_Record (uint32_t event, uint32_t arg0, uint32_t arg1) {
+  OS_Trace_Header_t *buf = TraceBuf;
+  OS_Trace_Record_t *rec;
+  uint32_t           index;
+
+  if ((buf == NULL) || (__atomic_load_n(&buf->enable, __ATOMIC_RELAXED) == 0U)) {
+    return;
+  }
+
+  index = TraceReserve(buf);
+  rec   = &TraceRec[index & (buf->count - 1U)];
+
+  // Invalidate the slot, write the record and publish it with the sequence tag
+  rec->seq       = 0U;
+  rec->timestamp = OS_TRACE_TIMESTAMP();
+  rec->event     = (uint16_t)event;
+  rec->arg0      = arg0;
+  rec->arg1      = arg1;
+  __atomic_store_n(&rec->seq, (uint16_t)(0x8000U | ((index >> TraceShift) & 0x7FFFU)), __ATOMIC_RELEASE);
+}
+
+// Record the name of a thread.
+void OS_Trace_ThreadName (uint32_t thread, const char *name) {
+  uint32_t chars;
+  uint32_t n, k;
+
+  if ((name == NULL) || (TraceBuf == NULL) || (__atomic_load_n(&TraceBuf->enable, __ATOMIC_RELAXED) == 0U)) {
+    return;
+  }
+
+  // Four characters per record (little-endian), the last record contains the terminating zero
+  for (n = 0U; n < (OS_TRACE_NAME_MAX / 4U); n++) {
+    chars = 0U;
+    for (k = 0U; (k < 4U) && (*name != '\0'); k++) {
+      chars |= (uint32_t)(uint8_t)*name++ << (k * 8U);
+    }
+    OS_Trace_Record(OS_TRACE_THREAD_NAME | n, thread, chars);
+    if (k < 4U) {
+      break;
+    }
+  }
+}
+
+// Record a user event.
+void OS_Trace_User (uint32_t id, uint32_t arg0, uint32_t arg1) {
+  OS_Trace_Record(OS_TRACE_USER | (id & 0x7FFFU), arg0, arg1);
+}
+
+// Get the trace buffer.
+const OS_Trace_Header_t *OS_Trace_GetBuffer (uint32_t *size) {
+  const OS_Trace_Header_t *buf = TraceBuf;
+
+  if (size != NULL) {
+    *size = (buf != NULL) ? ((uint32_t)sizeof(OS_Trace_Header_t) + (buf->count * (uint32_t)sizeof(OS_Trace_Record_t))) : 0U;
+  }
+  return buf;
+}
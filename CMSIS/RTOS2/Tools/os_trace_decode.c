@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * $Revision:   V1.0.0
+ *
+ * Project:     CMSIS-RTOS2
+ * Title:       OS Trace decoder (host tool)
+ *
+ * Converts a memory dump of an OS Trace buffer into Chrome trace event JSON
+ * that is displayed by Perfetto (ui.perfetto.dev) or chrome://tracing, with
+ * one track per thread (running and waiting slices), a CPU track and one
+ * track per interrupt. The dump may be a larger memory image that contains
+ * the trace buffer; the buffer is located by its header.
+ *
+ * Build:  cc -O2 -o os_trace_decode os_trace_decode.c
+ * Usage:  os_trace_decode [-t] [-o output] dump.bin
+ *           -t         list the trace records as text instead of JSON
+ *           -o output  write to file (default: standard output)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Include/os_trace.h"
+
+#define NAME_MAX_CHARS  64U             // Maximum thread name length
+
+// Decoded trace record
+typedef struct {
+  uint64_t time;                        // Unwrapped timestamp
+  uint16_t event;
+  uint32_t arg0;
+  uint32_t arg1;
+} record_t;
+
+// Thread track
+typedef struct {
+  uint32_t id;                          // Thread identification
+  uint32_t tid;                         // Track ID
+  char     name[NAME_MAX_CHARS + 1U];
+  int      running;                     // Running slice open
+  uint64_t run_start;
+  int      waiting;                     // Wait slice open
+  uint64_t wait_start;
+  uint32_t wait_reason;
+  uint32_t wait_timeout;
+} thread_t;
+
+// Interrupt track
+typedef struct {
+  uint32_t id;                          // Interrupt number
+  uint32_t tid;                         // Track ID
+  uint32_t nest;                        // Open slices
+  uint64_t start[8];
+} irq_t;
+
+static const char *WaitReason[16] = {
+  "wait", "delay", "join", "thread flags", "event flags", "mutex", "semaphore", "memory pool",
+  "message get", "message put", "timer", "multiple", "rwlock", "stream read", "stream write", "work"
+};
+
+static thread_t *Thread;
+static uint32_t  ThreadCount;
+static irq_t    *Irq;
+static uint32_t  IrqCount;
+static double    TimeScale;             // Microseconds per timestamp tick
+static FILE     *Out;
+static int       First = 1;
+
+// Read little-endian values.
+static uint32_t Get16 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8));
+}
+static uint32_t Get32 (const uint8_t *p) {
+  return ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+// Locate the trace buffer header in the dump.
+static long FindHeader (const uint8_t *data, size_t size) {
+  size_t   offset;
+  uint32_t count;
+
+  for (offset = 0U; (offset + sizeof(OS_Trace_Header_t)) <= size; offset += 4U) {
+    if ((Get32(&data[offset]) != OS_TRACE_MAGIC) ||
+        (Get16(&data[offset + 4U]) != OS_TRACE_VERSION) ||
+        (Get16(&data[offset + 6U]) != sizeof(OS_Trace_Record_t))) {
+      continue;
+    }
+    count = Get32(&data[offset + 8U]);
+    if ((count < 2U) || ((count & (count - 1U)) != 0U) ||
+        ((size - offset - sizeof(OS_Trace_Header_t)) / sizeof(OS_Trace_Record_t)) < count) {
+      continue;
+    }
+    return (long)offset;
+  }
+  return -1;
+}
+
+// Get (or add) the track of a thread.
+static thread_t *ThreadGet (uint32_t id) {
+  uint32_t n;
+
+  for (n = 0U; n < ThreadCount; n++) {
+    if (Thread[n].id == id) {
+      return &Thread[n];
+    }
+  }
+  Thread = realloc(Thread, (ThreadCount + 1U) * sizeof(thread_t));
+  if (Thread == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  memset(&Thread[ThreadCount], 0, sizeof(thread_t));
+  Thread[ThreadCount].id  = id;
+  Thread[ThreadCount].tid = ThreadCount + 1U;
+  (void)snprintf(Thread[ThreadCount].name, sizeof(Thread[0].name), "thread 0x%08" PRIX32, id);
+  return &Thread[ThreadCount++];
+}
+
+// Get (or add) the track of an interrupt.
+static irq_t *IrqGet (uint32_t id) {
+  uint32_t n;
+
+  for (n = 0U; n < IrqCount; n++) {
+    if (Irq[n].id == id) {
+      return &Irq[n];
+    }
+  }
+  Irq = realloc(Irq, (IrqCount + 1U) * sizeof(irq_t));
+  if (Irq == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  memset(&Irq[IrqCount], 0, sizeof(irq_t));
+  Irq[IrqCount].id  = id;
+  Irq[IrqCount].tid = IrqCount + 1U;
+  return &Irq[IrqCount++];
+}
+
+// Write a JSON string (escaped).
+static void JsonString (const char *s) {
+  fputc('"', Out);
+  for (; *s != '\0'; s++) {
+    if ((*s == '"') || (*s == '\\')) {
+      fputc('\\', Out);
+      fputc(*s, Out);
+    } else if ((uint8_t)*s < 0x20U) {
+      fprintf(Out, "\\u%04x", (unsigned)(uint8_t)*s);
+    } else {
+      fputc(*s, Out);
+    }
+  }
+  fputc('"', Out);
+}
+
+// Start a trace event object.
+static void EventBegin (const char *name, char ph, uint32_t pid, uint32_t tid, uint64_t time) {
+  fputs(First ? "\n  {" : ",\n  {", Out);
+  First = 0;
+  fputs("\"name\":", Out);
+  JsonString(name);
+  fprintf(Out, ",\"ph\":\"%c\",\"pid\":%" PRIu32 ",\"tid\":%" PRIu32 ",\"ts\":%.3f",
+          ph, pid, tid, (double)time * TimeScale);
+}
+
+// Complete slice ("X" event).
+static void Slice (const char *name, uint32_t pid, uint32_t tid, uint64_t start, uint64_t end, const char *args) {
+  if (end < start) {
+    end = start;
+  }
+  EventBegin(name, 'X', pid, tid, start);
+  fprintf(Out, ",\"dur\":%.3f", (double)(end - start) * TimeScale);
+  if (args != NULL) {
+    fprintf(Out, ",\"args\":{%s}", args);
+  }
+  fputc('}', Out);
+}
+
+// Instant event ("i" event, thread scope).
+static void Instant (const char *name, uint32_t pid, uint32_t tid, uint64_t time, const char *args) {
+  EventBegin(name, 'i', pid, tid, time);
+  fputs(",\"s\":\"t\"", Out);
+  if (args != NULL) {
+    fprintf(Out, ",\"args\":{%s}", args);
+  }
+  fputc('}', Out);
+}
+
+// Track name metadata event.
+static void TrackName (const char *meta, uint32_t pid, uint32_t tid, const char *name) {
+  fputs(First ? "\n  {" : ",\n  {", Out);
+  First = 0;
+  fprintf(Out, "\"name\":\"%s\",\"ph\":\"M\",\"pid\":%" PRIu32 ",\"tid\":%" PRIu32 ",\"args\":{\"name\":",
+          meta, pid, tid);
+  JsonString(name);
+  fputs("}}", Out);
+}
+
+// Close the running slice of a thread.
+static void RunEnd (thread_t *t, uint64_t time) {
+  if (t->running != 0) {
+    Slice("running", 1U, t->tid, t->run_start, time, NULL);
+    Slice(t->name, 1U, 0U, t->run_start, time, NULL);
+    t->running = 0;
+  }
+}
+
+// Collect thread names (first pass).
+static void CollectNames (const record_t *rec, uint32_t count) {
+  thread_t *t;
+  uint32_t  index;
+  uint32_t  n, k;
+
+  for (n = 0U; n < count; n++) {
+    if ((rec[n].event & 0xFF00U) == OS_TRACE_THREAD_NAME) {
+      t     = ThreadGet(rec[n].arg0);
+      index = (rec[n].event & 0xFFU) * 4U;
+      if (index == 0U) {
+        memset(t->name, 0, sizeof(t->name));
+      }
+      for (k = 0U; (k < 4U) && ((index + k) < NAME_MAX_CHARS); k++) {
+        t->name[index + k] = (char)(rec[n].arg1 >> (k * 8U));
+      }
+    }
+  }
+}
+
+// Write Chrome trace event JSON (second pass).
+static void WriteJson (const record_t *rec, uint32_t count) {
+  thread_t *t;
+  irq_t    *irq;
+  char      args[96];
+  uint64_t  end;
+  uint32_t  n;
+
+  fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", Out);
+
+  for (n = 0U; n < count; n++) {
+    const record_t *r = &rec[n];
+
+    switch (r->event & 0xFF00U) {
+      case OS_TRACE_THREAD_SWITCH:
+        if (r->arg1 != 0U) {
+          RunEnd(ThreadGet(r->arg1), r->time);
+        }
+        if (r->arg0 != 0U) {
+          t = ThreadGet(r->arg0);
+          RunEnd(t, r->time);
+          t->running   = 1;
+          t->run_start = r->time;
+        }
+        break;
+      case OS_TRACE_THREAD_CREATE:
+        t = ThreadGet(r->arg0);
+        (void)snprintf(args, sizeof(args), "\"priority\":%" PRIu32, r->arg1);
+        Instant("create", 1U, t->tid, r->time, args);
+        break;
+      case OS_TRACE_THREAD_EXIT:
+        t = ThreadGet(r->arg0);
+        RunEnd(t, r->time);
+        Instant("exit", 1U, t->tid, r->time, NULL);
+        break;
+      case OS_TRACE_WAIT_ENTER:
+        t = ThreadGet(r->arg0);
+        t->waiting      = 1;
+        t->wait_start   = r->time;
+        t->wait_reason  = r->event & 0x0FU;
+        t->wait_timeout = r->arg1;
+        break;
+      case OS_TRACE_WAIT_EXIT:
+        t = ThreadGet(r->arg0);
+        if (t->waiting != 0) {
+          if (t->wait_timeout == 0xFFFFFFFFU) {
+            (void)snprintf(args, sizeof(args), "\"timeout\":\"forever\",\"result\":\"0x%08" PRIX32 "\"", r->arg1);
+          } else {
+            (void)snprintf(args, sizeof(args), "\"timeout\":%" PRIu32 ",\"result\":\"0x%08" PRIX32 "\"",
+                           t->wait_timeout, r->arg1);
+          }
+          Slice(WaitReason[t->wait_reason], 1U, t->tid, t->wait_start, r->time, args);
+          t->waiting = 0;
+        }
+        break;
+      case OS_TRACE_ISR_ENTER:
+        irq = IrqGet(r->arg0);
+        if (irq->nest < (sizeof(irq->start) / sizeof(irq->start[0]))) {
+          irq->start[irq->nest] = r->time;
+        }
+        irq->nest++;
+        break;
+      case OS_TRACE_ISR_EXIT:
+        irq = IrqGet(r->arg0);
+        if (irq->nest != 0U) {
+          irq->nest--;
+          if (irq->nest < (sizeof(irq->start) / sizeof(irq->start[0]))) {
+            Slice("ISR", 2U, irq->tid, irq->start[irq->nest], r->time, NULL);
+          }
+        }
+        break;
+      case OS_TRACE_THREAD_NAME:
+        break;
+      default:
+        if ((r->event & OS_TRACE_USER) != 0U) {
+          (void)snprintf(args, sizeof(args), "\"arg0\":\"0x%08" PRIX32 "\",\"arg1\":\"0x%08" PRIX32 "\"",
+                         r->arg0, r->arg1);
+          (void)snprintf(args + strlen(args), sizeof(args) - strlen(args), ",\"id\":%u", r->event & 0x7FFFU);
+          Instant("user", 1U, 0U, r->time, args);
+        }
+        break;
+    }
+  }
+
+  // Close open slices at the end of the trace
+  end = (count != 0U) ? rec[count - 1U].time : 0U;
+  for (n = 0U; n < ThreadCount; n++) {
+    RunEnd(&Thread[n], end);
+    if (Thread[n].waiting != 0) {
+      Slice(WaitReason[Thread[n].wait_reason], 1U, Thread[n].tid, Thread[n].wait_start, end, NULL);
+    }
+  }
+
+  // Track names
+  TrackName("process_name", 1U, 0U, "CMSIS-RTOS2 Threads");
+  TrackName("thread_name",  1U, 0U, "CPU");
+  for (n = 0U; n < ThreadCount; n++) {
+    TrackName("thread_name", 1U, Thread[n].tid, Thread[n].name);
+  }
+  if (IrqCount != 0U) {
+    TrackName("process_name", 2U, 0U, "Interrupts");
+    for (n = 0U; n < IrqCount; n++) {
+      (void)snprintf(args, sizeof(args), "IRQ 0x%" PRIX32, Irq[n].id);
+      TrackName("thread_name", 2U, Irq[n].tid, args);
+    }
+  }
+
+  fputs("\n]}\n", Out);
+}
+
+// List trace records as text.
+static void WriteText (const record_t *rec, uint32_t count) {
+  static const char *event_name[9] = {
+    "user", "switch", "create", "exit", "name", "wait", "wakeup", "isr enter", "isr exit"
+  };
+  uint32_t type;
+  uint32_t n;
+
+  for (n = 0U; n < count; n++) {
+    type = ((rec[n].event & OS_TRACE_USER) != 0U) ? 0U : (uint32_t)(rec[n].event >> 8);
+    fprintf(Out, "%14.3f us  %-10s 0x%02X  0x%08" PRIX32 "  0x%08" PRIX32 "\n",
+            (double)rec[n].time * TimeScale, (type < 9U) ? event_name[type] : "unknown",
+            rec[n].event & (((rec[n].event & OS_TRACE_USER) != 0U) ? 0x7FFFU : 0xFFU),
+            rec[n].arg0, rec[n].arg1);
+  }
+}
+
+int main (int argc, char *argv[]) {
+  const char *input  = NULL;
+  const char *output = NULL;
+  int         text   = 0;
+  FILE       *f;
+  uint8_t    *data;
+  long        size;
+  long        offset;
+  uint32_t    count, head, freq, shift;
+  uint32_t    index, first, n, valid;
+  int64_t     time, time_min;
+  uint32_t    last;
+  record_t   *rec;
+  const uint8_t *p;
+  int         i;
+
+  for (i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-t") == 0) {
+      text = 1;
+    } else if ((strcmp(argv[i], "-o") == 0) && ((i + 1) < argc)) {
+      output = argv[++i];
+    } else {
+      input = argv[i];
+    }
+  }
+  if (input == NULL) {
+    fprintf(stderr, "Usage: %s [-t] [-o output] dump.bin\n", argv[0]);
+    return 2;
+  }
+
+  // Read the dump
+  f = fopen(input, "rb");
+  if (f == NULL) {
+    perror(input);
+    return 1;
+  }
+  (void)fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  (void)fseek(f, 0, SEEK_SET);
+  data = malloc((size > 0) ? (size_t)size : 1U);
+  if ((data == NULL) || (size <= 0) || (fread(data, 1U, (size_t)size, f) != (size_t)size)) {
+    fprintf(stderr, "%s: read error\n", input);
+    return 1;
+  }
+  fclose(f);
+
+  offset = FindHeader(data, (size_t)size);
+  if (offset < 0) {
+    fprintf(stderr, "%s: no trace buffer found\n", input);
+    return 1;
+  }
+  count = Get32(&data[offset + 8]);
+  freq  = Get32(&data[offset + 12]);
+  head  = Get32(&data[offset + 16]);
+  for (shift = 0U; (1UL << shift) < count; shift++) {}
+  TimeScale = (freq != 0U) ? (1e6 / (double)freq) : 1.0;
+
+  // Extract valid records in write order (oldest first)
+  n     = (head < count) ? head : count;
+  first = head - n;
+  rec   = calloc((n != 0U) ? n : 1U, sizeof(record_t));
+  if (rec == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  valid    = 0U;
+  time     = 0;
+  time_min = 0;
+  last     = 0U;
+  for (index = first; index != head; index++) {
+    p = &data[offset + (long)sizeof(OS_Trace_Header_t) + ((long)(index & (count - 1U)) * (long)sizeof(OS_Trace_Record_t))];
+    if (Get16(&p[6]) != (0x8000U | ((index >> shift) & 0x7FFFU))) {
+      continue;                         // Incomplete or overwritten record
+    }
+    // Unwrap the 32-bit timestamp (records may be slightly out of order)
+    if (valid != 0U) {
+      time += (int32_t)(Get32(&p[0]) - last);
+    }
+    last = Get32(&p[0]);
+    if (time < time_min) {
+      time_min = time;
+    }
+    rec[valid].time  = (uint64_t)time;
+    rec[valid].event = (uint16_t)Get16(&p[4]);
+    rec[valid].arg0  = Get32(&p[8]);
+    rec[valid].arg1  = Get32(&p[12]);
+    valid++;
+  }
+  for (n = 0U; n < valid; n++) {
+    rec[n].time -= (uint64_t)time_min;  // Time relative to the earliest record
+  }
+  n = (head < count) ? head : count;
+  fprintf(stderr, "%s: %" PRIu32 " records (%" PRIu32 " written, %" PRIu32 " invalid), %" PRIu32 " Hz\n",
+          input, valid, head, n - valid, freq);
+
+  Out = stdout;
+  if (output != NULL) {
+    Out = fopen(output, "w");
+    if (Out == NULL) {
+      perror(output);
+      return 1;
+    }
+  }
+
+  CollectNames(rec, valid);
+  if (text != 0) {
+    WriteText(rec, valid);
+  } else {
+    WriteJson(rec, valid);
+  }
+
+  if (Out != stdout) {
+    fclose(Out);
+  }
+  free(rec);
+  free(data);
+  free(Thread);
+  free(Irq);
+
+  return 0;
+}